@@ -0,0 +1,120 @@
+// Copyright 2023 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/charconv/batch_to_chars.hpp>
+#include <boost/charconv.hpp>
+#include <boost/core/detail/splitmix64.hpp>
+#include <boost/config.hpp>
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <cstring>
+#include <cstdint>
+#include <cmath>
+
+constexpr unsigned N = 2'000'000;
+constexpr int K = 10;
+
+// Model weights, and sensor readings that are mostly printed without an exponent
+static BOOST_NOINLINE std::vector<float> init_weights()
+{
+    std::vector<float> data;
+    data.reserve( N );
+
+    boost::detail::splitmix64 rng;
+
+    while( data.size() < N )
+    {
+        std::uint32_t x = static_cast<std::uint32_t>( rng() );
+        float v;
+        std::memcpy( &v, &x, sizeof( v ) );
+
+        if( std::isfinite( v ) )
+        {
+            data.push_back( v );
+        }
+    }
+
+    return data;
+}
+
+static BOOST_NOINLINE std::vector<float> init_readings()
+{
+    std::vector<float> data;
+    data.reserve( N );
+
+    boost::detail::splitmix64 rng;
+
+    while( data.size() < N )
+    {
+        data.push_back( static_cast<float>( rng() % 2000000 ) / 1000 - 1000 );
+    }
+
+    return data;
+}
+
+using namespace std::chrono_literals;
+
+static BOOST_NOINLINE void test_serial( std::vector<float> const& data, std::vector<char>& out, char const* label )
+{
+    auto t1 = std::chrono::steady_clock::now();
+
+    std::size_t s = 0;
+
+    for( int i = 0; i < K; ++i )
+    {
+        char* first = out.data();
+        char* last = out.data() + out.size();
+
+        for( auto x: data )
+        {
+            first = boost::charconv::to_chars( first, last, x ).ptr;
+            *first++ = '\n';
+        }
+
+        s += static_cast<std::size_t>( first - out.data() );
+    }
+
+    auto t2 = std::chrono::steady_clock::now();
+
+    std::cout << std::setw( 40 ) << label << ": " << std::setw( 5 ) << ( t2 - t1 ) / 1ms << " ms (s=" << s << ")\n";
+}
+
+static BOOST_NOINLINE void test_batch( std::vector<float> const& data, std::vector<char>& out, char const* label )
+{
+    auto t1 = std::chrono::steady_clock::now();
+
+    std::size_t s = 0;
+
+    for( int i = 0; i < K; ++i )
+    {
+        auto r = boost::charconv::batch_to_chars( out.data(), out.data() + out.size(), data.data(), data.size(), '\n' );
+        s += static_cast<std::size_t>( r.ptr - out.data() );
+    }
+
+    auto t2 = std::chrono::steady_clock::now();
+
+    std::cout << std::setw( 40 ) << label << ": " << std::setw( 5 ) << ( t2 - t1 ) / 1ms << " ms (s=" << s << ")\n";
+}
+
+int main()
+{
+    std::vector<char> out( N * ( boost::charconv::limits<float>::max_chars10 + 1 ) );
+
+    std::vector<float> weights = init_weights();
+    std::vector<float> readings = init_readings();
+
+    std::cout << "---\n";
+
+    test_serial( weights, out, "to_chars loop, random bits" );
+    test_batch( weights, out, "batch_to_chars, random bits" );
+
+    std::cout << '\n';
+
+    test_serial( readings, out, "to_chars loop, readings" );
+    test_batch( readings, out, "batch_to_chars, readings" );
+
+    std::cout << "---\n\n";
+}
@@ -0,0 +1,114 @@
+// Copyright 2023 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/charconv/column_profile.hpp>
+#include <boost/charconv.hpp>
+#include <boost/core/detail/splitmix64.hpp>
+#include <boost/config.hpp>
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <cstdint>
+
+constexpr unsigned N = 2'000'000;
+constexpr int K = 10;
+
+// A column of identifiers, one per line
+static BOOST_NOINLINE std::string init_input_data()
+{
+    std::string data;
+    data.reserve( N * 12 );
+
+    boost::detail::splitmix64 rng;
+
+    for( unsigned i = 0; i < N; ++i )
+    {
+        data += std::to_string( rng() % 100'000'000'000ull );
+        data += '\n';
+    }
+
+    return data;
+}
+
+using namespace std::chrono_literals;
+
+// Every value through the general float parser
+static BOOST_NOINLINE void test_general( std::string const& data )
+{
+    auto t1 = std::chrono::steady_clock::now();
+
+    double s = 0;
+
+    for( int i = 0; i < K; ++i )
+    {
+        char const* first = data.data();
+        char const* last = data.data() + data.size();
+
+        while( first != last )
+        {
+            double v;
+            auto r = boost::charconv::from_chars( first, last, v );
+            s += v;
+            first = r.ptr + 1;
+        }
+    }
+
+    auto t2 = std::chrono::steady_clock::now();
+
+    std::cout << "                from_chars<double>: " << std::setw( 5 ) << ( t2 - t1 ) / 1ms << " ms (s=" << s << ")\n";
+}
+
+// Profiled first, then parsed with the integer overload
+static BOOST_NOINLINE void test_profiled( std::string const& data )
+{
+    auto t1 = std::chrono::steady_clock::now();
+
+    double s = 0;
+
+    for( int i = 0; i < K; ++i )
+    {
+        char const* first = data.data();
+        char const* last = data.data() + data.size();
+
+        auto p = boost::charconv::profile_column( first, last, '\n' );
+
+        if( ( p.kind == boost::charconv::column_kind::integer || p.kind == boost::charconv::column_kind::fixed_width_integer ) && p.max_digits <= 15 )
+        {
+            while( first != last )
+            {
+                std::int64_t v;
+                auto r = boost::charconv::from_chars( first, last, v );
+                s += static_cast<double>( v );
+                first = r.ptr + 1;
+            }
+        }
+        else
+        {
+            while( first != last )
+            {
+                double v;
+                auto r = boost::charconv::from_chars( first, last, v );
+                s += v;
+                first = r.ptr + 1;
+            }
+        }
+    }
+
+    auto t2 = std::chrono::steady_clock::now();
+
+    std::cout << "profile_column + from_chars<int64>: " << std::setw( 5 ) << ( t2 - t1 ) / 1ms << " ms (s=" << s << ")\n";
+}
+
+int main()
+{
+    std::cout << "---\n";
+
+    std::string const data = init_input_data();
+
+    test_general( data );
+    test_profiled( data );
+
+    std::cout << "---\n\n";
+}
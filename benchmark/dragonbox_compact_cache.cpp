@@ -0,0 +1,105 @@
+// Copyright 2023 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/charconv/detail/dragonbox/dragonbox.hpp>
+#include <boost/core/detail/splitmix64.hpp>
+#include <boost/config.hpp>
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <cstring>
+#include <cmath>
+
+constexpr unsigned N = 2'000'000;
+constexpr int K = 10;
+
+static BOOST_NOINLINE std::vector<double> init_input_data()
+{
+    std::vector<double> data;
+    data.reserve( N );
+
+    boost::detail::splitmix64 rng;
+
+    while( data.size() < N )
+    {
+        std::uint64_t x = rng();
+        double d;
+        std::memcpy( &d, &x, sizeof( d ) );
+
+        if( std::isfinite( d ) && d != 0 )
+        {
+            data.push_back( d );
+        }
+    }
+
+    return data;
+}
+
+// Other work of the process, which evicts the tables from the caches between conversions
+static std::vector<unsigned char> other_work( 4 << 20 );
+
+static BOOST_NOINLINE std::size_t touch_other_work( std::size_t i )
+{
+    std::size_t s = 0;
+    std::size_t const offset = i * 32768 % other_work.size();
+
+    for( std::size_t j = 0; j < 32768; j += 64 )
+    {
+        s += ++other_work[ offset + j ];
+    }
+
+    return s;
+}
+
+using namespace std::chrono_literals;
+
+template<class Policy> static BOOST_NOINLINE void test_to_decimal( std::vector<double> const& data, char const* label, int work_every )
+{
+    auto t1 = std::chrono::steady_clock::now();
+
+    std::size_t s = 0;
+
+    for( int i = 0; i < K; ++i )
+    {
+        std::size_t n = 0;
+
+        for( auto x: data )
+        {
+            auto r = boost::charconv::detail::to_decimal( x, Policy{} );
+            s += static_cast<std::size_t>( r.significand ) + static_cast<std::size_t>( r.exponent );
+
+            if( work_every != 0 && ++n % work_every == 0 )
+            {
+                s += touch_other_work( n );
+            }
+        }
+    }
+
+    auto t2 = std::chrono::steady_clock::now();
+
+    std::cout << "to_decimal<double>, " << label << ( work_every != 0? ", with other work": "                 " ) << ": " << std::setw( 5 ) << ( t2 - t1 ) / 1ms << " ms (s=" << s << ")\n";
+}
+
+int main()
+{
+    using full = boost::charconv::detail::policy_impl::cache::full;
+    using compact = boost::charconv::detail::policy_impl::cache::compact;
+    using compressed = boost::charconv::detail::compressed_cache_detail;
+
+    std::vector<double> const data = init_input_data();
+
+    std::cout << "---\n";
+
+    std::cout << "   full cache: " << sizeof( boost::charconv::detail::cache_holder_ieee754_binary64::cache ) << " bytes\n";
+    std::cout << "compact cache: " << sizeof( compressed::table ) + sizeof( compressed::pow5_table ) << " bytes\n\n";
+
+    test_to_decimal<full>( data, "   full", 0 );
+    test_to_decimal<compact>( data, "compact", 0 );
+
+    test_to_decimal<full>( data, "   full", 16 );
+    test_to_decimal<compact>( data, "compact", 16 );
+
+    std::cout << "---\n\n";
+}
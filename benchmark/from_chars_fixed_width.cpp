@@ -0,0 +1,115 @@
+// Copyright 2023 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/charconv/from_chars.hpp>
+#include <boost/core/type_name.hpp>
+#include <boost/core/detail/splitmix64.hpp>
+#include <boost/config.hpp>
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+
+constexpr unsigned N = 2'000'000;
+constexpr int K = 10;
+
+// A column of records such as "-01234.567890\n"
+static BOOST_NOINLINE std::string init_input_data( int integer_digits, int fraction_digits, std::size_t& width )
+{
+    width = 1 + integer_digits + 1 + fraction_digits;
+
+    std::string data;
+    data.reserve( N * ( width + 1 ) );
+
+    boost::detail::splitmix64 rng;
+
+    for( unsigned i = 0; i < N; ++i )
+    {
+        std::uint64_t x = rng();
+
+        data += ( x & 1 )? '-': ' ';
+        x >>= 1;
+
+        for( int j = 0; j < integer_digits + fraction_digits; ++j )
+        {
+            if( j == integer_digits ) data += '.';
+            data += static_cast<char>( '0' + x % 10 );
+            x = x / 10 + rng() % 7;
+        }
+
+        data += '\n';
+    }
+
+    return data;
+}
+
+using namespace std::chrono_literals;
+
+template<class T> static BOOST_NOINLINE void test_from_chars( std::string const& data, std::size_t width, char const* label )
+{
+    std::vector<T> values( N );
+
+    auto t1 = std::chrono::steady_clock::now();
+
+    double s = 0;
+
+    for( int i = 0; i < K; ++i )
+    {
+        for( unsigned j = 0; j < N; ++j )
+        {
+            const char* first = data.data() + j * ( width + 1 );
+            if( *first == ' ' ) ++first;
+
+            boost::charconv::from_chars( first, data.data() + j * ( width + 1 ) + width, values[ j ] );
+        }
+
+        s = s / 16.0 + values[ i ];
+    }
+
+    auto t2 = std::chrono::steady_clock::now();
+
+    std::cout << "          boost::charconv::from_chars<" << boost::core::type_name<T>() << ">, " << label << ": " << std::setw( 5 ) << ( t2 - t1 ) / 1ms << " ms (s=" << s << ")\n";
+}
+
+template<class T> static BOOST_NOINLINE void test_from_chars_fixed_width( std::string const& data, std::size_t width, char const* label )
+{
+    std::vector<T> values( N );
+
+    auto t1 = std::chrono::steady_clock::now();
+
+    double s = 0;
+
+    for( int i = 0; i < K; ++i )
+    {
+        boost::charconv::from_chars_fixed_width( data.data(), width, width + 1, values.data(), N );
+
+        s = s / 16.0 + values[ i ];
+    }
+
+    auto t2 = std::chrono::steady_clock::now();
+
+    std::cout << "boost::charconv::from_chars_fixed_width<" << boost::core::type_name<T>() << ">, " << label << ": " << std::setw( 5 ) << ( t2 - t1 ) / 1ms << " ms (s=" << s << ")\n";
+}
+
+template<class T> static void test( int integer_digits, int fraction_digits, char const* label )
+{
+    std::size_t width;
+    std::string const data = init_input_data( integer_digits, fraction_digits, width );
+
+    test_from_chars<T>( data, width, label );
+    test_from_chars_fixed_width<T>( data, width, label );
+}
+
+int main()
+{
+    std::cout << "---\n";
+
+    test<float>( 3, 4, "    ddd.dddd" );
+    test<double>( 3, 4, "    ddd.dddd" );
+    test<double>( 6, 6, " dddddd.dddddd" );
+    test<double>( 9, 9, "  19 digits" );
+
+    std::cout << "---\n\n";
+}
@@ -0,0 +1,102 @@
+// Copyright 2023 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/charconv.hpp>
+#include <boost/charconv/detail/from_chars_integer_impl.hpp>
+#include <boost/core/detail/splitmix64.hpp>
+#include <boost/config.hpp>
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <cstdint>
+
+constexpr unsigned N = 2'000'000;
+constexpr int K = 10;
+
+using boost::charconv::detail::uint128;
+
+// 128-bit IDs of every length
+static BOOST_NOINLINE std::vector<std::string> init_input_data()
+{
+    std::vector<std::string> data;
+    data.reserve( N );
+
+    boost::detail::splitmix64 rng;
+
+    for( unsigned i = 0; i < N; ++i )
+    {
+        std::string str;
+
+        unsigned n = 1 + rng() % 39;
+        str += static_cast<char>( '1' + rng() % 2 );
+        for( unsigned j = 1; j < n; ++j )
+        {
+            str += static_cast<char>( '0' + rng() % 10 );
+        }
+
+        data.push_back( str );
+    }
+
+    return data;
+}
+
+using namespace std::chrono_literals;
+
+template<class T, class F> static BOOST_NOINLINE void test( std::vector<std::string> const& data, char const* label, F f )
+{
+    auto t1 = std::chrono::steady_clock::now();
+
+    std::uint64_t s = 0;
+
+    for( int i = 0; i < K; ++i )
+    {
+        for( auto const& x: data )
+        {
+            T v{};
+            f( x.data(), x.data() + x.size(), v );
+            s += static_cast<std::uint64_t>( v );
+        }
+    }
+
+    auto t2 = std::chrono::steady_clock::now();
+
+    std::cout << std::setw( 40 ) << label << ": " << std::setw( 5 ) << ( t2 - t1 ) / 1ms << " ms (s=" << s << ")\n";
+}
+
+int main()
+{
+    using namespace boost::charconv::detail;
+
+    std::vector<std::string> data = init_input_data();
+
+    std::cout << "---\n";
+
+#ifdef BOOST_CHARCONV_HAS_INT128
+
+    test<boost::uint128_type>( data, "digit at a time, unsigned __int128", []( char const* first, char const* last, boost::uint128_type& v ){
+        from_chars_integer_impl<boost::uint128_type, boost::uint128_type>( first, last, v, 10 ); } );
+
+    test<boost::uint128_type>( data, "from_chars, unsigned __int128", []( char const* first, char const* last, boost::uint128_type& v ){
+        boost::charconv::from_chars( first, last, v ); } );
+
+    test<boost::int128_type>( data, "digit at a time, __int128", []( char const* first, char const* last, boost::int128_type& v ){
+        from_chars_integer_impl<boost::int128_type, boost::uint128_type>( first, last, v, 10 ); } );
+
+    test<boost::int128_type>( data, "from_chars, __int128", []( char const* first, char const* last, boost::int128_type& v ){
+        boost::charconv::from_chars( first, last, v ); } );
+
+    std::cout << '\n';
+
+#endif
+
+    test<uint128>( data, "digit at a time, emulated uint128", []( char const* first, char const* last, uint128& v ){
+        from_chars_integer_impl<uint128, uint128>( first, last, v, 10 ); } );
+
+    test<uint128>( data, "from_chars128, emulated uint128", []( char const* first, char const* last, uint128& v ){
+        from_chars128( first, last, v ); } );
+
+    std::cout << "---\n\n";
+}
@@ -0,0 +1,146 @@
+// Copyright 2023 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/charconv.hpp>
+#include <boost/core/type_name.hpp>
+#include <boost/core/detail/splitmix64.hpp>
+#include <boost/config.hpp>
+#include <chrono>
+#include <cfenv>
+#include <cstdlib>
+#include <cstring>
+#include <cmath>
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+
+constexpr unsigned N = 2'000'000;
+constexpr int K = 10;
+
+template<class T> static BOOST_NOINLINE std::vector<std::string> init_input_data()
+{
+    std::vector<std::string> data;
+    data.reserve( N );
+
+    boost::detail::splitmix64 rng;
+
+    while( data.size() < N )
+    {
+        std::uint64_t x = rng();
+        T v;
+        std::memcpy( &v, &x, sizeof( v ) );
+
+        if( std::isfinite( v ) )
+        {
+            // Random precisions, so that some of the numbers are exactly representable and most are not
+            char buffer[ 64 ];
+            auto r = boost::charconv::to_chars( buffer, buffer + sizeof( buffer ), v, boost::charconv::chars_format::scientific, static_cast<int>( rng() % 17 ) );
+            data.push_back( std::string( buffer, r.ptr ) );
+        }
+    }
+
+    return data;
+}
+
+template<class T> static T strtox( char const* str, char** endptr );
+
+template<> float strtox( char const* str, char** endptr )
+{
+    return std::strtof( str, endptr );
+}
+
+template<> double strtox( char const* str, char** endptr )
+{
+    return std::strtod( str, endptr );
+}
+
+using namespace std::chrono_literals;
+
+template<class T> static BOOST_NOINLINE void test_from_chars( std::vector<std::string> const& data )
+{
+    auto t1 = std::chrono::steady_clock::now();
+
+    double s = 0;
+
+    for( int i = 0; i < K; ++i )
+    {
+        for( auto const& x: data )
+        {
+            T v;
+            boost::charconv::from_chars( x.data(), x.data() + x.size(), v );
+            s = s / 16.0 + v;
+        }
+    }
+
+    auto t2 = std::chrono::steady_clock::now();
+
+    std::cout << "          boost::charconv::from_chars<" << boost::core::type_name<T>() << ">: " << std::setw( 5 ) << ( t2 - t1 ) / 1ms << " ms (s=" << s << ")\n";
+}
+
+template<class T> static BOOST_NOINLINE void test_from_chars_interval( std::vector<std::string> const& data )
+{
+    auto t1 = std::chrono::steady_clock::now();
+
+    double s = 0;
+
+    for( int i = 0; i < K; ++i )
+    {
+        for( auto const& x: data )
+        {
+            T lo;
+            T hi;
+            boost::charconv::from_chars_interval( x.data(), x.data() + x.size(), lo, hi );
+            s = s / 16.0 + ( hi - lo );
+        }
+    }
+
+    auto t2 = std::chrono::steady_clock::now();
+
+    std::cout << " boost::charconv::from_chars_interval<" << boost::core::type_name<T>() << ">: " << std::setw( 5 ) << ( t2 - t1 ) / 1ms << " ms (s=" << s << ")\n";
+}
+
+// Parsing twice with the directed rounding modes is the usual way to get both bounds
+template<class T> static BOOST_NOINLINE void test_strtox_directed( std::vector<std::string> const& data )
+{
+    auto t1 = std::chrono::steady_clock::now();
+
+    double s = 0;
+
+    for( int i = 0; i < K; ++i )
+    {
+        for( auto const& x: data )
+        {
+            std::fesetround( FE_DOWNWARD );
+            T lo = strtox<T>( x.c_str(), nullptr );
+            std::fesetround( FE_UPWARD );
+            T hi = strtox<T>( x.c_str(), nullptr );
+            std::fesetround( FE_TONEAREST );
+            s = s / 16.0 + ( hi - lo );
+        }
+    }
+
+    auto t2 = std::chrono::steady_clock::now();
+
+    std::cout << "  std::strtox<" << boost::core::type_name<T>() << ">, downward and upward: " << std::setw( 5 ) << ( t2 - t1 ) / 1ms << " ms (s=" << s << ")\n";
+}
+
+template<class T> static void test()
+{
+    std::vector<std::string> const data = init_input_data<T>();
+
+    test_from_chars<T>( data );
+    test_from_chars_interval<T>( data );
+    test_strtox_directed<T>( data );
+}
+
+int main()
+{
+    std::cout << "---\n";
+
+    test<float>();
+    test<double>();
+
+    std::cout << "---\n\n";
+}
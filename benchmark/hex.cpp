@@ -0,0 +1,177 @@
+// Copyright 2023 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/charconv/hex.hpp>
+#include <boost/charconv.hpp>
+#include <boost/core/detail/splitmix64.hpp>
+#include <boost/config.hpp>
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <cstdio>
+#include <cstdint>
+
+constexpr unsigned N = 2'000'000;
+constexpr int K = 10;
+
+// SHA-256 digests
+constexpr std::size_t S = 32;
+
+static BOOST_NOINLINE std::vector<unsigned char> init_input_data()
+{
+    std::vector<unsigned char> data;
+    data.reserve( N * S );
+
+    boost::detail::splitmix64 rng;
+
+    for( unsigned i = 0; i < N * S; ++i )
+    {
+        data.push_back( static_cast<unsigned char>( rng() ) );
+    }
+
+    return data;
+}
+
+using namespace std::chrono_literals;
+
+static BOOST_NOINLINE void test_snprintf( std::vector<unsigned char> const& data )
+{
+    auto t1 = std::chrono::steady_clock::now();
+
+    std::size_t s = 0;
+
+    for( int i = 0; i < K; ++i )
+    {
+        for( std::size_t j = 0; j < N * S; j += S )
+        {
+            char buffer[ 2 * S + 1 ];
+            for( std::size_t k = 0; k < S; ++k )
+            {
+                std::snprintf( buffer + 2 * k, 3, "%02x", data[ j + k ] );
+            }
+            s += static_cast<unsigned char>( buffer[ j % ( 2 * S ) ] );
+        }
+    }
+
+    auto t2 = std::chrono::steady_clock::now();
+
+    std::cout << "                 snprintf: " << std::setw( 5 ) << ( t2 - t1 ) / 1ms << " ms (s=" << s << ")\n";
+}
+
+static BOOST_NOINLINE void test_to_chars( std::vector<unsigned char> const& data )
+{
+    auto t1 = std::chrono::steady_clock::now();
+
+    std::size_t s = 0;
+
+    for( int i = 0; i < K; ++i )
+    {
+        for( std::size_t j = 0; j < N * S; j += S )
+        {
+            char buffer[ 2 * S ];
+            for( std::size_t k = 0; k < S; ++k )
+            {
+                // to_chars does not write leading zeros
+                unsigned v = data[ j + k ] | 0x100u;
+                char tmp[ 4 ];
+                boost::charconv::to_chars( tmp, tmp + sizeof( tmp ), v, 16 );
+                buffer[ 2 * k ] = tmp[ 1 ];
+                buffer[ 2 * k + 1 ] = tmp[ 2 ];
+            }
+            s += static_cast<unsigned char>( buffer[ j % ( 2 * S ) ] );
+        }
+    }
+
+    auto t2 = std::chrono::steady_clock::now();
+
+    std::cout << "           to_chars, base 16: " << std::setw( 5 ) << ( t2 - t1 ) / 1ms << " ms (s=" << s << ")\n";
+}
+
+static BOOST_NOINLINE void test_to_chars_hex_bytes( std::vector<unsigned char> const& data )
+{
+    auto t1 = std::chrono::steady_clock::now();
+
+    std::size_t s = 0;
+
+    for( int i = 0; i < K; ++i )
+    {
+        for( std::size_t j = 0; j < N * S; j += S )
+        {
+            char buffer[ 2 * S ];
+            boost::charconv::to_chars_hex_bytes( buffer, buffer + sizeof( buffer ), data.data() + j, S );
+            s += static_cast<unsigned char>( buffer[ j % ( 2 * S ) ] );
+        }
+    }
+
+    auto t2 = std::chrono::steady_clock::now();
+
+    std::cout << "         to_chars_hex_bytes: " << std::setw( 5 ) << ( t2 - t1 ) / 1ms << " ms (s=" << s << ")\n";
+}
+
+static BOOST_NOINLINE void test_from_chars( std::vector<char> const& text )
+{
+    auto t1 = std::chrono::steady_clock::now();
+
+    std::size_t s = 0;
+
+    for( int i = 0; i < K; ++i )
+    {
+        for( std::size_t j = 0; j < N * S * 2; j += 2 * S )
+        {
+            unsigned char bytes[ S ];
+            for( std::size_t k = 0; k < S; ++k )
+            {
+                boost::charconv::from_chars( text.data() + j + 2 * k, text.data() + j + 2 * k + 2, bytes[ k ], 16 );
+            }
+            s += bytes[ j % S ];
+        }
+    }
+
+    auto t2 = std::chrono::steady_clock::now();
+
+    std::cout << "         from_chars, base 16: " << std::setw( 5 ) << ( t2 - t1 ) / 1ms << " ms (s=" << s << ")\n";
+}
+
+static BOOST_NOINLINE void test_from_chars_hex_bytes( std::vector<char> const& text )
+{
+    auto t1 = std::chrono::steady_clock::now();
+
+    std::size_t s = 0;
+
+    for( int i = 0; i < K; ++i )
+    {
+        for( std::size_t j = 0; j < N * S * 2; j += 2 * S )
+        {
+            unsigned char bytes[ S ];
+            boost::charconv::from_chars_hex_bytes( text.data() + j, text.data() + j + 2 * S, bytes, S );
+            s += bytes[ j % S ];
+        }
+    }
+
+    auto t2 = std::chrono::steady_clock::now();
+
+    std::cout << "       from_chars_hex_bytes: " << std::setw( 5 ) << ( t2 - t1 ) / 1ms << " ms (s=" << s << ")\n";
+}
+
+int main()
+{
+    std::cout << "---\n";
+
+    std::vector<unsigned char> const data = init_input_data();
+
+    std::vector<char> text( data.size() * 2 );
+    boost::charconv::to_chars_hex_bytes( text.data(), text.data() + text.size(), data.data(), data.size() );
+
+    test_snprintf( data );
+    test_to_chars( data );
+    test_to_chars_hex_bytes( data );
+
+    std::cout << '\n';
+
+    test_from_chars( text );
+    test_from_chars_hex_bytes( text );
+
+    std::cout << "---\n\n";
+}
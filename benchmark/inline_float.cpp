@@ -0,0 +1,134 @@
+// Copyright 2023 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#define BOOST_CHARCONV_INLINE_FLOAT
+
+#include <boost/charconv.hpp>
+#include <boost/core/type_name.hpp>
+#include <boost/core/detail/splitmix64.hpp>
+#include <boost/config.hpp>
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+
+constexpr unsigned N = 2'000'000;
+constexpr int K = 10;
+
+// Short numbers such as prices or coordinates, where the cost of the call is a large part of the conversion
+template<class T> static BOOST_NOINLINE std::vector<T> init_input_data()
+{
+    std::vector<T> data;
+    data.reserve( N );
+
+    boost::detail::splitmix64 rng;
+
+    for( unsigned i = 0; i < N; ++i )
+    {
+        data.push_back( static_cast<T>( static_cast<double>( rng() % 100000 ) / 100 ) );
+    }
+
+    return data;
+}
+
+template<class T> static BOOST_NOINLINE std::string init_input_text( std::vector<T> const& data )
+{
+    std::string text;
+
+    for( auto x: data )
+    {
+        char buffer[ 64 ];
+        auto r = boost::charconv::to_chars( buffer, buffer + sizeof( buffer ), x );
+        text.append( buffer, r.ptr );
+        text += ' ';
+    }
+
+    return text;
+}
+
+// Without BOOST_CHARCONV_INLINE_FLOAT the float overloads are calls into the library; these wrappers keep that call boundary
+template<class T> static BOOST_NOINLINE boost::charconv::to_chars_result out_of_line_to_chars( char* first, char* last, T value, boost::charconv::chars_format fmt, int precision ) noexcept
+{
+    return boost::charconv::to_chars( first, last, value, fmt, precision );
+}
+
+template<class T> static BOOST_NOINLINE boost::charconv::from_chars_result out_of_line_from_chars( char const* first, char const* last, T& value, boost::charconv::chars_format fmt ) noexcept
+{
+    return boost::charconv::from_chars( first, last, value, fmt );
+}
+
+using namespace std::chrono_literals;
+
+template<class T, bool Inline> static BOOST_NOINLINE void test_to_chars( std::vector<T> const& data )
+{
+    auto t1 = std::chrono::steady_clock::now();
+
+    std::size_t s = 0;
+
+    for( int i = 0; i < K; ++i )
+    {
+        char buffer[ 64 ];
+
+        for( auto x: data )
+        {
+            auto r = Inline? boost::charconv::to_chars( buffer, buffer + sizeof( buffer ), x ):
+                             out_of_line_to_chars( buffer, buffer + sizeof( buffer ), x, boost::charconv::chars_format::general, -1 );
+            s += static_cast<std::size_t>( r.ptr - buffer );
+            s += static_cast<unsigned char>( buffer[0] );
+        }
+    }
+
+    auto t2 = std::chrono::steady_clock::now();
+
+    std::cout << "  boost::charconv::to_chars<" << boost::core::type_name<T>() << ">, " << ( Inline? "    inline": "out of line" ) << ": " << std::setw( 5 ) << ( t2 - t1 ) / 1ms << " ms (s=" << s << ")\n";
+}
+
+template<class T, bool Inline> static BOOST_NOINLINE void test_from_chars( std::string const& text )
+{
+    auto t1 = std::chrono::steady_clock::now();
+
+    double s = 0;
+
+    for( int i = 0; i < K; ++i )
+    {
+        char const* first = text.data();
+        char const* last = text.data() + text.size();
+
+        while( first != last )
+        {
+            T x{};
+            auto r = Inline? boost::charconv::from_chars( first, last, x ):
+                             out_of_line_from_chars( first, last, x, boost::charconv::chars_format::general );
+            first = r.ptr + 1;
+            s = s / 16.0 + x;
+        }
+    }
+
+    auto t2 = std::chrono::steady_clock::now();
+
+    std::cout << "boost::charconv::from_chars<" << boost::core::type_name<T>() << ">, " << ( Inline? "    inline": "out of line" ) << ": " << std::setw( 5 ) << ( t2 - t1 ) / 1ms << " ms (s=" << s << ")\n";
+}
+
+template<class T> static void test()
+{
+    std::vector<T> const data = init_input_data<T>();
+    std::string const text = init_input_text( data );
+
+    test_to_chars<T, false>( data );
+    test_to_chars<T, true>( data );
+
+    test_from_chars<T, false>( text );
+    test_from_chars<T, true>( text );
+}
+
+int main()
+{
+    std::cout << "---\n";
+
+    test<float>();
+    test<double>();
+
+    std::cout << "---\n\n";
+}
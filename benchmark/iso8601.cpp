@@ -0,0 +1,216 @@
+// Copyright 2023 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/charconv/iso8601.hpp>
+#include <boost/core/detail/splitmix64.hpp>
+#include <boost/config.hpp>
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <ctime>
+#include <cstdio>
+#include <cstdint>
+
+#if defined(__has_include)
+#  if __has_include(<version>)
+#    include <version>
+#  endif
+#endif
+
+#if defined(__cpp_lib_format) && __cpp_lib_format >= 201907L
+#  include <format>
+#  define BENCHMARK_HAS_STD_FORMAT
+#endif
+
+constexpr unsigned N = 2'000'000;
+constexpr int K = 10;
+
+// Nanosecond timestamps from 2000 to 2040
+static BOOST_NOINLINE std::vector<std::int64_t> init_input_data()
+{
+    std::vector<std::int64_t> data;
+    data.reserve( N );
+
+    boost::detail::splitmix64 rng;
+
+    for( unsigned i = 0; i < N; ++i )
+    {
+        data.push_back( 946684800'000000000ll + static_cast<std::int64_t>( rng() % 1262304000'000000000ull ) );
+    }
+
+    return data;
+}
+
+static BOOST_NOINLINE std::vector<std::string> init_text_data( std::vector<std::int64_t> const& data )
+{
+    std::vector<std::string> text;
+    text.reserve( N );
+
+    for( auto x: data )
+    {
+        char buffer[ 64 ];
+        auto r = boost::charconv::to_chars_iso8601( buffer, buffer + sizeof( buffer ), x );
+        text.emplace_back( buffer, r.ptr );
+    }
+
+    return text;
+}
+
+using namespace std::chrono_literals;
+
+static BOOST_NOINLINE void test_strftime( std::vector<std::int64_t> const& data )
+{
+    auto t1 = std::chrono::steady_clock::now();
+
+    std::size_t s = 0;
+
+    for( int i = 0; i < K; ++i )
+    {
+        for( auto x: data )
+        {
+            std::time_t t = static_cast<std::time_t>( x / 1'000'000'000 );
+            std::tm tm;
+
+#ifdef _WIN32
+            gmtime_s( &tm, &t );
+#else
+            gmtime_r( &t, &tm );
+#endif
+
+            char buffer[ 64 ];
+            std::size_t n = std::strftime( buffer, sizeof( buffer ), "%Y-%m-%dT%H:%M:%S", &tm );
+            n += static_cast<std::size_t>( std::snprintf( buffer + n, sizeof( buffer ) - n, ".%09dZ", static_cast<int>( x % 1'000'000'000 ) ) );
+            s += n;
+        }
+    }
+
+    auto t2 = std::chrono::steady_clock::now();
+
+    std::cout << "         strftime + snprintf: " << std::setw( 5 ) << ( t2 - t1 ) / 1ms << " ms (s=" << s << ")\n";
+}
+
+#ifdef BENCHMARK_HAS_STD_FORMAT
+
+static BOOST_NOINLINE void test_std_format( std::vector<std::int64_t> const& data )
+{
+    auto t1 = std::chrono::steady_clock::now();
+
+    std::size_t s = 0;
+
+    for( int i = 0; i < K; ++i )
+    {
+        for( auto x: data )
+        {
+            std::chrono::sys_time<std::chrono::nanoseconds> tp{ std::chrono::nanoseconds( x ) };
+
+            char buffer[ 64 ];
+            auto r = std::format_to_n( buffer, sizeof( buffer ), "{:%FT%TZ}", tp );
+            s += static_cast<std::size_t>( r.size );
+        }
+    }
+
+    auto t2 = std::chrono::steady_clock::now();
+
+    std::cout << "      std::format_to_n (%FT%T): " << std::setw( 5 ) << ( t2 - t1 ) / 1ms << " ms (s=" << s << ")\n";
+}
+
+#endif
+
+static BOOST_NOINLINE void test_to_chars_iso8601( std::vector<std::int64_t> const& data )
+{
+    auto t1 = std::chrono::steady_clock::now();
+
+    std::size_t s = 0;
+
+    for( int i = 0; i < K; ++i )
+    {
+        for( auto x: data )
+        {
+            char buffer[ 64 ];
+            auto r = boost::charconv::to_chars_iso8601( buffer, buffer + sizeof( buffer ), x );
+            s += static_cast<std::size_t>( r.ptr - buffer );
+        }
+    }
+
+    auto t2 = std::chrono::steady_clock::now();
+
+    std::cout << "           to_chars_iso8601: " << std::setw( 5 ) << ( t2 - t1 ) / 1ms << " ms (s=" << s << ")\n";
+}
+
+static BOOST_NOINLINE void test_sscanf( std::vector<std::string> const& text )
+{
+    auto t1 = std::chrono::steady_clock::now();
+
+    std::int64_t s = 0;
+
+    for( int i = 0; i < K; ++i )
+    {
+        for( auto const& x: text )
+        {
+            std::tm tm {};
+            int ns = 0;
+            std::sscanf( x.c_str(), "%d-%d-%dT%d:%d:%d.%dZ", &tm.tm_year, &tm.tm_mon, &tm.tm_mday, &tm.tm_hour, &tm.tm_min, &tm.tm_sec, &ns );
+            tm.tm_year -= 1900;
+            tm.tm_mon -= 1;
+
+#ifdef _WIN32
+            std::int64_t t = _mkgmtime( &tm );
+#else
+            std::int64_t t = timegm( &tm );
+#endif
+
+            s += t * 1'000'000'000 + ns;
+        }
+    }
+
+    auto t2 = std::chrono::steady_clock::now();
+
+    std::cout << "           sscanf + timegm: " << std::setw( 5 ) << ( t2 - t1 ) / 1ms << " ms (s=" << s << ")\n";
+}
+
+static BOOST_NOINLINE void test_from_chars_iso8601( std::vector<std::string> const& text )
+{
+    auto t1 = std::chrono::steady_clock::now();
+
+    std::int64_t s = 0;
+
+    for( int i = 0; i < K; ++i )
+    {
+        for( auto const& x: text )
+        {
+            std::int64_t v = 0;
+            boost::charconv::from_chars_iso8601( x.data(), x.data() + x.size(), v );
+            s += v;
+        }
+    }
+
+    auto t2 = std::chrono::steady_clock::now();
+
+    std::cout << "         from_chars_iso8601: " << std::setw( 5 ) << ( t2 - t1 ) / 1ms << " ms (s=" << s << ")\n";
+}
+
+int main()
+{
+    std::cout << "---\n";
+
+    std::vector<std::int64_t> const data = init_input_data();
+    std::vector<std::string> const text = init_text_data( data );
+
+    test_strftime( data );
+
+#ifdef BENCHMARK_HAS_STD_FORMAT
+    test_std_format( data );
+#endif
+
+    test_to_chars_iso8601( data );
+
+    std::cout << '\n';
+
+    test_sscanf( text );
+    test_from_chars_iso8601( text );
+
+    std::cout << "---\n\n";
+}
@@ -0,0 +1,193 @@
+// Copyright 2023 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/charconv/lazy_number.hpp>
+#include <boost/charconv.hpp>
+#include <boost/core/detail/splitmix64.hpp>
+#include <boost/config.hpp>
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <cstring>
+
+constexpr unsigned N = 2'000'000;
+constexpr int K = 10;
+
+// A comma separated row of prices, quantities and measurements, of which every 100th field is used
+static BOOST_NOINLINE std::string init_input_data()
+{
+    std::string data;
+    boost::detail::splitmix64 rng;
+
+    for( unsigned i = 0; i < N; ++i )
+    {
+        char buffer[ 64 ];
+        boost::charconv::to_chars_result r;
+
+        switch( i % 3 )
+        {
+        case 0:
+            r = boost::charconv::to_chars( buffer, buffer + sizeof( buffer ), static_cast<double>( rng() % 10000000 ) / 100, boost::charconv::chars_format::fixed, 2 );
+            break;
+
+        case 1:
+            r = boost::charconv::to_chars( buffer, buffer + sizeof( buffer ), rng() % 100000 );
+            break;
+
+        default:
+            r = boost::charconv::to_chars( buffer, buffer + sizeof( buffer ), static_cast<double>( rng() >> 11 ) / static_cast<double>( rng() % 1000000 + 1 ) );
+            break;
+        }
+
+        data.append( buffer, r.ptr );
+        data += ',';
+    }
+
+    return data;
+}
+
+using namespace std::chrono_literals;
+
+static BOOST_NOINLINE void test_eager( std::string const& data, std::vector<double>& values )
+{
+    auto t1 = std::chrono::steady_clock::now();
+
+    double s = 0;
+
+    for( int i = 0; i < K; ++i )
+    {
+        values.clear();
+
+        char const* first = data.data();
+        char const* last = data.data() + data.size();
+
+        while( first != last )
+        {
+            double v;
+            first = boost::charconv::from_chars( first, last, v ).ptr + 1;
+            values.push_back( v );
+        }
+
+        for( std::size_t j = 0; j < values.size(); j += 100 )
+        {
+            s += values[ j ];
+        }
+    }
+
+    auto t2 = std::chrono::steady_clock::now();
+
+    std::cout << std::setw( 40 ) << "from_chars every field" << ": " << std::setw( 5 ) << ( t2 - t1 ) / 1ms << " ms (s=" << s << ")\n";
+}
+
+static BOOST_NOINLINE void test_lazy( std::string const& data, std::vector<boost::charconv::lazy_number>& values )
+{
+    auto t1 = std::chrono::steady_clock::now();
+
+    double s = 0;
+
+    for( int i = 0; i < K; ++i )
+    {
+        values.clear();
+
+        char const* first = data.data();
+        char const* last = data.data() + data.size();
+
+        while( first != last )
+        {
+            boost::charconv::lazy_number v;
+            first = boost::charconv::from_chars( first, last, v ).ptr + 1;
+            values.push_back( v );
+        }
+
+        for( std::size_t j = 0; j < values.size(); j += 100 )
+        {
+            double v = 0;
+            values[ j ].get( v );
+            s += v;
+        }
+    }
+
+    auto t2 = std::chrono::steady_clock::now();
+
+    std::cout << std::setw( 40 ) << "lazy_number, 1% converted" << ": " << std::setw( 5 ) << ( t2 - t1 ) / 1ms << " ms (s=" << s << ")\n";
+}
+
+static BOOST_NOINLINE void test_write_eager( std::vector<double> const& values )
+{
+    std::string out( values.size() * 32, '\0' );
+
+    auto t1 = std::chrono::steady_clock::now();
+
+    std::size_t s = 0;
+
+    for( int i = 0; i < K; ++i )
+    {
+        char* first = &out[ 0 ];
+        char* last = first + out.size();
+
+        for( auto const& v: values )
+        {
+            first = boost::charconv::to_chars( first, last, v ).ptr;
+            *first++ = ',';
+        }
+
+        s += static_cast<std::size_t>( first - out.data() );
+    }
+
+    auto t2 = std::chrono::steady_clock::now();
+
+    std::cout << std::setw( 40 ) << "to_chars every value" << ": " << std::setw( 5 ) << ( t2 - t1 ) / 1ms << " ms (s=" << s << ")\n";
+}
+
+static BOOST_NOINLINE void test_write_lazy( std::vector<boost::charconv::lazy_number> const& values )
+{
+    std::string out( values.size() * 32, '\0' );
+
+    auto t1 = std::chrono::steady_clock::now();
+
+    std::size_t s = 0;
+
+    for( int i = 0; i < K; ++i )
+    {
+        char* first = &out[ 0 ];
+        char* last = first + out.size();
+
+        for( auto const& v: values )
+        {
+            first = boost::charconv::to_chars( first, last, v ).ptr;
+            *first++ = ',';
+        }
+
+        s += static_cast<std::size_t>( first - out.data() );
+    }
+
+    auto t2 = std::chrono::steady_clock::now();
+
+    std::cout << std::setw( 40 ) << "lazy_number, original text" << ": " << std::setw( 5 ) << ( t2 - t1 ) / 1ms << " ms (s=" << s << ")\n";
+}
+
+int main()
+{
+    std::string data = init_input_data();
+
+    std::vector<double> eager;
+    std::vector<boost::charconv::lazy_number> lazy;
+    eager.reserve( N );
+    lazy.reserve( N );
+
+    std::cout << "---\n";
+
+    test_eager( data, eager );
+    test_lazy( data, lazy );
+
+    std::cout << '\n';
+
+    test_write_eager( eager );
+    test_write_lazy( lazy );
+
+    std::cout << "---\n\n";
+}
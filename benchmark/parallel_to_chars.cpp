@@ -0,0 +1,126 @@
+// Copyright 2023 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/charconv/parallel_to_chars.hpp>
+#include <boost/charconv.hpp>
+#include <boost/core/type_name.hpp>
+#include <boost/core/detail/splitmix64.hpp>
+#include <boost/config.hpp>
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include <thread>
+#include <vector>
+#include <cstring>
+#include <cmath>
+
+constexpr unsigned N = 2'000'000;
+constexpr int K = 10;
+
+// A checkpoint of model weights or simulation state
+template<class T> static BOOST_NOINLINE std::vector<T> init_input_data()
+{
+    std::vector<T> data;
+    data.reserve( N );
+
+    boost::detail::splitmix64 rng;
+
+    while( data.size() < N )
+    {
+        std::uint64_t x = rng();
+        T v;
+        std::memcpy( &v, &x, sizeof( v ) );
+
+        if( std::isfinite( v ) )
+        {
+            data.push_back( v );
+        }
+    }
+
+    return data;
+}
+
+using namespace std::chrono_literals;
+
+template<class T> static BOOST_NOINLINE void test_serial( std::vector<T> const& data, std::vector<char>& out )
+{
+    auto t1 = std::chrono::steady_clock::now();
+
+    std::size_t s = 0;
+
+    for( int i = 0; i < K; ++i )
+    {
+        char* first = out.data();
+        char* last = out.data() + out.size();
+
+        for( auto x: data )
+        {
+            first = boost::charconv::to_chars( first, last, x ).ptr;
+            *first++ = '\n';
+        }
+
+        s += static_cast<std::size_t>( first - out.data() );
+    }
+
+    auto t2 = std::chrono::steady_clock::now();
+
+    std::cout << "          to_chars<" << boost::core::type_name<T>() << ">, serial: " << std::setw( 5 ) << ( t2 - t1 ) / 1ms << " ms (s=" << s << ")\n";
+}
+
+template<class T> static BOOST_NOINLINE void test_size( std::vector<T> const& data )
+{
+    auto t1 = std::chrono::steady_clock::now();
+
+    std::size_t s = 0;
+
+    for( int i = 0; i < K; ++i )
+    {
+        s += boost::charconv::parallel_to_chars_size( data.data(), data.size() );
+    }
+
+    auto t2 = std::chrono::steady_clock::now();
+
+    std::cout << "parallel_to_chars_size<" << boost::core::type_name<T>() << ">        : " << std::setw( 5 ) << ( t2 - t1 ) / 1ms << " ms (s=" << s << ")\n";
+}
+
+template<class T> static BOOST_NOINLINE void test_parallel( std::vector<T> const& data, std::vector<char>& out, unsigned threads )
+{
+    auto t1 = std::chrono::steady_clock::now();
+
+    std::size_t s = 0;
+
+    for( int i = 0; i < K; ++i )
+    {
+        auto r = boost::charconv::parallel_to_chars( out.data(), out.data() + out.size(), data.data(), data.size(), '\n', boost::charconv::chars_format::general, threads );
+        s += static_cast<std::size_t>( r.ptr - out.data() );
+    }
+
+    auto t2 = std::chrono::steady_clock::now();
+
+    std::cout << "parallel_to_chars<" << boost::core::type_name<T>() << ">, " << std::setw( 2 ) << threads << " threads: " << std::setw( 5 ) << ( t2 - t1 ) / 1ms << " ms (s=" << s << ")\n";
+}
+
+template<class T> static void test()
+{
+    std::vector<T> const data = init_input_data<T>();
+    std::vector<char> out( data.size() * ( boost::charconv::limits<T>::max_chars10 + 1 ) );
+
+    test_serial( data, out );
+    test_size( data );
+
+    for( unsigned threads = 1; threads <= std::thread::hardware_concurrency(); threads *= 2 )
+    {
+        test_parallel( data, out, threads );
+    }
+}
+
+int main()
+{
+    std::cout << "---\n";
+
+    test<float>();
+    test<double>();
+
+    std::cout << "---\n\n";
+}
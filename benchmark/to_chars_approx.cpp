@@ -0,0 +1,126 @@
+// Copyright 2023 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/charconv/to_chars.hpp>
+#include <boost/core/type_name.hpp>
+#include <boost/core/detail/splitmix64.hpp>
+#include <boost/config.hpp>
+#include <chrono>
+#include <cstdio>
+#include <iostream>
+#include <iomanip>
+#include <vector>
+
+constexpr unsigned N = 2'000'000;
+constexpr int K = 10;
+
+// Metrics such as latencies and rates, spread over a few orders of magnitude
+template<class T> static BOOST_NOINLINE std::vector<T> init_input_data()
+{
+    std::vector<T> data;
+    data.reserve( N );
+
+    boost::detail::splitmix64 rng;
+
+    for( unsigned i = 0; i < N; ++i )
+    {
+        double x = static_cast<double>( rng() >> 11 ) / static_cast<double>( 1ull << 53 );
+        x = std::ldexp( x, static_cast<int>( rng() % 40 ) - 10 );
+        data.push_back( static_cast<T>( x ) );
+    }
+
+    return data;
+}
+
+using namespace std::chrono_literals;
+
+template<class T> static BOOST_NOINLINE void test_snprintf( std::vector<T> const& data, int digits )
+{
+    auto t1 = std::chrono::steady_clock::now();
+
+    std::size_t s = 0;
+
+    for( int i = 0; i < K; ++i )
+    {
+        char buffer[ 32 ];
+
+        for( auto x: data )
+        {
+            s += static_cast<std::size_t>( std::snprintf( buffer, sizeof( buffer ), "%.*g", digits, static_cast<double>( x ) ) );
+            s += static_cast<unsigned char>( buffer[0] );
+        }
+    }
+
+    auto t2 = std::chrono::steady_clock::now();
+
+    std::cout << "                  std::snprintf<" << boost::core::type_name<T>() << ">, " << digits << ": " << std::setw( 5 ) << ( t2 - t1 ) / 1ms << " ms (s=" << s << ")\n";
+}
+
+template<class T> static BOOST_NOINLINE void test_to_chars( std::vector<T> const& data, int digits )
+{
+    auto t1 = std::chrono::steady_clock::now();
+
+    std::size_t s = 0;
+
+    for( int i = 0; i < K; ++i )
+    {
+        char buffer[ 32 ];
+
+        for( auto x: data )
+        {
+            auto r = boost::charconv::to_chars( buffer, buffer + sizeof( buffer ), x, boost::charconv::chars_format::scientific, digits - 1 );
+            s += static_cast<std::size_t>( r.ptr - buffer );
+            s += static_cast<unsigned char>( buffer[0] );
+        }
+    }
+
+    auto t2 = std::chrono::steady_clock::now();
+
+    std::cout << "      boost::charconv::to_chars<" << boost::core::type_name<T>() << ">, " << digits << ": " << std::setw( 5 ) << ( t2 - t1 ) / 1ms << " ms (s=" << s << ")\n";
+}
+
+template<class T> static BOOST_NOINLINE void test_to_chars_approx( std::vector<T> const& data, int digits )
+{
+    auto t1 = std::chrono::steady_clock::now();
+
+    std::size_t s = 0;
+
+    for( int i = 0; i < K; ++i )
+    {
+        char buffer[ 32 ];
+
+        for( auto x: data )
+        {
+            auto r = boost::charconv::to_chars_approx( buffer, buffer + sizeof( buffer ), x, digits );
+            s += static_cast<std::size_t>( r.ptr - buffer );
+            s += static_cast<unsigned char>( buffer[0] );
+        }
+    }
+
+    auto t2 = std::chrono::steady_clock::now();
+
+    std::cout << "boost::charconv::to_chars_approx<" << boost::core::type_name<T>() << ">, " << digits << ": " << std::setw( 5 ) << ( t2 - t1 ) / 1ms << " ms (s=" << s << ")\n";
+}
+
+template<class T> static void test( int digits )
+{
+    std::vector<T> const data = init_input_data<T>();
+
+    test_snprintf( data, digits );
+    test_to_chars( data, digits );
+    test_to_chars_approx( data, digits );
+}
+
+int main()
+{
+    std::cout << "---\n";
+
+    test<float>( 4 );
+    test<float>( 7 );
+    test<double>( 4 );
+    test<double>( 7 );
+    test<double>( 15 );
+
+    std::cout << "---\n\n";
+}
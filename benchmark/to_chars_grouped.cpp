@@ -0,0 +1,175 @@
+// Copyright 2023 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/charconv/grouping.hpp>
+#include <boost/core/type_name.hpp>
+#include <boost/core/detail/splitmix64.hpp>
+#include <boost/config.hpp>
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include <sstream>
+#include <locale>
+#include <vector>
+#include <cstdio>
+#include <cstdint>
+
+constexpr unsigned N = 2'000'000;
+constexpr int K = 10;
+
+// Amounts in a report, up to ten million with cents
+template<class T> static BOOST_NOINLINE std::vector<T> init_input_data()
+{
+    std::vector<T> data;
+    data.reserve( N );
+
+    boost::detail::splitmix64 rng;
+
+    for( unsigned i = 0; i < N; ++i )
+    {
+        std::uint64_t x = rng() % 1'000'000'000;
+
+        if constexpr( std::is_integral_v<T> )
+        {
+            data.push_back( static_cast<T>( x ) );
+        }
+        else
+        {
+            data.push_back( static_cast<T>( x ) / 100 );
+        }
+    }
+
+    return data;
+}
+
+struct thousands: std::numpunct<char>
+{
+    char do_thousands_sep() const override { return ','; }
+    std::string do_grouping() const override { return "\3"; }
+};
+
+using namespace std::chrono_literals;
+
+template<class T> static BOOST_NOINLINE void test_ostringstream( std::vector<T> const& data )
+{
+    std::ostringstream os;
+    os.imbue( std::locale( std::locale::classic(), new thousands ) );
+    os << std::fixed << std::setprecision( 2 );
+
+    auto t1 = std::chrono::steady_clock::now();
+
+    std::size_t s = 0;
+
+    for( int i = 0; i < K; ++i )
+    {
+        for( auto x: data )
+        {
+            os.str( std::string() );
+            os << x;
+            s += os.str().size();
+        }
+    }
+
+    auto t2 = std::chrono::steady_clock::now();
+
+    std::cout << "       std::ostringstream<" << boost::core::type_name<T>() << ">: " << std::setw( 5 ) << ( t2 - t1 ) / 1ms << " ms (s=" << s << ")\n";
+}
+
+template<class T> static BOOST_NOINLINE void test_snprintf( std::vector<T> const& data )
+{
+    auto t1 = std::chrono::steady_clock::now();
+
+    std::size_t s = 0;
+
+    for( int i = 0; i < K; ++i )
+    {
+        for( auto x: data )
+        {
+            char buffer[ 64 ];
+            int n;
+
+            if constexpr( std::is_integral_v<T> )
+            {
+                n = std::snprintf( buffer, sizeof( buffer ), "%lld", static_cast<long long>( x ) );
+            }
+            else
+            {
+                n = std::snprintf( buffer, sizeof( buffer ), "%.2f", static_cast<double>( x ) );
+            }
+
+            // Separators inserted afterwards
+            char grouped[ 64 ];
+            int integer_digits = n;
+            for( int j = 0; j < n; ++j )
+            {
+                if( buffer[ j ] == '.' ) { integer_digits = j; break; }
+            }
+
+            int k = 0;
+            for( int j = 0; j < n; ++j )
+            {
+                if( j != 0 && j < integer_digits && ( integer_digits - j ) % 3 == 0 ) grouped[ k++ ] = ',';
+                grouped[ k++ ] = buffer[ j ];
+            }
+
+            s += static_cast<std::size_t>( k );
+        }
+    }
+
+    auto t2 = std::chrono::steady_clock::now();
+
+    std::cout << "snprintf + separators<" << boost::core::type_name<T>() << ">: " << std::setw( 5 ) << ( t2 - t1 ) / 1ms << " ms (s=" << s << ")\n";
+}
+
+template<class T> static BOOST_NOINLINE void test_to_chars_grouped( std::vector<T> const& data )
+{
+    auto t1 = std::chrono::steady_clock::now();
+
+    std::size_t s = 0;
+
+    for( int i = 0; i < K; ++i )
+    {
+        for( auto x: data )
+        {
+            char buffer[ 64 ];
+            boost::charconv::to_chars_result r;
+
+            if constexpr( std::is_integral_v<T> )
+            {
+                r = boost::charconv::to_chars_grouped( buffer, buffer + sizeof( buffer ), x );
+            }
+            else
+            {
+                r = boost::charconv::to_chars_grouped( buffer, buffer + sizeof( buffer ), x, 2 );
+            }
+
+            s += static_cast<std::size_t>( r.ptr - buffer );
+        }
+    }
+
+    auto t2 = std::chrono::steady_clock::now();
+
+    std::cout << "     to_chars_grouped<" << boost::core::type_name<T>() << ">: " << std::setw( 5 ) << ( t2 - t1 ) / 1ms << " ms (s=" << s << ")\n";
+}
+
+template<class T> static void test()
+{
+    std::vector<T> const data = init_input_data<T>();
+
+    test_ostringstream( data );
+    test_snprintf( data );
+    test_to_chars_grouped( data );
+
+    std::cout << '\n';
+}
+
+int main()
+{
+    std::cout << "---\n";
+
+    test<long long>();
+    test<double>();
+
+    std::cout << "---\n\n";
+}
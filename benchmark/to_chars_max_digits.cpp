@@ -0,0 +1,119 @@
+// Copyright 2023 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/charconv.hpp>
+#include <boost/core/type_name.hpp>
+#include <boost/core/detail/splitmix64.hpp>
+#include <boost/config.hpp>
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <cstdint>
+
+constexpr unsigned N = 2'000'000;
+constexpr int K = 10;
+constexpr int D = 6;
+
+// Coordinates of a drawing, most of which have 15 to 17 shortest digits
+template<class T> static BOOST_NOINLINE std::vector<T> init_input_data()
+{
+    std::vector<T> data;
+    data.reserve( N );
+
+    boost::detail::splitmix64 rng;
+
+    for( unsigned i = 0; i < N; ++i )
+    {
+        data.push_back( static_cast<T>( static_cast<double>( rng() >> 11 ) / ( 1ull << 53 ) * 2000 - 1000 ) );
+    }
+
+    return data;
+}
+
+using namespace std::chrono_literals;
+
+template<class T> static BOOST_NOINLINE void test_shortest( std::vector<T> const& data )
+{
+    auto t1 = std::chrono::steady_clock::now();
+
+    std::size_t s = 0;
+
+    for( int i = 0; i < K; ++i )
+    {
+        for( auto x: data )
+        {
+            char buffer[ 64 ];
+            auto r = boost::charconv::to_chars( buffer, buffer + sizeof( buffer ), x );
+            s += static_cast<std::size_t>( r.ptr - buffer );
+        }
+    }
+
+    auto t2 = std::chrono::steady_clock::now();
+
+    std::cout << "    to_chars<" << boost::core::type_name<T>() << ">, shortest: " << std::setw( 5 ) << ( t2 - t1 ) / 1ms << " ms (s=" << s << ")\n";
+}
+
+template<class T> static BOOST_NOINLINE void test_precision( std::vector<T> const& data )
+{
+    auto t1 = std::chrono::steady_clock::now();
+
+    std::size_t s = 0;
+
+    for( int i = 0; i < K; ++i )
+    {
+        for( auto x: data )
+        {
+            char buffer[ 64 ];
+            auto r = boost::charconv::to_chars( buffer, buffer + sizeof( buffer ), x, boost::charconv::chars_format::general, D - 1 );
+            s += static_cast<std::size_t>( r.ptr - buffer );
+        }
+    }
+
+    auto t2 = std::chrono::steady_clock::now();
+
+    std::cout << "   to_chars<" << boost::core::type_name<T>() << ">, precision: " << std::setw( 5 ) << ( t2 - t1 ) / 1ms << " ms (s=" << s << ")\n";
+}
+
+template<class T> static BOOST_NOINLINE void test_max_digits( std::vector<T> const& data )
+{
+    auto t1 = std::chrono::steady_clock::now();
+
+    std::size_t s = 0;
+
+    for( int i = 0; i < K; ++i )
+    {
+        for( auto x: data )
+        {
+            char buffer[ 64 ];
+            auto r = boost::charconv::to_chars_max_digits( buffer, buffer + sizeof( buffer ), x, D );
+            s += static_cast<std::size_t>( r.ptr - buffer );
+        }
+    }
+
+    auto t2 = std::chrono::steady_clock::now();
+
+    std::cout << "to_chars_max_digits<" << boost::core::type_name<T>() << ">: " << std::setw( 5 ) << ( t2 - t1 ) / 1ms << " ms (s=" << s << ")\n";
+}
+
+template<class T> static void test()
+{
+    std::vector<T> const data = init_input_data<T>();
+
+    test_shortest( data );
+    test_precision( data );
+    test_max_digits( data );
+
+    std::cout << '\n';
+}
+
+int main()
+{
+    std::cout << "---\n";
+
+    test<float>();
+    test<double>();
+
+    std::cout << "---\n\n";
+}
@@ -0,0 +1,204 @@
+// Copyright 2023 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/charconv/sortable.hpp>
+#include <boost/charconv.hpp>
+#include <boost/core/type_name.hpp>
+#include <boost/core/detail/splitmix64.hpp>
+#include <boost/config.hpp>
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <cstring>
+#include <cstdlib>
+
+constexpr unsigned N = 2'000'000;
+constexpr int K = 10;
+
+template<class T> static BOOST_NOINLINE std::vector<T> init_input_data()
+{
+    std::vector<T> data;
+    data.reserve( N );
+
+    boost::detail::splitmix64 rng;
+
+    for( unsigned i = 0; i < N; ++i )
+    {
+        std::uint64_t x = rng();
+
+        if constexpr( std::is_integral<T>::value )
+        {
+            // Mix short and long values
+            data.push_back( static_cast<T>( x >> ( x % 48 ) ) );
+        }
+        else
+        {
+            double d = static_cast<double>( x >> 11 ) / static_cast<double>( 1ull << 53 );
+            d = std::ldexp( d, static_cast<int>( rng() % 200 ) - 100 );
+            data.push_back( static_cast<T>( ( x & 1 )? -d: d ) );
+        }
+    }
+
+    return data;
+}
+
+// The normalization pass this encoding replaces: format with to_chars,
+// then rewrite the text into the same key as to_chars_sortable
+static char* transform_to_key( const char* first, const char* last, char* out )
+{
+    bool negative = false;
+    if( *first == '-' )
+    {
+        negative = true;
+        ++first;
+    }
+
+    char digits[ 32 ];
+    int n = 0;
+    int point = -1;
+    int exponent = 0;
+
+    for( ; first != last; ++first )
+    {
+        if( *first == '.' ) point = n;
+        else if( *first == 'e' )
+        {
+            exponent = std::atoi( std::string( first + 1, last ).c_str() );
+            break;
+        }
+        else digits[ n++ ] = *first;
+    }
+
+    if( point < 0 ) point = n;
+
+    // Strip leading and trailing zeros
+    int start = 0;
+    while( start < n && digits[ start ] == '0' ) { ++start; --point; }
+    while( n > start && digits[ n - 1 ] == '0' ) --n;
+
+    if( start == n )
+    {
+        *out++ = 'C';
+        return out;
+    }
+
+    const int x = point + exponent;
+    const unsigned e = negative? 499 - x: x + 500;
+
+    *out++ = negative? 'B': 'D';
+    *out++ = static_cast<char>( '0' + e / 100 );
+    *out++ = static_cast<char>( '0' + e / 10 % 10 );
+    *out++ = static_cast<char>( '0' + e % 10 );
+
+    for( int i = start; i < n; ++i )
+    {
+        *out++ = negative? static_cast<char>( '9' - ( digits[ i ] - '0' ) ): digits[ i ];
+    }
+
+    *out++ = negative? ':': '.';
+    return out;
+}
+
+using namespace std::chrono_literals;
+
+template<class T> static BOOST_NOINLINE void test_to_chars_transform( std::vector<T> const& data )
+{
+    auto t1 = std::chrono::steady_clock::now();
+
+    std::size_t s = 0;
+
+    for( int i = 0; i < K; ++i )
+    {
+        char buffer[ 64 ];
+        char key[ 64 ];
+
+        for( auto x: data )
+        {
+            auto r = boost::charconv::to_chars( buffer, buffer + sizeof( buffer ), x );
+            char* end = transform_to_key( buffer, r.ptr, key );
+            s += static_cast<std::size_t>( end - key ) + static_cast<unsigned char>( key[ 4 ] );
+        }
+    }
+
+    auto t2 = std::chrono::steady_clock::now();
+
+    std::cout << "boost::charconv::to_chars + transform<" << boost::core::type_name<T>() << ">: " << std::setw( 5 ) << ( t2 - t1 ) / 1ms << " ms (s=" << s << ")\n";
+}
+
+template<class T> static BOOST_NOINLINE void test_to_chars_sortable( std::vector<T> const& data )
+{
+    auto t1 = std::chrono::steady_clock::now();
+
+    std::size_t s = 0;
+
+    for( int i = 0; i < K; ++i )
+    {
+        char key[ 64 ];
+
+        for( auto x: data )
+        {
+            auto r = boost::charconv::to_chars_sortable( key, key + sizeof( key ), x );
+            s += static_cast<std::size_t>( r.ptr - key ) + static_cast<unsigned char>( key[ 4 ] );
+        }
+    }
+
+    auto t2 = std::chrono::steady_clock::now();
+
+    std::cout << "      boost::charconv::to_chars_sortable<" << boost::core::type_name<T>() << ">: " << std::setw( 5 ) << ( t2 - t1 ) / 1ms << " ms (s=" << s << ")\n";
+}
+
+template<class T> static BOOST_NOINLINE void test_from_chars_sortable( std::vector<T> const& data )
+{
+    std::string keys;
+    for( auto x: data )
+    {
+        char key[ 64 ];
+        auto r = boost::charconv::to_chars_sortable( key, key + sizeof( key ), x );
+        keys.append( key, r.ptr );
+    }
+
+    auto t1 = std::chrono::steady_clock::now();
+
+    double s = 0;
+
+    for( int i = 0; i < K; ++i )
+    {
+        const char* first = keys.data();
+        const char* last = keys.data() + keys.size();
+
+        while( first != last )
+        {
+            T x{};
+            first = boost::charconv::from_chars_sortable( first, last, x ).ptr;
+            s = s / 16.0 + static_cast<double>( x );
+        }
+    }
+
+    auto t2 = std::chrono::steady_clock::now();
+
+    std::cout << "    boost::charconv::from_chars_sortable<" << boost::core::type_name<T>() << ">: " << std::setw( 5 ) << ( t2 - t1 ) / 1ms << " ms (s=" << s << ")\n";
+}
+
+template<class T> static void test()
+{
+    std::vector<T> const data = init_input_data<T>();
+
+    test_to_chars_transform( data );
+    test_to_chars_sortable( data );
+    test_from_chars_sortable( data );
+}
+
+int main()
+{
+    std::cout << "---\n";
+
+    test<std::int32_t>();
+    test<std::uint64_t>();
+    test<float>();
+    test<double>();
+
+    std::cout << "---\n\n";
+}
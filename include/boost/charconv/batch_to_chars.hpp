@@ -0,0 +1,28 @@
+// Copyright 2023 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_CHARCONV_BATCH_TO_CHARS_HPP
+#define BOOST_CHARCONV_BATCH_TO_CHARS_HPP
+
+#include <boost/charconv/detail/to_chars_result.hpp>
+#include <boost/charconv/chars_format.hpp>
+#include <boost/charconv/config.hpp>
+#include <cstddef>
+
+// Shortest formatting of arrays of floats on one thread. On CPUs with AVX2 or AVX-512 the Dragonbox steps
+// that find the digits run on 4 or 8 values at once, and the text of each value is then written as by to_chars.
+// Other CPUs, and the library compiled with BOOST_CHARCONV_NO_SIMD, format one value at a time.
+
+namespace boost { namespace charconv {
+
+// Writes the shortest to_chars(first, last, values[i], fmt) of every value followed by separator, so that the output
+// is the same as formatting the values one after the other. If the output does not fit in [first, last) nothing is
+// written and {last, std::errc::result_out_of_range} is returned; count * (limits<float>::max_chars10 + 1)
+// characters are always enough.
+BOOST_CHARCONV_DECL to_chars_result batch_to_chars(char* first, char* last, const float* values, std::size_t count, char separator,
+                                                   chars_format fmt = chars_format::general) noexcept;
+
+}} // Namespaces
+
+#endif // BOOST_CHARCONV_BATCH_TO_CHARS_HPP
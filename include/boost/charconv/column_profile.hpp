@@ -0,0 +1,70 @@
+// Copyright 2023 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_CHARCONV_COLUMN_PROFILE_HPP
+#define BOOST_CHARCONV_COLUMN_PROFILE_HPP
+
+#include <boost/charconv/config.hpp>
+#include <cstddef>
+
+// Classification of a column of numbers (e.g. of a CSV file) from a sample of its fields, so that the
+// whole column can be parsed with the narrowest from_chars overload instead of detecting the format of
+// every value. Fields are matched with the grammar of from_chars and chars_format::general.
+
+namespace boost { namespace charconv {
+
+// Ordered from the narrowest to the widest decimal kind, followed by hex and invalid
+enum class column_kind : unsigned
+{
+    empty,                  // No non-empty field was examined
+    fixed_width_integer,    // Integers that all have the same number of characters, e.g. zero padded identifiers
+    integer,                // Integers of any length
+    fixed_point,            // Numbers with a decimal point, no exponent and at most 19 significant digits
+    floating,               // Anything else accepted by from_chars, including infinities and NaNs
+    hex,                    // Integers in base 16, where at least one field is not a decimal number
+    invalid                 // At least one field is not a number, or the fields mix decimal and base 16 notation
+};
+
+struct column_profile
+{
+    column_kind kind = column_kind::empty;
+
+    // Fields examined, and of those the empty ones and the ones that are not numbers.
+    // Empty fields do not change the kind.
+    std::size_t fields = 0;
+    std::size_t empty_fields = 0;
+    std::size_t invalid_fields = 0;
+
+    // Characters in the shortest and the longest non-empty field
+    std::size_t min_width = 0;
+    std::size_t max_width = 0;
+
+    // Most digits of a field counting from the first non-zero one, and most digits after the decimal point.
+    // max_hex_digits is the same count for the fields that consist of hexadecimal digits.
+    int max_digits = 0;
+    int max_fraction_digits = 0;
+    int max_hex_digits = 0;
+
+    bool needs_exponent = false;    // Some field has an exponent
+    bool has_negative = false;      // Some field starts with a minus sign
+    bool has_nonfinite = false;     // Some field is an infinity or a NaN
+    bool hex_digits = true;         // Every field consists of hexadecimal digits after an optional minus sign
+    bool exact_in_double = true;    // Every decimal field is representable as a double without rounding
+};
+
+// Number of fields profile_column examines by default
+static constexpr std::size_t default_profile_samples = 1024;
+
+// Adds the field [first, last) to profile
+BOOST_CHARCONV_DECL void profile_field(column_profile& profile, const char* first, const char* last) noexcept;
+
+// Profiles the fields of [first, last), which are separated by separator. At most samples fields are examined,
+// taken at evenly spaced positions of the text, and zero examines every field. A separator at the very end
+// does not start another field.
+BOOST_CHARCONV_DECL column_profile profile_column(const char* first, const char* last, char separator,
+                                                  std::size_t samples = default_profile_samples) noexcept;
+
+}} // Namespaces
+
+#endif // BOOST_CHARCONV_COLUMN_PROFILE_HPP
@@ -22,6 +22,14 @@
 # define BOOST_CHARCONV_DECL
 #endif
 
+// Defining BOOST_CHARCONV_INLINE_FLOAT makes the float and double overloads of from_chars,
+// from_chars_padded and to_chars inline header functions. The library always compiles and
+// exports its own out of line versions.
+
+#if defined(BOOST_CHARCONV_INLINE_FLOAT) && !defined(BOOST_CHARCONV_SOURCE)
+# define BOOST_CHARCONV_HAS_INLINE_FLOAT
+#endif
+
 // Autolink
 
 #if !defined(BOOST_CHARCONV_SOURCE) && !defined(BOOST_ALL_NO_LIB) && !defined(BOOST_CHARCONV_NO_LIB)
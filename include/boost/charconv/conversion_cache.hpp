@@ -0,0 +1,53 @@
+// Copyright 2023 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_CHARCONV_CONVERSION_CACHE_HPP
+#define BOOST_CHARCONV_CONVERSION_CACHE_HPP
+
+#include <boost/charconv/detail/from_chars_result.hpp>
+#include <boost/charconv/detail/to_chars_result.hpp>
+#include <boost/charconv/chars_format.hpp>
+#include <boost/charconv/config.hpp>
+#include <cstddef>
+
+// Memoization of double conversions for inputs that repeat a lot (e.g. telemetry or market data feeds).
+// Each thread has its own direct mapped cache, so there is no locking, and an entry is simply replaced
+// by the next value that maps to the same slot. The cache is only used by the cached_ functions below.
+
+namespace boost { namespace charconv {
+
+struct conversion_cache_stats
+{
+    std::size_t to_chars_hits;
+    std::size_t to_chars_misses;
+    std::size_t from_chars_hits;
+    std::size_t from_chars_misses;
+};
+
+// Number of entries in each of the two caches of a thread that has not called set_conversion_cache_size
+static constexpr std::size_t default_conversion_cache_size = 1024;
+
+// Longest output of to_chars and longest input of from_chars that are stored in the cache
+static constexpr std::size_t conversion_cache_max_chars = 24;
+
+// Resizes and empties the caches of the calling thread. The size is rounded down to a power of two,
+// and zero disables caching. Returns false if the memory could not be allocated, in which case caching is disabled.
+BOOST_CHARCONV_DECL bool set_conversion_cache_size(std::size_t entries) noexcept;
+BOOST_CHARCONV_DECL std::size_t conversion_cache_size() noexcept;
+
+// Counters of the calling thread
+BOOST_CHARCONV_DECL conversion_cache_stats get_conversion_cache_stats() noexcept;
+BOOST_CHARCONV_DECL void reset_conversion_cache_stats() noexcept;
+
+// Same results as to_chars(first, last, value, fmt, precision), keyed on the bits of value, fmt and precision
+BOOST_CHARCONV_DECL to_chars_result cached_to_chars(char* first, char* last, double value,
+                                                    chars_format fmt = chars_format::general, int precision = -1) noexcept;
+
+// Same results as from_chars(first, last, value, fmt), keyed on the characters in [first, last)
+BOOST_CHARCONV_DECL from_chars_result cached_from_chars(const char* first, const char* last, double& value,
+                                                        chars_format fmt = chars_format::general) noexcept;
+
+}} // Namespaces
+
+#endif // BOOST_CHARCONV_CONVERSION_CACHE_HPP
@@ -201,4 +201,17 @@ static_assert((BOOST_CHARCONV_ENDIAN_BIG_BYTE || BOOST_CHARCONV_ENDIAN_LITTLE_BY
 #  define BOOST_CHARCONV_HAS_BRAINFLOAT16
 #endif
 
+// x86-64 GCC and Clang compile the AVX2 and AVX-512 code paths with target attributes whatever the compiler flags,
+// and choose them at run time from the features of the CPU. Other compilers only have the paths of the instruction
+// sets the library is compiled for. BOOST_CHARCONV_NO_AVX512 leaves out the AVX-512 paths, and BOOST_CHARCONV_NO_AVX2
+// the AVX2 and AVX-512 ones.
+#if !defined(BOOST_CHARCONV_NO_SIMD) && (defined(__GNUC__) || defined(__clang__)) && defined(__x86_64__)
+#  define BOOST_CHARCONV_HAS_RUNTIME_DISPATCH
+#  define BOOST_CHARCONV_TARGET(features) __attribute__((target(features)))
+#  define BOOST_CHARCONV_CPU_SUPPORTS(feature) (__builtin_cpu_supports(feature) != 0)
+#else
+#  define BOOST_CHARCONV_TARGET(features)
+#  define BOOST_CHARCONV_CPU_SUPPORTS(feature) true
+#endif
+
 #endif // BOOST_CHARCONV_DETAIL_CONFIG_HPP
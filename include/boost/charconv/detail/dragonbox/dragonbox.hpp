@@ -27,6 +27,7 @@
 #include <boost/charconv/detail/bit_layouts.hpp>
 #include <boost/charconv/detail/emulated128.hpp>
 #include <boost/charconv/chars_format.hpp>
+#include <boost/charconv/config.hpp>
 #include <boost/core/bit.hpp>
 #include <type_traits>
 #include <limits>
@@ -1455,6 +1456,39 @@ namespace cache {
             return cache_format::cache[std::size_t(k - cache_format::min_k)];
         }
     };
+
+    // Stores 23 of the 619 entries of the binary64 cache and recovers the others with a 64-bit multiplication,
+    // trading a few cycles per conversion for about 9 KB less table
+    struct compact : base
+    {
+        using cache_policy = compact;
+
+        template <typename FloatFormat, typename cache_format = typename std::conditional<std::is_same<FloatFormat, ieee754_binary32>::value,
+                                                                                          cache_holder_ieee754_binary32,
+                                                                                          cache_holder_ieee754_binary64>::type>
+        static BOOST_CHARCONV_CXX14_CONSTEXPR typename cache_format::cache_entry_type get_cache(int k) noexcept
+        {
+            return get_cache_impl(k, FloatFormat{});
+        }
+
+    private:
+        static constexpr cache_holder_ieee754_binary32::cache_entry_type get_cache_impl(int k, ieee754_binary32) noexcept
+        {
+            return cache_holder_ieee754_binary32::cache[std::size_t(k - cache_holder_ieee754_binary32::min_k)];
+        }
+
+        static BOOST_CHARCONV_CXX14_CONSTEXPR cache_holder_ieee754_binary64::cache_entry_type get_cache_impl(int k, ieee754_binary64) noexcept
+        {
+            return compressed_cache_detail::get_cache(k);
+        }
+    };
+
+    // The policy used when none is given
+    #ifdef BOOST_CHARCONV_DRAGONBOX_COMPACT_CACHE
+    using default_cache = compact;
+    #else
+    using default_cache = full;
+    #endif
 }
 }
 
@@ -1520,6 +1554,7 @@ namespace binary_to_decimal_rounding {
 
 namespace cache {
     BOOST_INLINE_VARIABLE constexpr auto full = detail::policy_impl::cache::full{};
+    BOOST_INLINE_VARIABLE constexpr auto compact = detail::policy_impl::cache::compact{};
 }
 } // Namespace Policy
 
@@ -2400,7 +2435,7 @@ to_decimal(dragonbox_signed_significand_bits<Float, FloatTraits> dragonbox_signe
     
     #ifdef BOOST_CHARCONV_NO_CXX14_RETURN_TYPE_DEDUCTION
     // For C++11 we hardcode the policy holder
-    using policy_holder = policy_holder<decimal_to_binary_rounding::nearest_to_even, binary_to_decimal_rounding::to_even, cache::full, sign::return_sign, trailing_zero::remove>;
+    using policy_holder = policy_holder<decimal_to_binary_rounding::nearest_to_even, binary_to_decimal_rounding::to_even, cache::default_cache, sign::return_sign, trailing_zero::remove>;
     
     #else
     
@@ -2411,7 +2446,7 @@ to_decimal(dragonbox_signed_significand_bits<Float, FloatTraits> dragonbox_signe
                                                     decimal_to_binary_rounding::nearest_to_even>,
                                 base_default_pair<binary_to_decimal_rounding::base,
                                                     binary_to_decimal_rounding::to_even>,
-                                base_default_pair<cache::base, cache::full>>{},
+                                base_default_pair<cache::base, cache::default_cache>>{},
         policies...));
     
     #endif
@@ -2562,6 +2597,13 @@ namespace to_chars_detail {
     template <class Float, class FloatTraits>
     extern char* to_chars(typename FloatTraits::carrier_uint significand, int exponent, char* buffer, chars_format fmt) noexcept;
 
+    // Defined in the library, and exported because header templates such as to_chars_float_impl call them from user code
+    template <>
+    BOOST_CHARCONV_DECL char* to_chars<float, dragonbox_float_traits<float>>(std::uint32_t significand, int exponent, char* buffer, chars_format fmt) noexcept;
+
+    template <>
+    BOOST_CHARCONV_DECL char* to_chars<double, dragonbox_float_traits<double>>(std::uint64_t significand, int exponent, char* buffer, chars_format fmt) noexcept;
+
     // Avoid needless ABI overhead incurred by tag dispatch.
     template <class PolicyHolder, class Float, class FloatTraits>
     char* to_chars_n_impl(dragonbox_float_bits<Float, FloatTraits> br, char* buffer, chars_format fmt) noexcept
@@ -2677,7 +2719,7 @@ char* to_chars_n(Float x, char* buffer, chars_format fmt, BOOST_ATTRIBUTE_UNUSED
 
     #ifdef BOOST_CHARCONV_NO_CXX14_RETURN_TYPE_DEDUCTION
     // For C++11 we hardcode the policy holder
-    using policy_holder = policy_holder<decimal_to_binary_rounding::nearest_to_even, binary_to_decimal_rounding::to_even, cache::full, sign::return_sign, trailing_zero::remove>;
+    using policy_holder = policy_holder<decimal_to_binary_rounding::nearest_to_even, binary_to_decimal_rounding::to_even, cache::default_cache, sign::return_sign, trailing_zero::remove>;
     
     #else
     
@@ -2688,7 +2730,7 @@ char* to_chars_n(Float x, char* buffer, chars_format fmt, BOOST_ATTRIBUTE_UNUSED
                                                     decimal_to_binary_rounding::nearest_to_even>,
                                 base_default_pair<binary_to_decimal_rounding::base,
                                                     binary_to_decimal_rounding::to_even>,
-                                base_default_pair<cache::base, cache::full>>{},
+                                base_default_pair<cache::base, cache::default_cache>>{},
         policies...));
     
     #endif
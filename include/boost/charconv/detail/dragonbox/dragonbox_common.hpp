@@ -774,56 +774,103 @@ template <bool b> constexpr typename main_cache_holder_impl<b>::cache_entry_type
 
 using main_cache_holder = main_cache_holder_impl<true>;
 
-// Compressed cache for double
-struct compressed_cache_detail 
+// Compressed cache for double: every compression_ratio-th entry of main_cache_holder is stored,
+// and the entries in between are recovered from it with a multiplication by a power of five
+template <bool b>
+struct compressed_cache_detail_impl
 {
     static constexpr int compression_ratio = 27;
     static constexpr std::size_t compressed_table_size = (main_cache_holder::max_k - main_cache_holder::min_k + compression_ratio) /
                                                          compression_ratio;
 
-    struct cache_holder_t 
-    {
-        static constexpr uint128 table[] = {
-            {0xff77b1fcbebcdc4f, 0x25e8e89c13bb0f7b},
-            {0xa5178fff668ae0b6, 0x626e974dbe39a873},
-            {0x855c3be0a17fcd26, 0x5cf2eea09a550680},
-            {0xd77485cb25823ac7, 0x7d633293366b828c},
-            {0xae0b158b4738705e, 0x9624ab50b148d446},
-            {0x8c974f7383725573, 0x1e414218c73a13fc},
-            {0xe3231912d5bf60e6, 0x10e1fff697ed6c6a},
-            {0xb77ada0617e3bbcb, 0x09ce6ebb40173745},
-            {0x9436c0760c86e30b, 0xf9a0b6720aaf6522},
-            {0xef73d256a5c0f77c, 0x963e66858f6d4441},
-            {0xc16d9a0095928a27, 0x75b7053c0f178294},
-            {0x9c40000000000000, 0x0000000000000000},
-            {0xfc6f7c4045812296, 0x4d00000000000000},
-            {0xcbea6f8ceb02bb39, 0x9bf4f8a69f764491},
-            {0xa4b8cab1a1563f52, 0x577001b891185939},
-            {0x850fadc09923329e, 0x03e2cf6bc604ddb1},
-            {0xd6f8d7509292d603, 0x45a9d2845d3c42b7},
-            {0xada72ccc20054ae9, 0xaf561aa79a10ae6b},
-            {0x8c469ab843b89562, 0x93956d7478ccec8f},
-            {0xe2a0b5dc971f303a, 0x2e44ae64840fd61e},
-            {0xb7118682dbb66a77, 0x3fbc8c33221dc2a2},
-            {0x93e1ab8252f33b45, 0xcabb90e5c942b504},
-            {0xeeea5d5004981478, 0x1858ccfce06cac75},
-        };
-
-        static_assert(sizeof(table) == compressed_table_size * sizeof(uint128), "Table should have 23 elements");
+    static constexpr uint128 table[] = {
+        {0xff77b1fcbebcdc4f, 0x25e8e89c13bb0f7b},
+        {0xce5d73ff402d98e3, 0xfb0a3d212dc81290},
+        {0xa6b34ad8c9dfc06f, 0xf42faa48c0ea481f},
+        {0x86a8d39ef77164bc, 0xae5dff9c02033198},
+        {0xd98ddaee19068c76, 0x3badd624dd9b0958},
+        {0xafbd2350644eeacf, 0xe5d1929ef90898fb},
+        {0x8df5efabc5979c8f, 0xca8d3ffa1ef463c2},
+        {0xe55990879ddcaabd, 0xcc420a6a101d0516},
+        {0xb94470938fa89bce, 0xf808e40e8d5b3e6a},
+        {0x95a8637627989aad, 0xdde7001379a44aa9},
+        {0xf1c90080baf72cb1, 0x5324c68b12dd6339},
+        {0xc350000000000000, 0x0000000000000000},
+        {0x9dc5ada82b70b59d, 0xf020000000000000},
+        {0xfee50b7025c36a08, 0x02f236d04753d5b5},
+        {0xcde6fd5e09abcf26, 0xed4c0226b55e6f87},
+        {0xa6539930bf6bff45, 0x84db8346b786151d},
+        {0x865b86925b9bc5c2, 0x0b8a2392ba45a9b3},
+        {0xd910f7ff28069da4, 0x1b2ba1518094da05},
+        {0xaf58416654a6babb, 0x387ac8d1970027b3},
+        {0x8da471a9de737e24, 0x5ceaecfed289e5d3},
+        {0xe4d5e82392a40515, 0x0fabaf3feaa5334b},
+        {0xb8da1662e7b00a17, 0x3d6a751f3b936244},
+        {0x95527a5202df0ccb, 0x0f37801e0c43ebc9},
     };
 
-    struct pow5_holder_t 
-    {
-        static constexpr std::uint64_t table[] = {
-            1, 5, 25, 125, 625, 3125, 15625, 78125, 390625, 1953125, 9765625, 48828125, 244140625, 1220703125,
-            6103515625, 30517578125, 152587890625, 762939453125, 3814697265625, 19073486328125, 95367431640625,
-            476837158203125, 2384185791015625, 11920928955078125, 59604644775390625, 298023223876953125, 1490116119384765625
-        };
+    static_assert(sizeof(table) == compressed_table_size * sizeof(uint128), "Table should have 23 elements");
 
-        static_assert(sizeof(table) == compression_ratio * sizeof(std::uint64_t), "Table should have 27 elements");
+    static constexpr std::uint64_t pow5_table[] = {
+        1, 5, 25, 125, 625, 3125, 15625, 78125, 390625, 1953125, 9765625, 48828125, 244140625, 1220703125,
+        6103515625, 30517578125, 152587890625, 762939453125, 3814697265625, 19073486328125, 95367431640625,
+        476837158203125, 2384185791015625, 11920928955078125, 59604644775390625, 298023223876953125, 1490116119384765625
     };
+
+    static_assert(sizeof(pow5_table) == compression_ratio * sizeof(std::uint64_t), "Table should have 27 elements");
+
+    // Gives main_cache_holder::cache[k - main_cache_holder::min_k], or a value at most 2 larger in the last bits.
+    // This is the recovery of upstream Dragonbox's cache::compact, which is verified to give the same results.
+    static BOOST_CHARCONV_CXX14_CONSTEXPR uint128 get_cache(int k) noexcept
+    {
+        BOOST_CHARCONV_ASSERT(k >= main_cache_holder::min_k && k <= main_cache_holder::max_k);
+
+        // Compute the base index.
+        const auto cache_index = static_cast<int>(static_cast<std::uint32_t>(k - main_cache_holder::min_k) / compression_ratio);
+        const auto kb = cache_index * compression_ratio + main_cache_holder::min_k;
+        const auto offset = k - kb;
+
+        // Get the base cache.
+        const auto base_cache = table[cache_index];
+
+        if (offset == 0)
+        {
+            return base_cache;
+        }
+
+        // Compute the required amount of bit-shift.
+        const auto alpha = log::floor_log2_pow10(kb + offset) - log::floor_log2_pow10(kb) - offset;
+        BOOST_CHARCONV_ASSERT(alpha > 0 && alpha < 64);
+
+        // Try to recover the real cache.
+        const auto pow5 = pow5_table[offset];
+        auto recovered_cache = umul128(base_cache.high, pow5);
+        const auto middle_low = umul128(base_cache.low, pow5);
+
+        recovered_cache += middle_low.high;
+
+        const auto high_to_middle = recovered_cache.high << (64 - alpha);
+        const auto middle_to_low = recovered_cache.low << (64 - alpha);
+
+        recovered_cache = uint128{(recovered_cache.low >> alpha) | high_to_middle, ((middle_low.low >> alpha) | middle_to_low)};
+
+        BOOST_CHARCONV_ASSERT(recovered_cache.low + 1 != 0);
+        return uint128(recovered_cache.high, recovered_cache.low + 1);
+    }
 };
 
+#if (defined(BOOST_NO_CXX17_INLINE_VARIABLES) && (BOOST_MSVC != 1900)) || \
+    (defined(__clang_major__) && __clang_major__ == 5)
+
+template <bool b> constexpr int compressed_cache_detail_impl<b>::compression_ratio;
+template <bool b> constexpr std::size_t compressed_cache_detail_impl<b>::compressed_table_size;
+template <bool b> constexpr uint128 compressed_cache_detail_impl<b>::table[];
+template <bool b> constexpr std::uint64_t compressed_cache_detail_impl<b>::pow5_table[];
+
+#endif
+
+using compressed_cache_detail = compressed_cache_detail_impl<true>;
+
 }}}
 
 #endif // BOOST_CHARCONV_DETAIL_DRAGONBOX_COMMON_HPP
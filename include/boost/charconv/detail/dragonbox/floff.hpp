@@ -28,6 +28,7 @@
 #include <boost/charconv/detail/bit_layouts.hpp>
 #include <boost/charconv/detail/emulated128.hpp>
 #include <boost/charconv/detail/dragonbox/dragonbox_common.hpp>
+#include <boost/charconv/detail/profile.hpp>
 #include <boost/charconv/chars_format.hpp>
 #include <boost/core/bit.hpp>
 #include <type_traits>
@@ -339,6 +340,9 @@ BOOST_FORCEINLINE std::uint8_t load_extended_cache(CacheBlockType* blocks_ptr, i
     std::uint32_t excessive_bits_to_right;
     std::uint8_t  cache_block_count = cache_block_count_helper<ExtendedCache, zero_out, CacheBlockType>(blocks_ptr, e, k, multiplier_index);
 
+    BOOST_CHARCONV_PROFILE_PATH(to_chars_floff_segment);
+    BOOST_CHARCONV_PROFILE_COUNT(to_chars_floff_cache_block, cache_block_count);
+
     // The request window starting/ending positions.
     auto start_bit_index = static_cast<int>(mul_info.cache_bit_index_offset) + e - ExtendedCache::cache_bit_index_offset_base;
     auto end_bit_index = start_bit_index + cache_block_count * static_cast<int>(ExtendedCache::cache_bits_unit);
@@ -819,47 +823,7 @@ struct main_cache_compressed
 
         BOOST_IF_CONSTEXPR (std::is_same<FloatFormat, ieee754_binary64>::value) 
         {
-            // Compute the base index.
-            const auto cache_index =
-                static_cast<int>(static_cast<std::uint32_t>(k - main_cache_holder::min_k) /
-                    compressed_cache_detail::compression_ratio);
-
-            const auto kb = cache_index * compressed_cache_detail::compression_ratio +
-                            main_cache_holder::min_k;
-
-            const auto offset = k - kb;
-
-            // Get the base cache.
-            const auto base_cache = compressed_cache_detail::cache_holder_t::table[cache_index];
-
-            if (offset == 0)
-            {
-                return base_cache;
-            }
-            else 
-            {
-
-                // Compute the required amount of bit-shift.
-                const auto alpha = log::floor_log2_pow10(kb + offset) - log::floor_log2_pow10(kb) - offset;
-                BOOST_CHARCONV_ASSERT(alpha > 0 && alpha < 64);
-
-                // Try to recover the real cache.
-                const auto pow5 = compressed_cache_detail::pow5_holder_t::table[offset];
-                auto recovered_cache = umul128(base_cache.high, pow5);
-                const auto middle_low = umul128(base_cache.low, pow5);
-
-                recovered_cache += middle_low.high;
-
-                const auto high_to_middle = recovered_cache.high << (64 - alpha);
-                const auto middle_to_low = recovered_cache.low << (64 - alpha);
-
-                recovered_cache = uint128{(recovered_cache.low >> alpha) | high_to_middle, ((middle_low.low >> alpha) | middle_to_low)};
-
-                BOOST_CHARCONV_ASSERT(recovered_cache.low + 1 != 0);
-                recovered_cache = uint128(recovered_cache.high, recovered_cache.low + 1);
-
-                return recovered_cache;
-            }
+            return compressed_cache_detail::get_cache(k);
         }
         else
         {
@@ -869,6 +833,13 @@ struct main_cache_compressed
     }
 };
 
+// The main cache used by to_chars with a precision
+#ifdef BOOST_CHARCONV_DRAGONBOX_COMPACT_CACHE
+using main_cache_default = main_cache_compressed;
+#else
+using main_cache_default = main_cache_full;
+#endif
+
 template <bool b>
 struct extended_cache_long_impl
 {
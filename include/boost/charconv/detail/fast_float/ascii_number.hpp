@@ -9,6 +9,7 @@
 #define BOOST_CHARCONV_DETAIL_FASTFLOAT_ASCII_NUMBER_HPP
 
 #include <boost/charconv/detail/fast_float/float_common.hpp>
+#include <boost/charconv/detail/padded_digits.hpp>
 #include <cctype>
 #include <cstdint>
 #include <cstring>
@@ -117,6 +118,18 @@ bool is_made_of_eight_digits_fast(const char *chars)  noexcept  {
   return is_made_of_eight_digits_fast(read_u64(chars));
 }
 
+// Padded parsing is only offered for char
+template <typename UC>
+BOOST_FORCEINLINE constexpr
+UC const * parse_digits_padded(UC const * p, UC const *, uint64_t&) noexcept {
+  return p;
+}
+
+BOOST_FORCEINLINE
+char const * parse_digits_padded(char const * p, char const * pend, uint64_t& i) noexcept {
+  return boost::charconv::detail::parse_digit_run_padded(p, pend, i);
+}
+
 template <typename UC>
 struct parsed_number_string_t {
   int64_t exponent{0};
@@ -133,7 +146,9 @@ using byte_span = span<char>;
 using parsed_number_string = parsed_number_string_t<char>;
 // Assuming that you use no more than 19 digits, this will
 // parse an ASCII string.
-template <typename UC>
+// When Padded is true the caller guarantees that the characters past pend may be read,
+// and the digit runs are consumed eight characters at a time.
+template <typename UC, bool Padded = false>
 BOOST_FORCEINLINE BOOST_CHARCONV_FASTFLOAT_CONSTEXPR20
 parsed_number_string_t<UC> parse_number_string(UC const *p, UC const * pend, parse_options_t<UC> options) noexcept {
   chars_format const fmt = options.format;
@@ -161,12 +176,16 @@ parsed_number_string_t<UC> parse_number_string(UC const *p, UC const * pend, par
 
   uint64_t i = 0; // an unsigned int avoids signed overflows (which are bad)
 
-  while ((p != pend) && is_integer(*p)) {
-    // a multiplication by 10 is cheaper than an arbitrary integer
-    // multiplication
-    i = 10 * i +
-        uint64_t(*p - UC('0')); // might overflow, we will handle the overflow later
-    ++p;
+  BOOST_IF_CONSTEXPR (Padded) {
+    p = parse_digits_padded(p, pend, i); // might overflow, we will handle the overflow later
+  } else {
+    while ((p != pend) && is_integer(*p)) {
+      // a multiplication by 10 is cheaper than an arbitrary integer
+      // multiplication
+      i = 10 * i +
+          uint64_t(*p - UC('0')); // might overflow, we will handle the overflow later
+      ++p;
+    }
   }
   UC const * const end_of_integer_part = p;
   int64_t digit_count = int64_t(end_of_integer_part - start_digits);
@@ -177,16 +196,20 @@ parsed_number_string_t<UC> parse_number_string(UC const *p, UC const * pend, par
     UC const * before = p;
     // can occur at most twice without overflowing, but let it occur more, since
     // for integers with many digits, digit parsing is the primary bottleneck.
-    if (std::is_same<UC,char>::value) {
-      while ((std::distance(p, pend) >= 8) && is_made_of_eight_digits_fast(p)) {
-        i = i * 100000000 + parse_eight_digits_unrolled(p); // in rare cases, this will overflow, but that's ok
-        p += 8;
+    BOOST_IF_CONSTEXPR (Padded) {
+      p = parse_digits_padded(p, pend, i); // in rare cases, this will overflow, but that's ok
+    } else {
+      if (std::is_same<UC,char>::value) {
+        while ((std::distance(p, pend) >= 8) && is_made_of_eight_digits_fast(p)) {
+          i = i * 100000000 + parse_eight_digits_unrolled(p); // in rare cases, this will overflow, but that's ok
+          p += 8;
+        }
+      }
+      while ((p != pend) && is_integer(*p)) {
+        uint8_t digit = uint8_t(*p - UC('0'));
+        ++p;
+        i = i * 10 + digit; // in rare cases, this will overflow, but that's ok
       }
-    }
-    while ((p != pend) && is_integer(*p)) {
-      uint8_t digit = uint8_t(*p - UC('0'));
-      ++p;
-      i = i * 10 + digit; // in rare cases, this will overflow, but that's ok
     }
     exponent = before - p;
     answer.fraction = span<const UC>(before, size_t(p - before));
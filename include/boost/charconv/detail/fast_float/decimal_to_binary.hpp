@@ -191,6 +191,79 @@ adjusted_mantissa compute_float(int64_t q, uint64_t w)  noexcept  {
   return answer;
 }
 
+// w * 10 ** q, rounded toward zero, with exact set when no bits were dropped.
+// The whole product is computed so that the dropped bits, and not only the ones needed for rounding to nearest,
+// are known to within the error of the 128-bit power of five. When the dropped bits are too close to zero
+// or to a carry for the sign of the error to matter, we return an adjusted_mantissa with a negative power
+// of 2: the caller should compare digits in such cases. Exact values with q < 0 always end up there.
+template <typename binary>
+BOOST_FORCEINLINE BOOST_CHARCONV_FASTFLOAT_CONSTEXPR20
+adjusted_mantissa compute_float_truncated(int64_t q, uint64_t w, bool& exact)  noexcept  {
+  adjusted_mantissa answer;
+  exact = (w == 0);
+  if ((w == 0) || (q < binary::smallest_power_of_ten())) {
+    answer.power2 = 0;
+    answer.mantissa = 0;
+    return answer;
+  }
+  if (q > binary::largest_power_of_ten()) {
+    // the largest finite value
+    answer.power2 = binary::infinite_power() - 1;
+    answer.mantissa = (uint64_t(1) << binary::mantissa_explicit_bits()) - 1;
+    return answer;
+  }
+
+  int lz = leading_zeroes(w);
+  w <<= lz;
+
+  // Both halves of the power of five, unlike compute_product_approximation which skips the second one
+  // when the first is enough to round to nearest.
+  const int index = 2 * int(q - powers::smallest_power_of_five);
+  value128 product = full_multiplication(w, powers::power_of_five_128[index]);
+  const value128 secondproduct = full_multiplication(w, powers::power_of_five_128[index + 1]);
+  product.low += secondproduct.high;
+  if (secondproduct.high > product.low) {
+    product.high++;
+  }
+
+  int upperbit = int(product.high >> 63);
+  int shift = upperbit + 64 - binary::mantissa_explicit_bits() - 2;
+  answer.power2 = int32_t(detail::power(int32_t(q)) + upperbit - lz - binary::minimum_exponent());
+  if (answer.power2 >= binary::infinite_power()) {
+    answer.power2 = binary::infinite_power() - 1;
+    answer.mantissa = (uint64_t(1) << binary::mantissa_explicit_bits()) - 1;
+    return answer;
+  }
+  if (answer.power2 <= 0) { // subnormal: the bits below the minimum exponent are dropped as well
+    shift += -answer.power2 + 1;
+    answer.power2 = 0;
+  }
+
+  const uint64_t dropped_mask = (shift < 64) ? (uint64_t(1) << shift) - 1 : uint64_t(0xFFFFFFFFFFFFFFFF);
+  const uint64_t dropped = product.high & dropped_mask;
+  answer.mantissa = (shift < 64) ? product.high >> shift : 0;
+
+  // The exact product is within (-1, 2) units of product.low of the computed one: the power of five is
+  // off by less than one unit in its last bit, and secondproduct.low was dropped.
+  if ((dropped == 0) && (product.low == 0)) {
+    // For q in [0,55] the power of five fits in 128 bits, so only secondproduct.low can be missing
+    if ((q >= 0) && (q <= 55) && (secondproduct.low == 0)) {
+      exact = true;
+    } else {
+      answer.power2 = -1;
+      return answer;
+    }
+  } else if ((dropped == dropped_mask) && (product.low >= uint64_t(0xFFFFFFFFFFFFFFFE))) {
+    answer.power2 = -1;
+    return answer;
+  }
+
+  if (answer.power2 != 0) {
+    answer.mantissa &= ~(uint64_t(1) << binary::mantissa_explicit_bits());
+  }
+  return answer;
+}
+
 }}}} // namespace fast_float
 
 #endif
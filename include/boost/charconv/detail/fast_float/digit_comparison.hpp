@@ -437,6 +437,40 @@ adjusted_mantissa digit_comp(parsed_number_string_t<UC>& num, adjusted_mantissa
   }
 }
 
+// compare the significant digits with a positive, finite float, and return the sign of
+// their difference. this uses the same scaling as positive_digit_comp and negative_digit_comp,
+// but against `b` itself rather than `b+h`. if digits were truncated, round_up_bigint appended a
+// non-zero digit, so the comparison is never equal and still has the sign of the full digits.
+template <typename T, typename UC>
+inline BOOST_CHARCONV_FASTFLOAT_CONSTEXPR20
+int compare_digits(parsed_number_string_t<UC>& num, T value) noexcept {
+  int32_t sci_exp = scientific_exponent(num);
+  size_t max_digits = binary_format<T>::max_digits();
+  size_t digits = 0;
+  bigint real_digits;
+  parse_mantissa(real_digits, num, max_digits, digits);
+  int32_t real_exp = sci_exp + 1 - int32_t(digits);
+
+  adjusted_mantissa theor = to_extended(value);
+  bigint theor_digits(theor.mantissa);
+  int32_t theor_exp = theor.power2;
+
+  int32_t pow2_exp = theor_exp;
+  if (real_exp >= 0) {
+    BOOST_CHARCONV_FASTFLOAT_ASSERT(real_digits.pow10(uint32_t(real_exp)));
+  } else {
+    BOOST_CHARCONV_FASTFLOAT_ASSERT(theor_digits.pow5(uint32_t(-real_exp)));
+    pow2_exp -= real_exp;
+  }
+  if (pow2_exp > 0) {
+    BOOST_CHARCONV_FASTFLOAT_ASSERT(theor_digits.pow2(uint32_t(pow2_exp)));
+  } else if (pow2_exp < 0) {
+    BOOST_CHARCONV_FASTFLOAT_ASSERT(real_digits.pow2(uint32_t(-pow2_exp)));
+  }
+
+  return real_digits.compare(theor_digits);
+}
+
 }}}} // namespace fast_float
 
 #endif
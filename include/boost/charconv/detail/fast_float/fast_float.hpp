@@ -38,11 +38,27 @@ from_chars_result_t<UC> from_chars(UC const * first, UC const * last,
 /**
  * Like from_chars, but accepts an `options` argument to govern number parsing.
  */
-template<typename T, typename UC = char>
+template<typename T, typename UC = char, bool Padded = false, bool Faithful = false>
 BOOST_CHARCONV_FASTFLOAT_CONSTEXPR20
 from_chars_result_t<UC> from_chars_advanced(UC const * first, UC const * last,
                                       T &value, parse_options_t<UC> options)  noexcept;
 
+/**
+ * Like from_chars, but the caller guarantees that at least eight characters past `last`
+ * can be read, which lets the digits be consumed without checking each one against `last`.
+ */
+template<typename T>
+from_chars_result_t<char> from_chars_padded(char const * first, char const * last,
+                                      T &value, chars_format fmt = chars_format::general)  noexcept;
+
+/**
+ * Like from_chars, but the result is only faithfully rounded: it is one of the two floats adjacent
+ * to the exact value (less than 1 ULP of error), which avoids every arbitrary precision fallback.
+ */
+template<typename T>
+from_chars_result_t<char> from_chars_faithful(char const * first, char const * last,
+                                      T &value, chars_format fmt = chars_format::general)  noexcept;
+
 }}}} // namespace fast_float
 #include <boost/charconv/detail/fast_float/parse_number.hpp>
 #endif // BOOST_CHARCONV_FASTFLOAT_FAST_FLOAT_H
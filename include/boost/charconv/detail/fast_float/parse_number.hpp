@@ -12,6 +12,7 @@
 #include <boost/charconv/detail/fast_float/decimal_to_binary.hpp>
 #include <boost/charconv/detail/fast_float/digit_comparison.hpp>
 #include <boost/charconv/detail/fast_float/float_common.hpp>
+#include <boost/charconv/detail/profile.hpp>
 
 #include <cmath>
 #include <cstring>
@@ -157,32 +158,27 @@ from_chars_result_t<UC> from_chars(UC const * first, UC const * last,
   return from_chars_advanced(first, last, value, parse_options_t<UC>{fmt});
 }
 
-template<typename T, typename UC>
-BOOST_CHARCONV_FASTFLOAT_CONSTEXPR20
-from_chars_result_t<UC> from_chars_advanced(UC const * first, UC const * last,
-                                      T &value, parse_options_t<UC> options)  noexcept  {
+template<typename T>
+from_chars_result_t<char> from_chars_padded(char const * first, char const * last,
+                             T &value, chars_format fmt /*= chars_format::general*/)  noexcept  {
+  return from_chars_advanced<T, char, true>(first, last, value, parse_options_t<char>{fmt});
+}
 
-  static_assert (std::is_same<T, double>::value || std::is_same<T, float>::value, "only float and double are supported");
-  static_assert (std::is_same<UC, char>::value ||
-                 std::is_same<UC, wchar_t>::value ||
-                 std::is_same<UC, char16_t>::value ||
-                 std::is_same<UC, char32_t>::value , "only char, wchar_t, char16_t and char32_t are supported");
+template<typename T>
+from_chars_result_t<char> from_chars_faithful(char const * first, char const * last,
+                             T &value, chars_format fmt /*= chars_format::general*/)  noexcept  {
+  return from_chars_advanced<T, char, false, true>(first, last, value, parse_options_t<char>{fmt});
+}
 
+/**
+ * Computes the value of a number that was already tokenized by parse_number_string.
+ * When Faithful is true the slow paths are skipped and the result may be one of the two
+ * floats adjacent to the exact value instead of the nearest one, i.e. the error is below 1 ULP.
+ */
+template<typename T, typename UC, bool Faithful>
+BOOST_CHARCONV_FASTFLOAT_CONSTEXPR20
+from_chars_result_t<UC> from_chars_parsed(parsed_number_string_t<UC> &pns, T &value)  noexcept  {
   from_chars_result_t<UC> answer;
-#ifdef BOOST_CHARCONV_FASTFLOAT_SKIP_WHITE_SPACE  // disabled by default
-  while ((first != last) && fast_float::is_space(uint8_t(*first))) {
-    first++;
-  }
-#endif
-  if (first == last) {
-    answer.ec = std::errc::invalid_argument;
-    answer.ptr = first;
-    return answer;
-  }
-  parsed_number_string_t<UC> pns = parse_number_string<UC>(first, last, options);
-  if (!pns.valid) {
-    return detail::parse_infnan(first, last, value);
-  }
   answer.ec = std::errc(); // be optimistic
   answer.ptr = pns.lastmatch;
   // The implementation of the Clinger's fast path is convoluted because
@@ -206,6 +202,7 @@ from_chars_result_t<UC> from_chars_advanced(UC const * first, UC const * last,
         if (pns.exponent < 0) { value = value / binary_format<T>::exact_power_of_ten(-pns.exponent); }
         else { value = value * binary_format<T>::exact_power_of_ten(pns.exponent); }
         if (pns.negative) { value = -value; }
+        BOOST_CHARCONV_PROFILE_PATH(from_chars_clinger);
         return answer;
       }
     } else {
@@ -221,19 +218,36 @@ from_chars_result_t<UC> from_chars_advanced(UC const * first, UC const * last,
 #endif
         value = T(pns.mantissa) * binary_format<T>::exact_power_of_ten(pns.exponent);
         if (pns.negative) { value = -value; }
+        BOOST_CHARCONV_PROFILE_PATH(from_chars_clinger);
         return answer;
       }
     }
   }
   adjusted_mantissa am = compute_float<binary_format<T>>(pns.exponent, pns.mantissa);
-  if(pns.too_many_digits && am.power2 >= 0) {
-    if(am != compute_float<binary_format<T>>(pns.exponent, pns.mantissa + 1)) {
-      am = compute_error<binary_format<T>>(pns.exponent, pns.mantissa);
+  BOOST_IF_CONSTEXPR (Faithful) {
+    // The truncated digits change the value by less than 1e-18 relative to it, which can only move
+    // the result to the other neighbour of the exact value. An undecided result is within a hair of
+    // halfway between two floats, so the one below is taken without comparing any digits.
+    BOOST_CHARCONV_PROFILE_PATH(from_chars_eisel_lemire);
+    if(am.power2 < 0) {
+      am.power2 -= invalid_am_bias;
+      round<T>(am, [](adjusted_mantissa&a, int32_t shift) { round_down(a, shift); });
+    }
+  } else {
+    if(pns.too_many_digits && am.power2 >= 0) {
+      if(am != compute_float<binary_format<T>>(pns.exponent, pns.mantissa + 1)) {
+        am = compute_error<binary_format<T>>(pns.exponent, pns.mantissa);
+      }
+    }
+    // If we called compute_float<binary_format<T>>(pns.exponent, pns.mantissa) and we have an invalid power (am.power2 < 0),
+    // then we need to go the long way around again. This is very uncommon.
+    if(am.power2 < 0) {
+      BOOST_CHARCONV_PROFILE_PATH(from_chars_digit_comparison);
+      am = digit_comp<T>(pns, am);
+    } else {
+      BOOST_CHARCONV_PROFILE_PATH(from_chars_eisel_lemire);
     }
   }
-  // If we called compute_float<binary_format<T>>(pns.exponent, pns.mantissa) and we have an invalid power (am.power2 < 0),
-  // then we need to go the long way around again. This is very uncommon.
-  if(am.power2 < 0) { am = digit_comp<T>(pns, am); }
   to_float(pns.negative, am, value);
   // Test for over/underflow.
   if ((pns.mantissa != 0 && am.mantissa == 0 && am.power2 == 0) || am.power2 == binary_format<T>::infinite_power()) {
@@ -242,6 +256,35 @@ from_chars_result_t<UC> from_chars_advanced(UC const * first, UC const * last,
   return answer;
 }
 
+template<typename T, typename UC, bool Padded, bool Faithful>
+BOOST_CHARCONV_FASTFLOAT_CONSTEXPR20
+from_chars_result_t<UC> from_chars_advanced(UC const * first, UC const * last,
+                                      T &value, parse_options_t<UC> options)  noexcept  {
+
+  static_assert (std::is_same<T, double>::value || std::is_same<T, float>::value, "only float and double are supported");
+  static_assert (std::is_same<UC, char>::value ||
+                 std::is_same<UC, wchar_t>::value ||
+                 std::is_same<UC, char16_t>::value ||
+                 std::is_same<UC, char32_t>::value , "only char, wchar_t, char16_t and char32_t are supported");
+
+  from_chars_result_t<UC> answer;
+#ifdef BOOST_CHARCONV_FASTFLOAT_SKIP_WHITE_SPACE  // disabled by default
+  while ((first != last) && fast_float::is_space(uint8_t(*first))) {
+    first++;
+  }
+#endif
+  if (first == last) {
+    answer.ec = std::errc::invalid_argument;
+    answer.ptr = first;
+    return answer;
+  }
+  parsed_number_string_t<UC> pns = parse_number_string<UC, Padded>(first, last, options);
+  if (!pns.valid) {
+    return detail::parse_infnan(first, last, value);
+  }
+  return from_chars_parsed<T, UC, Faithful>(pns, value);
+}
+
 }}}} // namespace fast_float
 
 #endif
@@ -0,0 +1,319 @@
+// Copyright 2023 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_CHARCONV_DETAIL_FIXED_WIDTH_RECORDS_HPP
+#define BOOST_CHARCONV_DETAIL_FIXED_WIDTH_RECORDS_HPP
+
+#include <boost/charconv/detail/fast_float/fast_float.hpp>
+#include <boost/charconv/detail/padded_digits.hpp>
+#include <boost/charconv/detail/from_chars_result.hpp>
+#include <boost/charconv/detail/config.hpp>
+#include <boost/charconv/chars_format.hpp>
+#include <system_error>
+#include <cstdint>
+#include <cstddef>
+
+// Parsing of many numbers that share one layout, e.g. a column of a fixed width text file.
+// The layout is found once from the first record, after which each record only has to be checked
+// against it: the digits are read eight at a time, and the conversion is done by Clinger's fast path
+// or Eisel-Lemire without looking for an exponent, a decimal point or the end of the digits.
+// Records that do not match the layout, or that Eisel-Lemire can not decide, go through from_chars.
+// The vector kernels in src/from_chars.cpp check 4 or 8 records that fit into 16 characters and convert
+// their digits in vector lanes, and a block whose records all take Clinger's fast path is divided in
+// vector lanes too.
+
+namespace boost { namespace charconv { namespace detail {
+
+struct fixed_width_layout
+{
+    bool sign_column;     // First character is '-', '+' or ' '
+    int integer_digits;
+    int fraction_digits;  // Zero if there is no decimal point
+    bool valid;
+};
+
+inline fixed_width_layout analyze_fixed_width_layout(const char* first, std::size_t width) noexcept
+{
+    fixed_width_layout layout {false, 0, 0, false};
+    const char* const last = first + width;
+    const char* p = first;
+
+    if (p != last && (*p == '-' || *p == '+' || *p == ' '))
+    {
+        layout.sign_column = true;
+        ++p;
+    }
+
+    const char* const integer_first = p;
+    while (p != last && *p >= '0' && *p <= '9')
+    {
+        ++p;
+    }
+    layout.integer_digits = static_cast<int>(p - integer_first);
+
+    if (p != last)
+    {
+        if (*p != '.')
+        {
+            return layout;
+        }
+        ++p;
+        const char* const fraction_first = p;
+        while (p != last && *p >= '0' && *p <= '9')
+        {
+            ++p;
+        }
+        if (p != last || p == fraction_first)
+        {
+            return layout;
+        }
+        layout.fraction_digits = static_cast<int>(p - fraction_first);
+    }
+
+    // The significand has to fit into a std::uint64_t without rounding
+    const int digits = layout.integer_digits + layout.fraction_digits;
+    layout.valid = digits != 0 && digits <= 19;
+    return layout;
+}
+
+// Appends the n digits starting at p to value. lo is the first readable character before p,
+// which allows a short tail to be read as the last eight characters ending at p + n.
+BOOST_FORCEINLINE bool parse_fixed_digits(const char* lo, const char* p, int n, std::uint64_t& value) noexcept
+{
+    for (; n >= 8; n -= 8, p += 8)
+    {
+        const std::uint64_t chars = load_eight_chars(p);
+        if (leading_digit_count(chars) != 8)
+        {
+            return false;
+        }
+        value = value * 100000000 + parse_eight_digits(chars);
+    }
+
+    if (n == 0)
+    {
+        return true;
+    }
+
+    if ((p - lo) + n >= 8)
+    {
+        // The wanted digits are the top n bytes, and the bytes shifted in are never digits
+        const std::uint64_t chars = load_eight_chars(p + n - 8) >> static_cast<unsigned>(8 * (8 - n));
+        if (leading_digit_count(chars) != n)
+        {
+            return false;
+        }
+        value = value * padded_pow10[n] + parse_leading_digits(chars, n);
+        return true;
+    }
+
+    for (; n != 0; --n, ++p)
+    {
+        const auto digit = static_cast<unsigned char>(*p - '0');
+        if (digit > 9)
+        {
+            return false;
+        }
+        value = value * 10 + digit;
+    }
+    return true;
+}
+
+// The layout as seen by the vector lanes, which hold the first 16 characters of a record each
+struct fixed_width_simd_layout
+{
+    char shuffle[16];         // Moves the digits to the end of the lane and zeros the rest
+    std::uint64_t digits;     // Bits of the characters that have to be digits
+    std::uint64_t point;      // Bit of the decimal point
+    bool usable;
+};
+
+inline fixed_width_simd_layout make_fixed_width_simd_layout(const fixed_width_layout& layout, std::size_t width) noexcept
+{
+    fixed_width_simd_layout simd {};
+
+    // With at most 15 digits the significand is below 2^52
+    const int digits = layout.integer_digits + layout.fraction_digits;
+    simd.usable = layout.valid && width <= 16 && digits <= 15;
+    if (!simd.usable)
+    {
+        return simd;
+    }
+
+    int positions[16];
+    int n = 0;
+    const int integer_offset = layout.sign_column ? 1 : 0;
+    for (int i = 0; i < layout.integer_digits; ++i)
+    {
+        positions[n++] = integer_offset + i;
+    }
+    const int fraction_offset = integer_offset + layout.integer_digits + 1;
+    for (int i = 0; i < layout.fraction_digits; ++i)
+    {
+        positions[n++] = fraction_offset + i;
+    }
+
+    for (int i = 0; i < 16; ++i)
+    {
+        simd.shuffle[i] = static_cast<char>(0x80);
+    }
+    for (int i = 0; i < n; ++i)
+    {
+        simd.shuffle[16 - n + i] = static_cast<char>(positions[i]);
+        simd.digits |= UINT64_C(1) << positions[i];
+    }
+    if (layout.fraction_digits != 0)
+    {
+        simd.point = UINT64_C(1) << (fraction_offset - 1);
+    }
+
+    return simd;
+}
+
+// Checks the masks of digit and decimal point characters of records 16 bits apart
+BOOST_FORCEINLINE void match_fixed_width_lanes(std::uint64_t is_digit, std::uint64_t is_point, const fixed_width_simd_layout& simd,
+                                               bool* matched, std::size_t records) noexcept
+{
+    for (std::size_t i = 0; i < records; ++i, is_digit >>= 16, is_point >>= 16)
+    {
+        matched[i] = (is_digit & simd.digits) == simd.digits && (is_point & simd.point) == simd.point;
+    }
+}
+
+// Accepts the same leading blanks and plus sign as the fast path before handing the record to from_chars
+template <typename T>
+from_chars_result from_chars_record(const char* first, const char* last, T& value) noexcept
+{
+    while (first != last && *first == ' ')
+    {
+        ++first;
+    }
+    if (first != last && *first == '+' && last - first > 1 && *(first + 1) != '-')
+    {
+        ++first;
+    }
+
+    auto r = fast_float::from_chars(first, last, value, chars_format::general);
+    if (r.ec == std::errc() && r.ptr != last)
+    {
+        r.ec = std::errc::invalid_argument;
+    }
+    return r;
+}
+
+// Checked once for the whole batch instead of once per value
+template <typename T>
+inline bool fixed_width_clinger(const fixed_width_layout& layout) noexcept
+{
+    return fast_float::detail::rounds_to_nearest() &&
+           layout.fraction_digits <= -fast_float::binary_format<T>::min_exponent_fast_path();
+}
+
+// Checks and reads the significands of the n records starting at first, one record at a time
+BOOST_FORCEINLINE void decode_fixed_width_records(const char* first, std::size_t stride, const fixed_width_layout& layout, std::size_t n,
+                                                  std::uint64_t* significands, bool* negative, bool* matched) noexcept
+{
+    const int integer_offset = layout.sign_column ? 1 : 0;
+    const int fraction_offset = integer_offset + layout.integer_digits + 1;
+
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        const char* const rec = first + i * stride;
+        const char sign = layout.sign_column ? rec[0] : '\0';
+        std::uint64_t significand = 0;
+
+        matched[i] = layout.valid &&
+                     (!layout.sign_column || sign == '-' || sign == '+' || sign == ' ') &&
+                     (layout.fraction_digits == 0 || rec[fraction_offset - 1] == '.') &&
+                     parse_fixed_digits(rec, rec + integer_offset, layout.integer_digits, significand) &&
+                     parse_fixed_digits(rec, rec + fraction_offset, layout.fraction_digits, significand);
+
+        significands[i] = significand;
+        negative[i] = sign == '-';
+    }
+}
+
+// Converts the n decoded records starting at first. Records that did not match the layout go through from_chars,
+// and the result of the first one that fails is returned.
+template <typename T>
+BOOST_FORCEINLINE from_chars_result convert_fixed_width_records(const char* first, std::size_t width, std::size_t stride, const fixed_width_layout& layout,
+                                                                bool clinger, std::size_t n, const std::uint64_t* significands,
+                                                                const bool* negative, const bool* matched, T* values) noexcept
+{
+    using binary = fast_float::binary_format<T>;
+
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        const char* const rec = first + i * stride;
+        T& value = values[i];
+
+        if (BOOST_LIKELY(matched[i]))
+        {
+            if (clinger && significands[i] <= binary::max_mantissa_fast_path())
+            {
+                value = static_cast<T>(significands[i]) / binary::exact_power_of_ten(layout.fraction_digits);
+                if (negative[i])
+                {
+                    value = -value;
+                }
+                continue;
+            }
+
+            const fast_float::adjusted_mantissa am =
+                fast_float::compute_float<binary>(-layout.fraction_digits, significands[i]);
+            if (am.power2 >= 0)
+            {
+                fast_float::to_float(negative[i], am, value);
+                continue;
+            }
+        }
+
+        const auto r = from_chars_record(rec, rec + width, value);
+        if (r.ec != std::errc())
+        {
+            return r;
+        }
+    }
+
+    return {first, std::errc()};
+}
+
+// The scalar version, used where the CPU has none of the instruction sets of the vector kernels
+template <typename T>
+from_chars_result from_chars_fixed_width(const char* first, std::size_t width, std::size_t stride, T* values, std::size_t count) noexcept
+{
+    if (count == 0)
+    {
+        return {first, std::errc()};
+    }
+
+    const fixed_width_layout layout = analyze_fixed_width_layout(first, width);
+    const bool clinger = fixed_width_clinger<T>(layout);
+
+    // A block of records is decoded before any of them is converted, so that the independent
+    // digit extractions and multiplications can overlap
+    constexpr std::size_t lanes = 4;
+    std::uint64_t significands[lanes];
+    bool negative[lanes];
+    bool matched[lanes];
+
+    for (std::size_t block = 0; block < count; block += lanes)
+    {
+        const std::size_t n = count - block < lanes ? count - block : lanes;
+        const char* const rec = first + block * stride;
+
+        decode_fixed_width_records(rec, stride, layout, n, significands, negative, matched);
+        const auto r = convert_fixed_width_records(rec, width, stride, layout, clinger, n, significands, negative, matched, values + block);
+        if (r.ec != std::errc())
+        {
+            return r;
+        }
+    }
+
+    return {first + (count - 1) * stride + width, std::errc()};
+}
+
+}}} // Namespaces
+
+#endif // BOOST_CHARCONV_DETAIL_FIXED_WIDTH_RECORDS_HPP
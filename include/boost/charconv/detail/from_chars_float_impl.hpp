@@ -11,6 +11,7 @@
 #include <boost/charconv/detail/parser.hpp>
 #include <boost/charconv/detail/compute_float32.hpp>
 #include <boost/charconv/detail/compute_float64.hpp>
+#include <boost/charconv/detail/profile.hpp>
 #include <boost/charconv/chars_format.hpp>
 #include <system_error>
 #include <cstdlib>
@@ -92,6 +93,8 @@ from_chars_result from_chars_strtod_impl(const char* first, const char* last, T&
 template <typename T>
 inline from_chars_result from_chars_strtod(const char* first, const char* last, T& value) noexcept
 {
+    BOOST_CHARCONV_PROFILE_PATH(from_chars_strtod);
+
     if (last - first < 1024)
     {
         char buffer[1024];
@@ -230,6 +233,7 @@ from_chars_result from_chars_float_impl(const char* first, const char* last, T&
     }
     else
     {
+        BOOST_CHARCONV_PROFILE_PATH(from_chars_compute_float);
         value = return_val;
     }
 
@@ -9,6 +9,7 @@
 #include <boost/charconv/detail/config.hpp>
 #include <boost/charconv/detail/from_chars_result.hpp>
 #include <boost/charconv/detail/emulated128.hpp>
+#include <boost/charconv/detail/padded_digits.hpp>
 #include <boost/charconv/config.hpp>
 #include <boost/config.hpp>
 #include <system_error>
@@ -234,6 +235,233 @@ BOOST_CXX14_CONSTEXPR from_chars_result from_chars_integer_impl(const char* firs
     return {next, std::errc()};
 }
 
+// Base 10 fast path of from_chars_padded: the digits are read eight at a time and may load up to
+// eight characters past last. Everything the 64-bit accumulator can not hold exactly is handed to
+// from_chars_integer_impl, which is also the path for the other bases.
+template <typename Integer, typename Unsigned_Integer>
+inline from_chars_result from_chars_integer_padded(const char* first, const char* last, Integer& value, int base) noexcept
+{
+    static_assert(sizeof(Unsigned_Integer) <= sizeof(std::uint64_t), "Padded parsing is limited to 64-bit integers");
+
+    if (base != 10 || !(first < last))
+    {
+        return from_chars_integer_impl<Integer, Unsigned_Integer>(first, last, value, base);
+    }
+
+    bool is_negative = false;
+    auto next = first;
+
+    if (*next == '-')
+    {
+        BOOST_IF_CONSTEXPR (!std::is_signed<Integer>::value)
+        {
+            return {first, std::errc::invalid_argument};
+        }
+
+        is_negative = true;
+        ++next;
+    }
+    else if (*next == '+')
+    {
+        return {first, std::errc::invalid_argument};
+    }
+
+    std::uint64_t result = 0;
+    const auto digits_end = parse_digit_run_padded(next, last, result);
+    const auto digit_count = digits_end - next;
+
+    if (digit_count == 0 || digit_count > std::numeric_limits<std::uint64_t>::digits10)
+    {
+        // Inputs without digits, long runs of leading zeros, and values that overflow
+        return from_chars_integer_impl<Integer, Unsigned_Integer>(first, last, value, base);
+    }
+
+    auto max_value = static_cast<std::uint64_t>((std::numeric_limits<Integer>::max)());
+    if (is_negative)
+    {
+        ++max_value;
+    }
+
+    if (result > max_value)
+    {
+        return {digits_end, std::errc::result_out_of_range};
+    }
+
+    value = static_cast<Integer>(result);
+    if (is_negative)
+    {
+        value = static_cast<Integer>(-(static_cast<Unsigned_Integer>(value)));
+    }
+
+    return {digits_end, std::errc()};
+}
+
+static constexpr std::uint64_t chunk_pow10[] = {
+    UINT64_C(1), UINT64_C(10), UINT64_C(100), UINT64_C(1000), UINT64_C(10000), UINT64_C(100000),
+    UINT64_C(1000000), UINT64_C(10000000), UINT64_C(100000000), UINT64_C(1000000000), UINT64_C(10000000000),
+    UINT64_C(100000000000), UINT64_C(1000000000000), UINT64_C(10000000000000), UINT64_C(100000000000000),
+    UINT64_C(1000000000000000), UINT64_C(10000000000000000), UINT64_C(100000000000000000),
+    UINT64_C(1000000000000000000), UINT64_C(10000000000000000000)
+};
+
+// Sets high:low to high:low * power + chunk with chunk < power.
+// Returns false if the result does not fit into 128 bits, in which case high:low is garbage.
+BOOST_CHARCONV_CXX14_CONSTEXPR bool mul_add_chunk(std::uint64_t& high, std::uint64_t& low, std::uint64_t power, std::uint64_t chunk) noexcept
+{
+    #ifdef BOOST_CHARCONV_HAS_INT128
+
+    const auto low_product = static_cast<boost::uint128_type>(low) * power + chunk;
+    const auto high_product = static_cast<boost::uint128_type>(high) * power + static_cast<std::uint64_t>(low_product >> 64);
+
+    low = static_cast<std::uint64_t>(low_product);
+    high = static_cast<std::uint64_t>(high_product);
+
+    return (high_product >> 64) == 0;
+
+    #else
+
+    // 32-bit halves so that it stays usable in constant expressions
+    const std::uint64_t a = low >> 32;
+    const std::uint64_t b = low & UINT32_MAX;
+    const std::uint64_t c = power >> 32;
+    const std::uint64_t d = power & UINT32_MAX;
+
+    const std::uint64_t bd = b * d;
+    const std::uint64_t ad = a * d;
+    const std::uint64_t bc = b * c;
+    const std::uint64_t middle = (bd >> 32) + (ad & UINT32_MAX) + (bc & UINT32_MAX);
+
+    std::uint64_t product_low = (middle << 32) | (bd & UINT32_MAX);
+    std::uint64_t carry = a * c + (ad >> 32) + (bc >> 32) + (middle >> 32);
+
+    product_low += chunk;
+    carry += product_low < chunk ? 1 : 0;
+
+    // Only the low 64 bits of high * power may be non-zero
+    if (high != 0 && power > UINT64_MAX / high)
+    {
+        return false;
+    }
+
+    const std::uint64_t product_high = high * power + carry;
+    if (product_high < carry)
+    {
+        return false;
+    }
+
+    low = product_low;
+    high = product_high;
+
+    return true;
+
+    #endif
+}
+
+// Base 10 path of the 128-bit from_chars overloads. Runs of up to 19 digits are accumulated in a 64-bit
+// integer and appended to the 128-bit value with one multiply-add each, so overflow is only checked at
+// chunk boundaries rather than for every character. Other bases go to from_chars_integer_impl.
+template <typename Integer, typename Unsigned_Integer>
+BOOST_CXX14_CONSTEXPR from_chars_result from_chars_integer128_impl(const char* first, const char* last, Integer& value, int base) noexcept
+{
+    if (base != 10 || !(first < last))
+    {
+        return from_chars_integer_impl<Integer, Unsigned_Integer>(first, last, value, base);
+    }
+
+    #ifdef BOOST_CHARCONV_HAS_INT128
+    constexpr bool is_signed_integer = std::is_same<Integer, boost::int128_type>::value || std::is_signed<Integer>::value;
+    #else
+    constexpr bool is_signed_integer = std::is_signed<Integer>::value;
+    #endif
+
+    BOOST_ATTRIBUTE_UNUSED bool is_negative = false;
+    auto next = first;
+
+    if (*next == '-')
+    {
+        BOOST_IF_CONSTEXPR (!is_signed_integer)
+        {
+            return {first, std::errc::invalid_argument};
+        }
+
+        is_negative = true;
+        ++next;
+    }
+    else if (*next == '+')
+    {
+        return {first, std::errc::invalid_argument};
+    }
+
+    const auto digits_begin = next;
+    constexpr int chunk_digits = std::numeric_limits<std::uint64_t>::digits10;
+
+    std::uint64_t high = 0;
+    std::uint64_t low = 0;
+    bool overflowed = false;
+
+    while (next != last)
+    {
+        std::uint64_t chunk = 0;
+        int n = 0;
+
+        for (; n < chunk_digits && next != last; ++n)
+        {
+            const auto current_digit = static_cast<unsigned char>(*next - '0');
+            if (current_digit > 9)
+            {
+                break;
+            }
+
+            chunk = chunk * 10 + current_digit;
+            ++next;
+        }
+
+        // Once overflowed the remaining digits are only consumed
+        if (n != 0 && !overflowed)
+        {
+            overflowed = !mul_add_chunk(high, low, chunk_pow10[n], chunk);
+        }
+
+        if (n != chunk_digits)
+        {
+            break;
+        }
+    }
+
+    if (next == digits_begin)
+    {
+        // Inputs without digits, including a lone sign
+        return from_chars_integer_impl<Integer, Unsigned_Integer>(first, last, value, base);
+    }
+
+    BOOST_IF_CONSTEXPR (is_signed_integer)
+    {
+        // The magnitude is at most 2^127 - 1, or 2^127 if negative
+        constexpr std::uint64_t sign_bit = UINT64_C(1) << 63;
+        if (high >= sign_bit && !(is_negative && high == sign_bit && low == 0))
+        {
+            overflowed = true;
+        }
+    }
+
+    if (overflowed)
+    {
+        return {next, std::errc::result_out_of_range};
+    }
+
+    const auto result = static_cast<Unsigned_Integer>((static_cast<Unsigned_Integer>(high) << 64) | low);
+    value = static_cast<Integer>(result);
+    BOOST_IF_CONSTEXPR (is_signed_integer)
+    {
+        if (is_negative)
+        {
+            value = static_cast<Integer>(-result);
+        }
+    }
+
+    return {next, std::errc()};
+}
+
 #ifdef BOOST_MSVC
 # pragma warning(pop)
 #elif defined(__clang__) && defined(__APPLE__)
@@ -250,18 +478,25 @@ BOOST_CHARCONV_GCC5_CONSTEXPR from_chars_result from_chars(const char* first, co
     return detail::from_chars_integer_impl<Integer, Unsigned_Integer>(first, last, value, base);
 }
 
+template <typename Integer>
+inline from_chars_result from_chars_padded(const char* first, const char* last, Integer& value, int base = 10) noexcept
+{
+    using Unsigned_Integer = typename std::make_unsigned<Integer>::type;
+    return detail::from_chars_integer_padded<Integer, Unsigned_Integer>(first, last, value, base);
+}
+
 #ifdef BOOST_CHARCONV_HAS_INT128
 template <typename Integer>
 BOOST_CHARCONV_GCC5_CONSTEXPR from_chars_result from_chars128(const char* first, const char* last, Integer& value, int base = 10) noexcept
 {
     using Unsigned_Integer = boost::uint128_type;
-    return detail::from_chars_integer_impl<Integer, Unsigned_Integer>(first, last, value, base);
+    return detail::from_chars_integer128_impl<Integer, Unsigned_Integer>(first, last, value, base);
 }
 #endif
 
 BOOST_CHARCONV_GCC5_CONSTEXPR from_chars_result from_chars128(const char* first, const char* last, uint128& value, int base = 10) noexcept
 {
-    return from_chars_integer_impl<uint128, uint128>(first, last, value, base);
+    return from_chars_integer128_impl<uint128, uint128>(first, last, value, base);
 }
 
 }}} // Namespaces
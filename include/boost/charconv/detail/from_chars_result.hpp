@@ -6,6 +6,8 @@
 #define BOOST_CHARCONV_DETAIL_FROM_CHARS_RESULT_HPP
 
 #include <system_error>
+#include <cstdint>
+#include <cstddef>
 
 namespace boost { namespace charconv {
 
@@ -34,6 +36,38 @@ struct from_chars_result_t
 };
 using from_chars_result = from_chars_result_t<char>;
 
+// Result of from_chars_ext: the from_chars_result together with what the text said about the number
+struct from_chars_ext_result
+{
+    const char* ptr;
+    std::errc ec;
+
+    // Number of significant digits in the matched text, not counting leading and trailing zeros
+    std::size_t digits;
+
+    // The matched text is the integer made of those digits multiplied by 10^exponent
+    std::int64_t exponent;
+
+    // True if the stored value is exactly the number written in the text
+    bool exact;
+
+    constexpr operator from_chars_result() const noexcept
+    {
+        return {ptr, ec};
+    }
+
+    friend constexpr bool operator==(const from_chars_ext_result& lhs, const from_chars_ext_result& rhs) noexcept
+    {
+        return lhs.ptr == rhs.ptr && lhs.ec == rhs.ec && lhs.digits == rhs.digits &&
+               lhs.exponent == rhs.exponent && lhs.exact == rhs.exact;
+    }
+
+    friend constexpr bool operator!=(const from_chars_ext_result& lhs, const from_chars_ext_result& rhs) noexcept
+    {
+        return !(lhs == rhs); // NOLINT : Expression can not be simplified since this is the definition
+    }
+};
+
 }} // Namespaces
 
 #endif // BOOST_CHARCONV_DETAIL_FROM_CHARS_RESULT_HPP
@@ -0,0 +1,100 @@
+// Copyright 2023 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_CHARCONV_DETAIL_PADDED_DIGITS_HPP
+#define BOOST_CHARCONV_DETAIL_PADDED_DIGITS_HPP
+
+#include <boost/charconv/detail/config.hpp>
+#include <boost/core/bit.hpp>
+#include <cstdint>
+#include <cstring>
+
+// Digit scanning for inputs that are followed by readable padding.
+// Eight characters are loaded at once and the end of the digit run, or the end of the input,
+// is found with a mask rather than by testing each character against last.
+
+namespace boost { namespace charconv { namespace detail {
+
+// Loads eight characters with the first character in the lowest byte regardless of endianness
+BOOST_FORCEINLINE std::uint64_t load_eight_chars(const char* p) noexcept
+{
+    std::uint64_t val;
+    std::memcpy(&val, p, sizeof(val));
+
+    #if BOOST_CHARCONV_ENDIAN_BIG_BYTE
+    val = ((val & UINT64_C(0xFF00000000000000)) >> 56) | ((val & UINT64_C(0x00FF000000000000)) >> 40) |
+          ((val & UINT64_C(0x0000FF0000000000)) >> 24) | ((val & UINT64_C(0x000000FF00000000)) >> 8)  |
+          ((val & UINT64_C(0x00000000FF000000)) << 8)  | ((val & UINT64_C(0x0000000000FF0000)) << 24) |
+          ((val & UINT64_C(0x000000000000FF00)) << 40) | ((val & UINT64_C(0x00000000000000FF)) << 56);
+    #endif
+
+    return val;
+}
+
+// Number of characters before the first one that is not in '0'-'9'.
+// A borrow or carry can only start at a non-digit and only moves towards higher bytes,
+// so the lowest flagged byte is always exact.
+BOOST_FORCEINLINE int leading_digit_count(std::uint64_t chars) noexcept
+{
+    const std::uint64_t non_digits = ((chars + UINT64_C(0x4646464646464646)) | (chars - UINT64_C(0x3030303030303030))) &
+                                     UINT64_C(0x8080808080808080);
+
+    return non_digits == 0 ? 8 : boost::core::countr_zero(non_digits) / 8;
+}
+
+// Value of eight ASCII digits
+BOOST_FORCEINLINE std::uint32_t parse_eight_digits(std::uint64_t chars) noexcept
+{
+    constexpr std::uint64_t mask = UINT64_C(0x000000FF000000FF);
+    constexpr std::uint64_t mul1 = UINT64_C(0x000F424000000064); // 100 + (1000000ULL << 32)
+    constexpr std::uint64_t mul2 = UINT64_C(0x0000271000000001); // 1 + (10000ULL << 32)
+    chars -= UINT64_C(0x3030303030303030);
+    chars = (chars * 10) + (chars >> 8);
+    chars = (((chars & mask) * mul1) + (((chars >> 16) & mask) * mul2)) >> 32;
+    return static_cast<std::uint32_t>(chars);
+}
+
+// Value of the first n (1-7) digits, found by shifting them to the top of the word and filling the bottom with '0'
+BOOST_FORCEINLINE std::uint32_t parse_leading_digits(std::uint64_t chars, int n) noexcept
+{
+    const auto shift = static_cast<unsigned>(8 * (8 - n));
+    return parse_eight_digits((chars << shift) | (UINT64_C(0x3030303030303030) >> (64 - shift)));
+}
+
+static constexpr std::uint32_t padded_pow10[] = {1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000};
+
+// Appends the run of decimal digits in [p, last) to value and returns the end of the run.
+// At least eight characters past last must be readable. Like the fast_float loops the value
+// silently wraps on overflow, so callers must bound the number of digits consumed.
+BOOST_FORCEINLINE const char* parse_digit_run_padded(const char* p, const char* last, std::uint64_t& value) noexcept
+{
+    for (;;)
+    {
+        const std::uint64_t chars = load_eight_chars(p);
+        int n = leading_digit_count(chars);
+        if (n > last - p)
+        {
+            n = static_cast<int>(last - p);
+        }
+
+        if (n == 8)
+        {
+            value = value * 100000000 + parse_eight_digits(chars);
+            p += 8;
+            continue;
+        }
+
+        if (n != 0)
+        {
+            value = value * padded_pow10[n] + parse_leading_digits(chars, n);
+            p += n;
+        }
+
+        return p;
+    }
+}
+
+}}} // Namespaces
+
+#endif // BOOST_CHARCONV_DETAIL_PADDED_DIGITS_HPP
@@ -0,0 +1,55 @@
+// Copyright 2023 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_CHARCONV_DETAIL_PROFILE_HPP
+#define BOOST_CHARCONV_DETAIL_PROFILE_HPP
+
+// Counters of the internal paths taken by the floating point conversions, read by tools/charconv_profile.
+// They only exist when BOOST_CHARCONV_PROFILE is defined for the library and every translation unit that
+// uses it, since the float and double conversions are inline. Otherwise the hooks expand to nothing.
+
+#ifdef BOOST_CHARCONV_PROFILE
+
+#include <cstddef>
+#include <cstdint>
+
+namespace boost { namespace charconv { namespace detail {
+
+enum class profile_path : unsigned
+{
+    from_chars_clinger,             // Exact significand and power of ten in a double or float
+    from_chars_eisel_lemire,        // 128-bit product with the power of five, rounding decided
+    from_chars_digit_comparison,    // Big integer comparison of the digits with the halfway point
+    from_chars_compute_float,       // compute_float32/64/80 of the generic parser (hex and long double)
+    from_chars_strtod,              // strtod, strtof or strtold fallback of the generic parser
+    to_chars_integer,               // Shortest output of an integral value below 2^64 in general or fixed format
+    to_chars_dragonbox_fixed,       // Shortest output in general or fixed format with Dragonbox digits
+    to_chars_dragonbox,             // Shortest output in scientific format, or outside the fixed range
+    to_chars_floff,                 // Output with a precision
+    to_chars_floff_segment,         // Each digit segment that floff computed with the extended cache
+    to_chars_floff_cache_block,     // Each 64-bit extended cache block loaded for those segments
+    to_chars_hex,                   // Hexadecimal format
+    count
+};
+
+inline std::uint64_t* profile_counters() noexcept
+{
+    static std::uint64_t counters[static_cast<std::size_t>(profile_path::count)] {};
+    return counters;
+}
+
+}}} // Namespaces
+
+#define BOOST_CHARCONV_PROFILE_COUNT(path, n) \
+    static_cast<void>(::boost::charconv::detail::profile_counters()[static_cast<std::size_t>(::boost::charconv::detail::profile_path::path)] += (n))
+
+#else
+
+#define BOOST_CHARCONV_PROFILE_COUNT(path, n) static_cast<void>(0)
+
+#endif // BOOST_CHARCONV_PROFILE
+
+#define BOOST_CHARCONV_PROFILE_PATH(path) BOOST_CHARCONV_PROFILE_COUNT(path, 1)
+
+#endif // BOOST_CHARCONV_DETAIL_PROFILE_HPP
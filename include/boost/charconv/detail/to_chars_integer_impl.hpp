@@ -7,6 +7,7 @@
 #ifndef BOOST_CHARCONV_DETAIL_TO_CHARS_INTEGER_IMPL_HPP
 #define BOOST_CHARCONV_DETAIL_TO_CHARS_INTEGER_IMPL_HPP
 
+#include <boost/charconv/detail/apply_sign.hpp>
 #include <boost/charconv/detail/config.hpp>
 #include <boost/charconv/detail/memcpy.hpp>
 #include <boost/charconv/detail/to_chars_result.hpp>
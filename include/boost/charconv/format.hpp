@@ -0,0 +1,587 @@
+// Copyright 2023 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_CHARCONV_FORMAT_HPP
+#define BOOST_CHARCONV_FORMAT_HPP
+
+#include <boost/charconv/to_chars.hpp>
+#include <boost/charconv/limits.hpp>
+#include <boost/charconv/chars_format.hpp>
+#include <boost/charconv/detail/config.hpp>
+#include <boost/config.hpp>
+#include <system_error>
+#include <type_traits>
+#include <stdexcept>
+#include <limits>
+#include <memory>
+#include <iterator>
+#include <utility>
+#include <cstddef>
+#include <cstdlib>
+#include <climits>
+
+#if !defined(BOOST_NO_CXX20_HDR_FORMAT) && defined(__has_include)
+#  if __has_include(<format>) && defined(BOOST_CXX_VERSION) && BOOST_CXX_VERSION >= 202002L
+#    include <format>
+#    if defined(__cpp_lib_format) && __cpp_lib_format >= 201907L
+#      define BOOST_CHARCONV_HAS_STD_FORMAT
+#    endif
+#  endif
+#endif
+
+namespace boost { namespace charconv {
+
+namespace detail {
+
+// Parsed representation of the standard format specification:
+// [[fill]align][sign]['#']['0'][width]['.' precision][type]
+struct format_spec
+{
+    char fill;
+    char align; // '<', '>', '^' or 0 for the default of the type
+    char sign;  // '-', '+' or ' '
+    bool alternate;
+    bool zero_pad;
+    int width;
+    int precision;
+    char type;
+
+    constexpr format_spec() noexcept
+        : fill {' '}, align {}, sign {'-'}, alternate {}, zero_pad {}, width {}, precision {-1}, type {}
+    {}
+};
+
+BOOST_NORETURN inline void throw_format_error(const char* msg)
+{
+    #ifndef BOOST_NO_EXCEPTIONS
+    #  ifdef BOOST_CHARCONV_HAS_STD_FORMAT
+    throw std::format_error(msg);
+    #  else
+    throw std::runtime_error(msg);
+    #  endif
+    #else
+    (void)msg;
+    std::abort();
+    #endif
+}
+
+constexpr bool is_format_align(char c) noexcept
+{
+    return c == '<' || c == '>' || c == '^';
+}
+
+template <typename Iter>
+BOOST_CHARCONV_CXX14_CONSTEXPR Iter parse_format_int(Iter first, Iter last, int& value)
+{
+    value = 0;
+    while (first != last && *first >= '0' && *first <= '9')
+    {
+        if (value > (INT_MAX - 9) / 10)
+        {
+            throw_format_error("boost::charconv::formatter: number is too big");
+        }
+
+        value = value * 10 + (*first - '0');
+        ++first;
+    }
+
+    return first;
+}
+
+// Parses the spec in [first, last) stopping at the closing brace.
+// Dynamic width and precision (nested replacement fields) are not supported
+template <typename Iter>
+BOOST_CHARCONV_CXX14_CONSTEXPR Iter parse_format_spec(Iter first, Iter last, format_spec& spec, bool is_floating)
+{
+    if (first == last || *first == '}')
+    {
+        return first;
+    }
+
+    // Fill and align
+    auto next = first;
+    ++next;
+    if (next != last && is_format_align(*next) && *first != '{' && *first != '}')
+    {
+        spec.fill = *first;
+        spec.align = *next;
+        first = ++next;
+    }
+    else if (is_format_align(*first))
+    {
+        spec.align = *first;
+        ++first;
+    }
+
+    // Sign
+    if (first != last && (*first == '+' || *first == '-' || *first == ' '))
+    {
+        spec.sign = *first;
+        ++first;
+    }
+
+    // Alternate form
+    if (first != last && *first == '#')
+    {
+        if (is_floating)
+        {
+            throw_format_error("boost::charconv::formatter: alternate form is not supported for floating point types");
+        }
+
+        spec.alternate = true;
+        ++first;
+    }
+
+    // Zero padding is ignored if an alignment has been given
+    if (first != last && *first == '0')
+    {
+        spec.zero_pad = spec.align == 0;
+        ++first;
+    }
+
+    // Width
+    if (first != last && *first == '{')
+    {
+        throw_format_error("boost::charconv::formatter: dynamic width is not supported");
+    }
+    first = parse_format_int(first, last, spec.width);
+
+    // Precision
+    if (first != last && *first == '.')
+    {
+        ++first;
+        if (!is_floating)
+        {
+            throw_format_error("boost::charconv::formatter: precision is not allowed for integer types");
+        }
+        if (first == last || *first < '0' || *first > '9')
+        {
+            throw_format_error("boost::charconv::formatter: missing precision");
+        }
+        first = parse_format_int(first, last, spec.precision);
+    }
+
+    if (first != last && *first == 'L')
+    {
+        throw_format_error("boost::charconv::formatter: locale specific formatting is not supported");
+    }
+
+    // Type
+    if (first != last && *first != '}')
+    {
+        const char type = *first;
+        const bool valid = is_floating ? (type == 'e' || type == 'E' || type == 'f' || type == 'F' ||
+                                          type == 'g' || type == 'G' || type == 'a' || type == 'A') :
+                                         (type == 'd' || type == 'x' || type == 'X' || type == 'o' ||
+                                          type == 'b' || type == 'B');
+        if (!valid)
+        {
+            throw_format_error("boost::charconv::formatter: invalid type specifier");
+        }
+
+        spec.type = type;
+        ++first;
+    }
+
+    if (first != last && *first != '}')
+    {
+        throw_format_error("boost::charconv::formatter: invalid format specification");
+    }
+
+    return first;
+}
+
+inline void format_to_upper(char* first, char* last) noexcept
+{
+    for (; first != last; ++first)
+    {
+        if (*first >= 'a' && *first <= 'z')
+        {
+            *first = static_cast<char>(*first - ('a' - 'A'));
+        }
+    }
+}
+
+// Describes the formatted value as [sign][prefix][digits] so padding can be applied
+struct formatted_parts
+{
+    char prefix[3];
+    std::size_t prefix_len;
+    const char* digits;
+    std::size_t digits_len;
+    bool finite;
+};
+
+template <typename OutputIt>
+OutputIt fill_n_chars(OutputIt out, std::size_t n, char c)
+{
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        *out++ = c;
+    }
+    return out;
+}
+
+template <typename OutputIt>
+OutputIt copy_chars(OutputIt out, const char* first, std::size_t n)
+{
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        *out++ = first[i];
+    }
+    return out;
+}
+
+template <typename OutputIt>
+OutputIt write_padded(OutputIt out, const formatted_parts& parts, const format_spec& spec)
+{
+    const std::size_t size = parts.prefix_len + parts.digits_len;
+    const std::size_t padding = spec.width > 0 && static_cast<std::size_t>(spec.width) > size ?
+                                static_cast<std::size_t>(spec.width) - size : 0;
+
+    // Zeros go between the sign/prefix and the digits, and are never applied to inf or nan
+    if (spec.zero_pad && parts.finite)
+    {
+        out = copy_chars(out, parts.prefix, parts.prefix_len);
+        out = fill_n_chars(out, padding, '0');
+        return copy_chars(out, parts.digits, parts.digits_len);
+    }
+
+    std::size_t left_padding = 0;
+    switch (spec.align)
+    {
+        case '<':
+            break;
+        case '^':
+            left_padding = padding / 2;
+            break;
+        default:
+            left_padding = padding;
+            break;
+    }
+
+    out = fill_n_chars(out, left_padding, spec.fill);
+    out = copy_chars(out, parts.prefix, parts.prefix_len);
+    out = copy_chars(out, parts.digits, parts.digits_len);
+    return fill_n_chars(out, padding - left_padding, spec.fill);
+}
+
+// Moves the leading '-' produced by to_chars into the prefix, and applies the user requested sign
+inline void apply_format_sign(formatted_parts& parts, const format_spec& spec) noexcept
+{
+    if (parts.digits_len != 0 && *parts.digits == '-')
+    {
+        parts.prefix[parts.prefix_len++] = '-';
+        ++parts.digits;
+        --parts.digits_len;
+    }
+    else if (spec.sign != '-')
+    {
+        parts.prefix[parts.prefix_len++] = spec.sign;
+    }
+}
+
+template <typename T>
+to_chars_result to_chars_formatted(char* first, char* last, T value, const format_spec& spec, std::true_type /*is_integral*/) noexcept
+{
+    int base = 10;
+    switch (spec.type)
+    {
+        case 'x':
+        case 'X':
+            base = 16;
+            break;
+        case 'o':
+            base = 8;
+            break;
+        case 'b':
+        case 'B':
+            base = 2;
+            break;
+        default:
+            break;
+    }
+
+    auto r = boost::charconv::to_chars(first, last, value, base);
+    if (r.ec == std::errc() && spec.type == 'X')
+    {
+        format_to_upper(first, r.ptr);
+    }
+
+    return r;
+}
+
+// The text of std::to_chars(first, last, value, fmt, precision), or std::to_chars(first, last, value) for the shortest
+// representation (general and a negative precision), and std::to_chars(first, last, value, chars_format::hex)
+// for the shortest hex digits (hex and a negative precision).
+BOOST_CHARCONV_DECL to_chars_result to_chars_standard(char* first, char* last, float value, chars_format fmt, int precision) noexcept;
+BOOST_CHARCONV_DECL to_chars_result to_chars_standard(char* first, char* last, double value, chars_format fmt, int precision) noexcept;
+BOOST_CHARCONV_DECL to_chars_result to_chars_standard(char* first, char* last, long double value, chars_format fmt, int precision) noexcept;
+
+// The narrowest of float, double and long double that holds every value of T
+template <typename T>
+using standard_float_type = typename std::conditional<std::numeric_limits<T>::digits <= std::numeric_limits<float>::digits, float,
+                            typename std::conditional<std::numeric_limits<T>::digits <= std::numeric_limits<double>::digits, double,
+                                                      long double>::type>::type;
+
+template <typename T>
+to_chars_result to_chars_formatted(char* first, char* last, T value, const format_spec& spec, std::false_type /*is_integral*/) noexcept
+{
+    chars_format fmt = chars_format::general;
+    int precision = spec.precision;
+
+    // The std::format rules: e, f, and g default to a precision of 6, a without a precision gives the shortest hex digits,
+    // and no type gives the shortest representation or general notation with the given precision
+    switch (spec.type)
+    {
+        case 'e':
+        case 'E':
+            fmt = chars_format::scientific;
+            precision = precision == -1 ? 6 : precision;
+            break;
+        case 'f':
+        case 'F':
+            fmt = chars_format::fixed;
+            precision = precision == -1 ? 6 : precision;
+            break;
+        case 'g':
+        case 'G':
+            precision = precision == -1 ? 6 : precision;
+            break;
+        case 'a':
+        case 'A':
+            fmt = chars_format::hex;
+            break;
+        default:
+            break;
+    }
+
+    auto r = to_chars_standard(first, last, static_cast<standard_float_type<T>>(value), fmt, precision);
+    if (r.ec == std::errc() && spec.type >= 'A' && spec.type <= 'Z')
+    {
+        format_to_upper(first, r.ptr);
+    }
+
+    return r;
+}
+
+// Upper bound on the number of characters to_chars_formatted can write (sign included)
+template <typename T>
+constexpr std::size_t formatted_buffer_size(const format_spec& spec) noexcept
+{
+    return std::is_integral<T>::value ? static_cast<std::size_t>(limits<T>::max_chars) + 1 :
+           static_cast<std::size_t>(limits<T>::max_chars10) + 1 +
+           (spec.precision > 0 ? static_cast<std::size_t>(spec.precision) : 6U) +
+           (spec.type == 'f' || spec.type == 'F' || spec.type == 'g' || spec.type == 'G' || spec.precision != -1 ?
+            static_cast<std::size_t>(std::numeric_limits<T>::max_exponent10) : 0U);
+}
+
+template <typename T>
+void make_formatted_parts(formatted_parts& parts, const char* first, const char* last, T value, const format_spec& spec) noexcept
+{
+    parts.prefix_len = 0;
+    parts.digits = first;
+    parts.digits_len = static_cast<std::size_t>(last - first);
+    parts.finite = true;
+
+    apply_format_sign(parts, spec);
+
+    BOOST_IF_CONSTEXPR (std::is_integral<T>::value)
+    {
+        if (spec.alternate)
+        {
+            switch (spec.type)
+            {
+                case 'x':
+                case 'X':
+                case 'b':
+                case 'B':
+                    parts.prefix[parts.prefix_len++] = '0';
+                    parts.prefix[parts.prefix_len++] = spec.type;
+                    break;
+                case 'o':
+                    if (value != 0)
+                    {
+                        parts.prefix[parts.prefix_len++] = '0';
+                    }
+                    break;
+                default:
+                    break;
+            }
+        }
+    }
+    else
+    {
+        // inf and nan are the only values whose text starts with a letter
+        const char c = parts.digits_len != 0 ? parts.digits[0] : '0';
+        parts.finite = (c >= '0' && c <= '9');
+    }
+}
+
+// Formats into a stack buffer (or a heap buffer for large precisions) and copies the result to out
+template <typename T, typename OutputIt>
+OutputIt write_formatted_copy(OutputIt out, T value, const format_spec& spec)
+{
+    constexpr std::size_t stack_size = 128;
+    char stack_buffer[stack_size];
+    std::unique_ptr<char[]> heap_buffer;
+
+    const std::size_t buffer_size = formatted_buffer_size<T>(spec);
+    char* buffer = stack_buffer;
+    if (buffer_size > stack_size)
+    {
+        heap_buffer.reset(new char[buffer_size]);
+        buffer = heap_buffer.get();
+    }
+
+    const auto r = to_chars_formatted(buffer, buffer + buffer_size, value, spec, std::is_integral<T>{});
+    if (r.ec != std::errc())
+    {
+        throw_format_error("boost::charconv::formatter: conversion failed");
+    }
+
+    formatted_parts parts;
+    make_formatted_parts(parts, buffer, r.ptr, value, spec);
+    return write_padded(out, parts, spec);
+}
+
+// The container of a std::back_insert_iterator, which is a protected member
+template <typename Container>
+Container& back_insert_container(const std::back_insert_iterator<Container>& it) noexcept
+{
+    struct accessor : std::back_insert_iterator<Container>
+    {
+        explicit accessor(const std::back_insert_iterator<Container>& base) : std::back_insert_iterator<Container>(base) {}
+        using std::back_insert_iterator<Container>::container;
+    };
+
+    return *accessor(it).container;
+}
+
+// Resizes a contiguous container of char, such as std::string, std::vector<char> or the buffer of fmt::appender.
+// Returns false if the container could not grow to size.
+template <typename Container>
+auto resize_char_container(Container& c, std::size_t size, int) -> decltype(c.try_resize(size), bool())
+{
+    c.try_resize(size);
+    return c.size() == size;
+}
+
+template <typename Container>
+auto resize_char_container(Container& c, std::size_t size, long) -> decltype(c.resize(size), bool())
+{
+    c.resize(size);
+    return true;
+}
+
+template <typename Container, typename = void>
+struct is_char_container : std::false_type {};
+
+template <typename Container>
+struct is_char_container<Container, decltype(void(resize_char_container(std::declval<Container&>(), 0, 0)), void(std::declval<Container&>().data()))>
+    : std::integral_constant<bool, std::is_same<typename std::remove_cv<typename std::remove_pointer<
+                                   decltype(std::declval<Container&>().data())>::type>::type, char>::value> {};
+
+// Formats straight into the storage of c: the value is converted past room for the padding and prefix,
+// and then moved down into place. Returns false if c can not hold the upper bound of the output.
+template <typename T, typename Container>
+bool write_formatted_in_place(Container& c, T value, const format_spec& spec)
+{
+    const std::size_t old_size = c.size();
+    const std::size_t offset = (spec.width > 0 ? static_cast<std::size_t>(spec.width) : 0U) + sizeof(formatted_parts::prefix);
+    const std::size_t buffer_size = formatted_buffer_size<T>(spec);
+
+    if (!resize_char_container(c, old_size + offset + buffer_size, 0))
+    {
+        resize_char_container(c, old_size, 0);
+        return false;
+    }
+
+    char* const base = &c[0] + old_size;
+    const auto r = to_chars_formatted(base + offset, base + offset + buffer_size, value, spec, std::is_integral<T>{});
+    if (r.ec != std::errc())
+    {
+        resize_char_container(c, old_size, 0);
+        throw_format_error("boost::charconv::formatter: conversion failed");
+    }
+
+    // Every character is written at or before the one it is read from, so copying forward is safe
+    formatted_parts parts;
+    make_formatted_parts(parts, base + offset, r.ptr, value, spec);
+    char* const end = write_padded(base, parts, spec);
+
+    resize_char_container(c, old_size + static_cast<std::size_t>(end - base), 0);
+    return true;
+}
+
+template <typename T, typename OutputIt, typename Container>
+OutputIt write_formatted_back_insert(OutputIt out, T value, const format_spec& spec, Container& c, std::true_type /*is_char_container*/)
+{
+    if (!write_formatted_in_place(c, value, spec))
+    {
+        return write_formatted_copy(out, value, spec);
+    }
+
+    return out;
+}
+
+template <typename T, typename OutputIt, typename Container>
+OutputIt write_formatted_back_insert(OutputIt out, T value, const format_spec& spec, Container&, std::false_type /*is_char_container*/)
+{
+    return write_formatted_copy(out, value, spec);
+}
+
+// Selected for std::back_insert_iterator and the iterators derived from it such as fmt::appender
+template <typename T, typename OutputIt, typename Container>
+OutputIt write_formatted_dispatch(OutputIt out, T value, const format_spec& spec, const std::back_insert_iterator<Container>* it)
+{
+    return write_formatted_back_insert(out, value, spec, back_insert_container(*it),
+                                       std::integral_constant<bool, is_char_container<Container>::value>{});
+}
+
+template <typename T, typename OutputIt>
+OutputIt write_formatted_dispatch(OutputIt out, T value, const format_spec& spec, const void*)
+{
+    return write_formatted_copy(out, value, spec);
+}
+
+template <typename T, typename OutputIt>
+OutputIt write_formatted(OutputIt out, T value, const format_spec& spec)
+{
+    return write_formatted_dispatch(out, value, spec, &out);
+}
+
+} // namespace detail
+
+// Formats arithmetic values with boost::charconv::to_chars following the std-format-spec grammar:
+// [[fill]align][sign]['#']['0'][width]['.' precision][type]
+//
+// The class is independent of the formatting library. It can be used as (or derived from by)
+// a std::formatter or fmt::formatter specialization for a user type since it only relies on ctx.begin(), ctx.end(),
+// ctx.out() and ctx.advance_to(). Floating point values have the text of std::format.
+template <typename T>
+class formatter
+{
+    static_assert(std::is_arithmetic<T>::value && !std::is_same<T, bool>::value,
+                  "boost::charconv::formatter supports the arithmetic types except bool");
+
+    detail::format_spec spec_;
+
+public:
+    template <typename ParseContext>
+    BOOST_CHARCONV_CXX14_CONSTEXPR auto parse(ParseContext& ctx) -> decltype(ctx.begin())
+    {
+        return detail::parse_format_spec(ctx.begin(), ctx.end(), spec_, std::is_floating_point<T>::value);
+    }
+
+    template <typename FormatContext>
+    auto format(T value, FormatContext& ctx) const -> decltype(ctx.out())
+    {
+        return detail::write_formatted(ctx.out(), value, spec_);
+    }
+};
+
+}} // Namespaces
+
+#endif // BOOST_CHARCONV_FORMAT_HPP
@@ -13,6 +13,12 @@
 #include <boost/charconv/config.hpp>
 #include <boost/charconv/chars_format.hpp>
 #include <system_error>
+#include <cstddef>
+
+#ifdef BOOST_CHARCONV_HAS_INLINE_FLOAT
+#  include <boost/charconv/detail/from_chars_float_impl.hpp>
+#  include <boost/charconv/detail/fast_float/fast_float.hpp>
+#endif
 
 namespace boost { namespace charconv {
 
@@ -67,11 +73,11 @@ BOOST_CHARCONV_GCC5_CONSTEXPR from_chars_result from_chars(const char* first, co
 #ifdef BOOST_CHARCONV_HAS_INT128
 BOOST_CHARCONV_GCC5_CONSTEXPR from_chars_result from_chars(const char* first, const char* last, boost::int128_type& value, int base = 10) noexcept
 {
-    return detail::from_chars_integer_impl<boost::int128_type, boost::uint128_type>(first, last, value, base);
+    return detail::from_chars_integer128_impl<boost::int128_type, boost::uint128_type>(first, last, value, base);
 }
 BOOST_CHARCONV_GCC5_CONSTEXPR from_chars_result from_chars(const char* first, const char* last, boost::uint128_type& value, int base = 10) noexcept
 {
-    return detail::from_chars_integer_impl<boost::uint128_type, boost::uint128_type>(first, last, value, base);
+    return detail::from_chars_integer128_impl<boost::uint128_type, boost::uint128_type>(first, last, value, base);
 }
 #endif
 
@@ -79,8 +85,39 @@ BOOST_CHARCONV_GCC5_CONSTEXPR from_chars_result from_chars(const char* first, co
 // Floating Point
 //----------------------------------------------------------------------------------------------------------------------
 
+#ifdef BOOST_CHARCONV_HAS_INLINE_FLOAT
+
+// With BOOST_CHARCONV_INLINE_FLOAT callers with a constant fmt get the parser specialized for it.
+// The inline namespace keeps these apart from the exported functions of the library.
+inline namespace inline_float {
+
+inline from_chars_result from_chars(const char* first, const char* last, float& value, chars_format fmt = chars_format::general) noexcept
+{
+    if (fmt != chars_format::hex)
+    {
+        return detail::fast_float::from_chars(first, last, value, fmt);
+    }
+    return detail::from_chars_float_impl(first, last, value, fmt);
+}
+
+inline from_chars_result from_chars(const char* first, const char* last, double& value, chars_format fmt = chars_format::general) noexcept
+{
+    if (fmt != chars_format::hex)
+    {
+        return detail::fast_float::from_chars(first, last, value, fmt);
+    }
+    return detail::from_chars_float_impl(first, last, value, fmt);
+}
+
+} // Namespace inline_float
+
+#else
+
 BOOST_CHARCONV_DECL from_chars_result from_chars(const char* first, const char* last, float& value, chars_format fmt = chars_format::general) noexcept;
 BOOST_CHARCONV_DECL from_chars_result from_chars(const char* first, const char* last, double& value, chars_format fmt = chars_format::general) noexcept;
+
+#endif
+
 BOOST_CHARCONV_DECL from_chars_result from_chars(const char* first, const char* last, long double& value, chars_format fmt = chars_format::general) noexcept;
 
 #ifdef BOOST_CHARCONV_HAS_FLOAT128
@@ -104,6 +141,145 @@ BOOST_CHARCONV_DECL from_chars_result from_chars(const char* first, const char*
 BOOST_CHARCONV_DECL from_chars_result from_chars(const char* first, const char* last, std::bfloat16_t& value, chars_format fmt = chars_format::general) noexcept;
 #endif
 
+//----------------------------------------------------------------------------------------------------------------------
+// Padded input
+//
+// The caller guarantees that at least from_chars_padding characters following last can be read
+// (e.g. simdjson style padded buffers or the slack at the end of a mapped page). Their contents are
+// never part of the result, but they allow the digits to be loaded in blocks instead of testing
+// every character against last.
+//----------------------------------------------------------------------------------------------------------------------
+
+static constexpr std::size_t from_chars_padding = 16;
+
+from_chars_result from_chars_padded(const char* first, const char* last, bool& value, int base = 10) noexcept = delete;
+inline from_chars_result from_chars_padded(const char* first, const char* last, char& value, int base = 10) noexcept
+{
+    return detail::from_chars_padded(first, last, value, base);
+}
+inline from_chars_result from_chars_padded(const char* first, const char* last, signed char& value, int base = 10) noexcept
+{
+    return detail::from_chars_padded(first, last, value, base);
+}
+inline from_chars_result from_chars_padded(const char* first, const char* last, unsigned char& value, int base = 10) noexcept
+{
+    return detail::from_chars_padded(first, last, value, base);
+}
+inline from_chars_result from_chars_padded(const char* first, const char* last, short& value, int base = 10) noexcept
+{
+    return detail::from_chars_padded(first, last, value, base);
+}
+inline from_chars_result from_chars_padded(const char* first, const char* last, unsigned short& value, int base = 10) noexcept
+{
+    return detail::from_chars_padded(first, last, value, base);
+}
+inline from_chars_result from_chars_padded(const char* first, const char* last, int& value, int base = 10) noexcept
+{
+    return detail::from_chars_padded(first, last, value, base);
+}
+inline from_chars_result from_chars_padded(const char* first, const char* last, unsigned int& value, int base = 10) noexcept
+{
+    return detail::from_chars_padded(first, last, value, base);
+}
+inline from_chars_result from_chars_padded(const char* first, const char* last, long& value, int base = 10) noexcept
+{
+    return detail::from_chars_padded(first, last, value, base);
+}
+inline from_chars_result from_chars_padded(const char* first, const char* last, unsigned long& value, int base = 10) noexcept
+{
+    return detail::from_chars_padded(first, last, value, base);
+}
+inline from_chars_result from_chars_padded(const char* first, const char* last, long long& value, int base = 10) noexcept
+{
+    return detail::from_chars_padded(first, last, value, base);
+}
+inline from_chars_result from_chars_padded(const char* first, const char* last, unsigned long long& value, int base = 10) noexcept
+{
+    return detail::from_chars_padded(first, last, value, base);
+}
+
+#ifdef BOOST_CHARCONV_HAS_INLINE_FLOAT
+
+inline namespace inline_float {
+
+inline from_chars_result from_chars_padded(const char* first, const char* last, float& value, chars_format fmt = chars_format::general) noexcept
+{
+    if (fmt != chars_format::hex)
+    {
+        return detail::fast_float::from_chars_padded(first, last, value, fmt);
+    }
+    return detail::from_chars_float_impl(first, last, value, fmt);
+}
+
+inline from_chars_result from_chars_padded(const char* first, const char* last, double& value, chars_format fmt = chars_format::general) noexcept
+{
+    if (fmt != chars_format::hex)
+    {
+        return detail::fast_float::from_chars_padded(first, last, value, fmt);
+    }
+    return detail::from_chars_float_impl(first, last, value, fmt);
+}
+
+} // Namespace inline_float
+
+#else
+
+BOOST_CHARCONV_DECL from_chars_result from_chars_padded(const char* first, const char* last, float& value, chars_format fmt = chars_format::general) noexcept;
+BOOST_CHARCONV_DECL from_chars_result from_chars_padded(const char* first, const char* last, double& value, chars_format fmt = chars_format::general) noexcept;
+
+#endif
+
+//----------------------------------------------------------------------------------------------------------------------
+// Faithful rounding
+//
+// Same as from_chars, except that the value is only guaranteed to be one of the two floats adjacent to the number
+// in the text (an error of less than 1 ULP) instead of the nearest one. In exchange no input ever takes the
+// arbitrary precision slow path, so the worst case costs the same as the average case.
+//----------------------------------------------------------------------------------------------------------------------
+
+BOOST_CHARCONV_DECL from_chars_result from_chars_faithful(const char* first, const char* last, float& value, chars_format fmt = chars_format::general) noexcept;
+BOOST_CHARCONV_DECL from_chars_result from_chars_faithful(const char* first, const char* last, double& value, chars_format fmt = chars_format::general) noexcept;
+
+//----------------------------------------------------------------------------------------------------------------------
+// Interval
+//
+// Brackets the number in the text with the two floats on either side of it, lo <= number <= hi. Both are the
+// number when it is representable, otherwise they are adjacent and the correctly rounded value is one of them.
+// Numbers beyond the largest float give hi = infinity and numbers below the smallest subnormal give lo = 0;
+// both also return std::errc::result_out_of_range. For chars_format::hex only the rounded value is known, and
+// lo and hi are the floats on either side of it.
+//----------------------------------------------------------------------------------------------------------------------
+
+BOOST_CHARCONV_DECL from_chars_result from_chars_interval(const char* first, const char* last, float& lo, float& hi, chars_format fmt = chars_format::general) noexcept;
+BOOST_CHARCONV_DECL from_chars_result from_chars_interval(const char* first, const char* last, double& lo, double& hi, chars_format fmt = chars_format::general) noexcept;
+
+//----------------------------------------------------------------------------------------------------------------------
+// Extended result
+//
+// Same as from_chars, and also reports the number of significant digits and the decimal exponent of the text,
+// and whether the value is exact. Digits and exponent are zero for infinities, NaNs and chars_format::hex,
+// and hexadecimal input is never reported as exact.
+//----------------------------------------------------------------------------------------------------------------------
+
+BOOST_CHARCONV_DECL from_chars_ext_result from_chars_ext(const char* first, const char* last, float& value, chars_format fmt = chars_format::general) noexcept;
+BOOST_CHARCONV_DECL from_chars_ext_result from_chars_ext(const char* first, const char* last, double& value, chars_format fmt = chars_format::general) noexcept;
+
+//----------------------------------------------------------------------------------------------------------------------
+// Fixed width records
+//
+// Parses count numbers of width characters each, the i-th starting at first + i * stride, into values[i].
+// Every record is expected to have the layout of the first one, e.g. "-0123.4560" or " 0042.0000":
+// an optional sign column holding '-', '+' or ' ', then the same number of integer and fraction digits.
+// Such records are decoded without searching for the end of the number. Records with another layout,
+// e.g. with leading blanks or an exponent, are parsed by from_chars after skipping leading blanks and a plus sign.
+//
+// Stops at the first record that is not a complete number and returns its from_chars_result.
+// On success ptr is the end of the last record.
+//----------------------------------------------------------------------------------------------------------------------
+
+BOOST_CHARCONV_DECL from_chars_result from_chars_fixed_width(const char* first, std::size_t width, std::size_t stride, float* values, std::size_t count) noexcept;
+BOOST_CHARCONV_DECL from_chars_result from_chars_fixed_width(const char* first, std::size_t width, std::size_t stride, double* values, std::size_t count) noexcept;
+
 } // namespace charconv
 } // namespace boost
 
@@ -0,0 +1,41 @@
+// Copyright 2023 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_CHARCONV_HEX_HPP
+#define BOOST_CHARCONV_HEX_HPP
+
+#include <boost/charconv/detail/from_chars_result.hpp>
+#include <boost/charconv/detail/to_chars_result.hpp>
+#include <boost/charconv/config.hpp>
+#include <cstddef>
+
+// Hexadecimal encoding of byte strings such as hashes and keys, and of UUIDs in the 8-4-4-4-12 layout.
+// Blocks of 16 or 32 bytes are converted with SSE2 or AVX2 when the library is compiled for them, and
+// blocks of 4 bytes with 64-bit integer arithmetic otherwise. Defining BOOST_CHARCONV_NO_SIMD when
+// building the library disables the vector code.
+
+namespace boost { namespace charconv {
+
+// Characters written by to_chars_uuid and read by from_chars_uuid
+static constexpr std::size_t uuid_chars = 36;
+
+// Writes two hexadecimal digits for each of the size bytes at data, the high nibble first.
+// If the 2 * size characters do not fit into [first, last), {last, std::errc::result_out_of_range} is returned.
+BOOST_CHARCONV_DECL to_chars_result to_chars_hex_bytes(char* first, char* last, const unsigned char* data, std::size_t size,
+                                                       bool uppercase = false) noexcept;
+
+// Reads 2 * size hexadecimal digits of either case into the size bytes at data. If there are fewer characters
+// or one of them is not a hexadecimal digit, {first, std::errc::invalid_argument} is returned and the contents
+// of data are unspecified.
+BOOST_CHARCONV_DECL from_chars_result from_chars_hex_bytes(const char* first, const char* last, unsigned char* data, std::size_t size) noexcept;
+
+// Writes the 16 bytes at uuid as xxxxxxxx-xxxx-xxxx-xxxx-xxxxxxxxxxxx
+BOOST_CHARCONV_DECL to_chars_result to_chars_uuid(char* first, char* last, const unsigned char* uuid, bool uppercase = false) noexcept;
+
+// Reads xxxxxxxx-xxxx-xxxx-xxxx-xxxxxxxxxxxx into the 16 bytes at uuid, which are not modified on error
+BOOST_CHARCONV_DECL from_chars_result from_chars_uuid(const char* first, const char* last, unsigned char* uuid) noexcept;
+
+}} // Namespaces
+
+#endif // BOOST_CHARCONV_HEX_HPP
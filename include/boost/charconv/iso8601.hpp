@@ -0,0 +1,48 @@
+// Copyright 2023 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_CHARCONV_ISO8601_HPP
+#define BOOST_CHARCONV_ISO8601_HPP
+
+#include <boost/charconv/detail/from_chars_result.hpp>
+#include <boost/charconv/detail/to_chars_result.hpp>
+#include <boost/charconv/config.hpp>
+#include <cstdint>
+#include <cstddef>
+
+// Timestamps as UTC date and time in the ISO 8601 / RFC 3339 layout, e.g. "2023-06-01T12:34:56.789Z",
+// for a count of seconds, milliseconds, microseconds or nanoseconds since 1970-01-01T00:00:00Z.
+// Leap seconds are not counted, as with std::chrono::system_clock.
+
+namespace boost { namespace charconv {
+
+// Unit of the count, which also sets the number of fraction digits written: 0, 3, 6 or 9
+enum class time_unit : unsigned
+{
+    seconds,
+    milliseconds,
+    microseconds,
+    nanoseconds
+};
+
+// Longest output of to_chars_iso8601, which is that of time_unit::nanoseconds
+static constexpr std::size_t iso8601_max_chars = 30;
+
+// Writes value as YYYY-MM-DDThh:mm:ss[.fff[fff[fff]]]Z. Years from 0000 to 9999 can be written,
+// other values return {last, std::errc::value_too_large}. If the output does not fit into
+// [first, last), {last, std::errc::result_out_of_range} is returned.
+BOOST_CHARCONV_DECL to_chars_result to_chars_iso8601(char* first, char* last, std::int64_t value,
+                                                     time_unit unit = time_unit::nanoseconds) noexcept;
+
+// Parses YYYY-MM-DDThh:mm:ss, an optional fraction of any number of digits, and either Z or a UTC offset
+// of the form +hh:mm or -hh:mm. The separator in the middle may also be t or a space, and Z may be z.
+// Digits beyond the precision of unit are truncated. Dates and times that do not exist, including the
+// leap second 60, give std::errc::invalid_argument, and instants that do not fit into value give
+// std::errc::result_out_of_range. On error value is not modified.
+BOOST_CHARCONV_DECL from_chars_result from_chars_iso8601(const char* first, const char* last, std::int64_t& value,
+                                                         time_unit unit = time_unit::nanoseconds) noexcept;
+
+}} // Namespaces
+
+#endif // BOOST_CHARCONV_ISO8601_HPP
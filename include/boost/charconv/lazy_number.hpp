@@ -0,0 +1,280 @@
+// Copyright 2023 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_CHARCONV_LAZY_NUMBER_HPP
+#define BOOST_CHARCONV_LAZY_NUMBER_HPP
+
+#include <boost/charconv/from_chars.hpp>
+#include <boost/charconv/to_chars.hpp>
+#include <boost/charconv/limits.hpp>
+#include <boost/charconv/detail/fast_float/fast_float.hpp>
+#include <boost/charconv/detail/from_chars_result.hpp>
+#include <boost/charconv/detail/to_chars_result.hpp>
+#include <boost/charconv/detail/config.hpp>
+#include <system_error>
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+
+// A number that is validated when it is read but only converted when its value is used, for documents
+// (e.g. JSON or CSV) that hold many more numbers than are ever looked at. The text is not copied:
+// the lazy_number refers to the characters it was read from, which have to outlive it.
+
+namespace boost { namespace charconv {
+
+class lazy_number;
+
+namespace detail {
+
+// End of the digits starting at first, eight characters at a time while they are available
+inline const char* scan_digits(const char* first, const char* last) noexcept
+{
+    while (last - first >= 8 && fast_float::is_made_of_eight_digits_fast(first))
+    {
+        first += 8;
+    }
+    while (first != last && fast_float::is_integer(*first))
+    {
+        ++first;
+    }
+    return first;
+}
+
+// End of the longest prefix of [first, last) that from_chars(first, last, value, chars_format::general) matches
+// for a double, or first if there is none. integer is set if that prefix is an optional minus sign and digits.
+inline const char* scan_number(const char* first, const char* last, bool& integer) noexcept
+{
+    integer = false;
+    if (first == last)
+    {
+        return first;
+    }
+
+    auto next = first;
+    if (*next == '-')
+    {
+        ++next;
+    }
+
+    const auto digits_first = next;
+    next = scan_digits(next, last);
+    auto digits = next - digits_first;
+
+    const auto integer_last = next;
+
+    if (next != last && *next == '.')
+    {
+        const auto fraction_first = ++next;
+        next = scan_digits(next, last);
+        digits += next - fraction_first;
+    }
+
+    if (digits == 0)
+    {
+        double special;
+        const auto r = fast_float::detail::parse_infnan(first, last, special);
+        return r.ec == std::errc() ? r.ptr : first;
+    }
+
+    // Without digits the exponent is not part of the number
+    if (next != last && (*next == 'e' || *next == 'E'))
+    {
+        auto exponent = next + 1;
+        if (exponent != last && (*exponent == '-' || *exponent == '+'))
+        {
+            ++exponent;
+        }
+        const auto exponent_last = scan_digits(exponent, last);
+        if (exponent_last != exponent)
+        {
+            next = exponent_last;
+        }
+    }
+
+    integer = next == integer_last;
+    return next;
+}
+
+} // namespace detail
+
+// Reads the longest number at the start of [first, last) in the format of from_chars and chars_format::general,
+// without converting it. On success value refers to the characters [first, result.ptr). If there is no number,
+// {first, std::errc::invalid_argument} is returned, and for a number of 2^32 characters or more
+// {result.ptr, std::errc::result_out_of_range}. In both cases value is unchanged.
+inline from_chars_result from_chars(const char* first, const char* last, lazy_number& value) noexcept;
+
+// Writes the text value was read from, or the shortest representation of the value it was last assigned by set.
+// If that does not fit into [first, last), {last, std::errc::result_out_of_range} is returned.
+inline to_chars_result to_chars(char* first, char* last, const lazy_number& value) noexcept;
+
+class lazy_number
+{
+public:
+
+    lazy_number() noexcept = default;
+
+    // The characters the number was read from. After set they are empty.
+    const char* data() const noexcept { return first_; }
+    std::size_t size() const noexcept { return static_cast<std::size_t>(size_); }
+
+    // Whether the text is an integer without a decimal point or an exponent, or the value was set from an integer
+    bool is_integer() const noexcept { return integer_; }
+
+    // Whether the value was assigned by set since it was read
+    bool modified() const noexcept { return modified_; }
+
+    // Converts the text with the from_chars overload for the type of value, which has to match all of it.
+    // The result is kept until another type is requested, so converting again is a copy, except for long double,
+    // which is converted every time. A value that was set converts as if it were the text to_chars writes for it.
+    std::errc get(std::int64_t& value) noexcept { return get_impl(value, int64_kind, &storage::i); }
+    std::errc get(std::uint64_t& value) noexcept { return get_impl(value, uint64_kind, &storage::u); }
+    std::errc get(double& value) noexcept { return get_impl(value, double_kind, &storage::d); }
+    std::errc get(long double& value) const noexcept { return convert_text(value); }
+
+    // Replaces the number by value, after which to_chars writes the shortest representation of value
+    void set(std::int64_t value) noexcept { set_impl(int64_kind, true); value_.i = value; }
+    void set(std::uint64_t value) noexcept { set_impl(uint64_kind, true); value_.u = value; }
+    void set(double value) noexcept { set_impl(double_kind, false); value_.d = value; }
+
+private:
+
+    friend from_chars_result from_chars(const char* first, const char* last, lazy_number& value) noexcept;
+    friend to_chars_result to_chars(char* first, char* last, const lazy_number& value) noexcept;
+
+    enum kind : unsigned char { no_kind, int64_kind, uint64_kind, double_kind };
+
+    // Only the eight byte types are kept, so that a lazy_number is three words
+    union storage
+    {
+        std::int64_t i;
+        std::uint64_t u;
+        double d;
+    };
+
+    void set_impl(kind k, bool integer) noexcept
+    {
+        first_ = nullptr;
+        size_ = 0;
+        cached_ = k;
+        integer_ = integer;
+        modified_ = true;
+    }
+
+    // The shortest representation of a value that was set
+    to_chars_result write_value(char* first, char* last) const noexcept
+    {
+        switch (cached_)
+        {
+            case int64_kind:
+                return boost::charconv::to_chars(first, last, value_.i);
+            case uint64_kind:
+                return boost::charconv::to_chars(first, last, value_.u);
+            default:
+                return boost::charconv::to_chars(first, last, value_.d);
+        }
+    }
+
+    // Leaves value alone unless the whole text is converted
+    template <typename T>
+    static std::errc convert(const char* first, const char* last, T& value) noexcept
+    {
+        T v;
+        const auto r = boost::charconv::from_chars(first, last, v);
+        if (r.ptr != last)
+        {
+            return std::errc::invalid_argument;
+        }
+        if (r.ec != std::errc())
+        {
+            return r.ec;
+        }
+
+        value = v;
+        return std::errc();
+    }
+
+    template <typename T>
+    std::errc convert_text(T& value) const noexcept
+    {
+        if (!modified_)
+        {
+            return convert(first_, first_ + size_, value);
+        }
+
+        char buffer[limits<double>::max_chars];
+        const auto r = write_value(buffer, buffer + sizeof(buffer));
+        return convert(buffer, r.ptr, value);
+    }
+
+    template <typename T>
+    std::errc get_impl(T& value, kind k, T storage::* member) noexcept
+    {
+        if (cached_ == k)
+        {
+            value = value_.*member;
+            return std::errc();
+        }
+
+        const auto ec = convert_text(value);
+        if (ec == std::errc() && !modified_)
+        {
+            value_.*member = value;
+            cached_ = k;
+        }
+
+        return ec;
+    }
+
+    const char* first_ = nullptr;
+    storage value_ {};
+    std::uint32_t size_ = 0;
+    kind cached_ = no_kind;
+    bool integer_ = false;
+    bool modified_ = false;
+};
+
+inline from_chars_result from_chars(const char* first, const char* last, lazy_number& value) noexcept
+{
+    bool integer;
+    const auto next = detail::scan_number(first, last, integer);
+    if (next == first)
+    {
+        return {first, std::errc::invalid_argument};
+    }
+    if (static_cast<std::uint64_t>(next - first) > UINT32_MAX)
+    {
+        return {next, std::errc::result_out_of_range};
+    }
+
+    value.first_ = first;
+    value.size_ = static_cast<std::uint32_t>(next - first);
+    value.cached_ = lazy_number::no_kind;
+    value.integer_ = integer;
+    value.modified_ = false;
+
+    return {next, std::errc()};
+}
+
+inline to_chars_result to_chars(char* first, char* last, const lazy_number& value) noexcept
+{
+    if (value.modified_)
+    {
+        return value.write_value(first, last);
+    }
+
+    if (static_cast<std::size_t>(last - first) < value.size_)
+    {
+        return {last, std::errc::result_out_of_range};
+    }
+
+    if (value.size_ != 0)
+    {
+        std::memcpy(first, value.first_, value.size_);
+    }
+    return {first + value.size_, std::errc()};
+}
+
+}} // Namespaces
+
+#endif // BOOST_CHARCONV_LAZY_NUMBER_HPP
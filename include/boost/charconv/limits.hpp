@@ -5,8 +5,10 @@
 #ifndef BOOST_CHARCONV_LIMITS_HPP
 #define BOOST_CHARCONV_LIMITS_HPP
 
+#include <boost/charconv/chars_format.hpp>
 #include <boost/config.hpp>
 #include <limits>
+#include <cstddef>
 #include <type_traits>
 
 namespace boost { namespace charconv { 
@@ -72,6 +74,20 @@ template<typename T> struct limits
         std::numeric_limits<T>::max_digits10 + 3 + 2 + detail::exp_digits( std::numeric_limits<T>::max_exponent10 ); // as above
 };
 
+namespace detail
+{
+
+// The buffer size that guarantees to_chars(first, last, value, fmt, precision) succeeds.
+// Only fixed notation can print all the digits of the exponent.
+template<typename T>
+constexpr std::size_t float_chars_bound( chars_format fmt, int precision ) noexcept
+{
+    return static_cast<std::size_t>( limits<T>::max_chars10 ) + ( precision > 0? static_cast<std::size_t>( precision ): 0u ) +
+           ( fmt == chars_format::fixed? static_cast<std::size_t>( std::numeric_limits<T>::max_exponent10 ): 0u );
+}
+
+} // namespace detail
+
 #if defined(BOOST_NO_CXX17_INLINE_VARIABLES)
 
 // Definitions of in-class constexpr members are allowed but deprecated in C++17
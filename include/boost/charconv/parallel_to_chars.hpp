@@ -0,0 +1,34 @@
+// Copyright 2023 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_CHARCONV_PARALLEL_TO_CHARS_HPP
+#define BOOST_CHARCONV_PARALLEL_TO_CHARS_HPP
+
+#include <boost/charconv/detail/to_chars_result.hpp>
+#include <boost/charconv/chars_format.hpp>
+#include <boost/charconv/config.hpp>
+#include <cstddef>
+
+// Formatting of large arrays on several threads. A first pass computes only the length of the shortest
+// output of each value, the lengths of the slices of the threads are added up, and then every thread
+// formats its slice with to_chars directly at its final position in the output.
+
+namespace boost { namespace charconv {
+
+// Writes the shortest to_chars(first, last, values[i], fmt) of every value followed by separator, so that the output
+// is the same as formatting the values one after the other. threads is the number of threads to use, where zero uses
+// the number of hardware threads. If the output does not fit in [first, last) nothing is written and
+// std::errc::result_out_of_range is returned; count * (limits<T>::max_chars10 + 1) characters are always enough.
+BOOST_CHARCONV_DECL to_chars_result parallel_to_chars(char* first, char* last, const float* values, std::size_t count, char separator,
+                                                      chars_format fmt = chars_format::general, unsigned threads = 0) noexcept;
+BOOST_CHARCONV_DECL to_chars_result parallel_to_chars(char* first, char* last, const double* values, std::size_t count, char separator,
+                                                      chars_format fmt = chars_format::general, unsigned threads = 0) noexcept;
+
+// Length of the output of parallel_to_chars for the same values, computed on the calling thread
+BOOST_CHARCONV_DECL std::size_t parallel_to_chars_size(const float* values, std::size_t count, chars_format fmt = chars_format::general) noexcept;
+BOOST_CHARCONV_DECL std::size_t parallel_to_chars_size(const double* values, std::size_t count, chars_format fmt = chars_format::general) noexcept;
+
+}} // Namespaces
+
+#endif // BOOST_CHARCONV_PARALLEL_TO_CHARS_HPP
@@ -0,0 +1,56 @@
+// Copyright 2023 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_CHARCONV_SHORTEST_STYLE_HPP
+#define BOOST_CHARCONV_SHORTEST_STYLE_HPP
+
+namespace boost { namespace charconv {
+
+// How to_chars prints infinities and NaNs when given a shortest_style
+enum class nonfinite_style : unsigned
+{
+    standard,   // inf, -inf, nan, -nan(ind), nan(snan) as with to_chars(first, last, value)
+    javascript, // Infinity, -Infinity, NaN
+    python,     // inf, -inf, nan
+    null,       // null
+    error       // the conversion fails with std::errc::invalid_argument
+};
+
+// Controls the text produced for the shortest round-trip representation of a value.
+//
+// Let exp be the decimal exponent of the value in scientific notation (e.g. 2 for 123.4).
+// If min_fixed_exponent <= exp < max_fixed_exponent the value is printed in fixed notation,
+// otherwise it is printed in scientific notation.
+struct shortest_style
+{
+    int min_fixed_exponent;
+    int max_fixed_exponent;
+    int exponent_min_digits; // exponents are zero padded to at least this many digits
+    bool exponent_plus_sign; // print e+21 instead of e21
+    bool force_decimal_point; // print 1.0 instead of 1 in fixed notation
+    bool negative_zero_sign; // print -0 instead of 0
+    nonfinite_style nonfinite;
+
+    // Number.prototype.toString
+    static constexpr shortest_style javascript() noexcept
+    {
+        return {-6, 21, 1, true, false, false, nonfinite_style::javascript};
+    }
+
+    // Same as javascript, but infinities and NaNs are rejected since JSON can not represent them
+    static constexpr shortest_style json() noexcept
+    {
+        return {-6, 21, 1, true, false, false, nonfinite_style::error};
+    }
+
+    // Python's float.__repr__
+    static constexpr shortest_style python() noexcept
+    {
+        return {-4, 16, 2, true, true, true, nonfinite_style::python};
+    }
+};
+
+}} // Namespaces
+
+#endif // BOOST_CHARCONV_SHORTEST_STYLE_HPP
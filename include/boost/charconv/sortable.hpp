@@ -0,0 +1,238 @@
+// Copyright 2023 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_CHARCONV_SORTABLE_HPP
+#define BOOST_CHARCONV_SORTABLE_HPP
+
+#include <boost/charconv/detail/to_chars_integer_impl.hpp>
+#include <boost/charconv/detail/from_chars_integer_impl.hpp>
+#include <boost/charconv/detail/to_chars_result.hpp>
+#include <boost/charconv/detail/from_chars_result.hpp>
+#include <boost/charconv/detail/config.hpp>
+#include <boost/charconv/config.hpp>
+#include <system_error>
+#include <type_traits>
+#include <limits>
+#include <cstdint>
+#include <cstddef>
+
+// Order preserving text encoding of numbers, for keys that are compared with memcmp.
+//
+// A number is written as a class character followed, for non-zero finite values, by the decimal exponent
+// and the significant digits:
+//
+//   'A' -inf      'B' negative      'C' zero      'D' positive      'E' +inf      'F' NaN
+//
+// A positive value 0.d1d2...dn * 10^x (d1 and dn non-zero) is "D", x + 500 as three digits, d1...dn and '.'.
+// A negative value uses "B", 499 - x and the nines' complement of the digits, and ends with ':', so that
+// larger magnitudes sort first. The terminator sorts below every digit for positive values and above every
+// digit for negative ones, which makes the keys self delimiting: 0.12 < 0.123 and -0.12 > -0.123 also hold
+// when more characters follow the key. Floating point values use their shortest round trip digits, so
+// integers up to 2^53 in magnitude and doubles with the same value are encoded identically and can share
+// one key space.
+
+namespace boost { namespace charconv {
+
+// Longest key written by to_chars_sortable for a 64 bit integer or a double
+static constexpr std::size_t sortable_max_chars = 25;
+
+namespace detail {
+
+static constexpr int sortable_exponent_bias = 500;
+
+// Significant digits of a decoded key, in plain (not complemented) form
+struct sortable_decimal
+{
+    char kind;
+    bool negative;
+    int exponent;
+    std::size_t size;
+    char digits[40];
+};
+
+// digits holds size significant digits without trailing zeros, and value is 0.digits * 10^exponent
+inline to_chars_result write_sortable(char* first, char* last, bool negative, const char* digits, std::size_t size, int exponent) noexcept
+{
+    if (last - first < static_cast<std::ptrdiff_t>(size + 5))
+    {
+        return {last, std::errc::result_out_of_range};
+    }
+
+    const auto e = static_cast<unsigned>(negative ? sortable_exponent_bias - 1 - exponent : exponent + sortable_exponent_bias);
+    *first++ = negative ? 'B' : 'D';
+    *first++ = static_cast<char>('0' + e / 100);
+    *first++ = static_cast<char>('0' + e / 10 % 10);
+    *first++ = static_cast<char>('0' + e % 10);
+
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        *first++ = negative ? static_cast<char>('9' - (digits[i] - '0')) : digits[i];
+    }
+    *first++ = negative ? ':' : '.';
+
+    return {first, std::errc()};
+}
+
+inline to_chars_result write_sortable_class(char* first, char* last, char kind) noexcept
+{
+    if (first == last)
+    {
+        return {last, std::errc::result_out_of_range};
+    }
+    *first++ = kind;
+    return {first, std::errc()};
+}
+
+inline from_chars_result read_sortable(const char* first, const char* last, sortable_decimal& dec) noexcept
+{
+    if (first == last || *first < 'A' || *first > 'F')
+    {
+        return {first, std::errc::invalid_argument};
+    }
+
+    dec.kind = *first;
+    dec.negative = dec.kind == 'A' || dec.kind == 'B';
+    dec.exponent = 0;
+    dec.size = 0;
+
+    if (dec.kind != 'B' && dec.kind != 'D')
+    {
+        return {first + 1, std::errc()};
+    }
+
+    const char* p = first + 1;
+    if (last - p < 3)
+    {
+        return {first, std::errc::invalid_argument};
+    }
+
+    int e = 0;
+    for (int i = 0; i < 3; ++i, ++p)
+    {
+        if (*p < '0' || *p > '9')
+        {
+            return {first, std::errc::invalid_argument};
+        }
+        e = e * 10 + (*p - '0');
+    }
+    dec.exponent = dec.negative ? sortable_exponent_bias - 1 - e : e - sortable_exponent_bias;
+
+    const char terminator = dec.negative ? ':' : '.';
+    for (; p != last && *p != terminator; ++p)
+    {
+        if (*p < '0' || *p > '9' || dec.size == sizeof(dec.digits))
+        {
+            return {first, std::errc::invalid_argument};
+        }
+        dec.digits[dec.size++] = dec.negative ? static_cast<char>('9' - (*p - '0')) : *p;
+    }
+
+    // Only the canonical form, with no leading or trailing zeros, is accepted
+    if (p == last || dec.size == 0 || dec.digits[0] == '0' || dec.digits[dec.size - 1] == '0')
+    {
+        return {first, std::errc::invalid_argument};
+    }
+
+    return {p + 1, std::errc()};
+}
+
+template <typename Integer>
+struct is_sortable_integer : std::integral_constant<bool,
+    std::is_integral<Integer>::value && !std::is_same<Integer, bool>::value && sizeof(Integer) <= sizeof(std::uint64_t)> {};
+
+} // namespace detail
+
+template <typename Integer, typename std::enable_if<detail::is_sortable_integer<Integer>::value, bool>::type = true>
+to_chars_result to_chars_sortable(char* first, char* last, Integer value) noexcept
+{
+    using Unsigned = typename std::make_unsigned<Integer>::type;
+
+    if (value == 0)
+    {
+        return detail::write_sortable_class(first, last, 'C');
+    }
+
+    const bool negative = value < 0;
+    const Unsigned magnitude = negative ? static_cast<Unsigned>(0 - static_cast<Unsigned>(value)) : static_cast<Unsigned>(value);
+
+    char digits[24];
+    const auto r = detail::to_chars_integer_impl(digits, digits + sizeof(digits), magnitude);
+    const auto exponent = static_cast<int>(r.ptr - digits);
+
+    std::size_t size = static_cast<std::size_t>(exponent);
+    while (digits[size - 1] == '0')
+    {
+        --size;
+    }
+
+    return detail::write_sortable(first, last, negative, digits, size, exponent);
+}
+
+BOOST_CHARCONV_DECL to_chars_result to_chars_sortable(char* first, char* last, float value) noexcept;
+BOOST_CHARCONV_DECL to_chars_result to_chars_sortable(char* first, char* last, double value) noexcept;
+
+// Decodes one key written by to_chars_sortable. Keys of values that are not integers, or not representable
+// in Integer, give std::errc::invalid_argument and std::errc::result_out_of_range respectively.
+template <typename Integer, typename std::enable_if<detail::is_sortable_integer<Integer>::value, bool>::type = true>
+from_chars_result from_chars_sortable(const char* first, const char* last, Integer& value) noexcept
+{
+    using Unsigned = typename std::make_unsigned<Integer>::type;
+
+    detail::sortable_decimal dec;
+    auto r = detail::read_sortable(first, last, dec);
+    if (r.ec != std::errc())
+    {
+        return r;
+    }
+
+    if (dec.kind == 'C')
+    {
+        value = 0;
+        return r;
+    }
+    if (dec.kind != 'B' && dec.kind != 'D')
+    {
+        return {first, std::errc::invalid_argument};
+    }
+    if (dec.exponent < static_cast<int>(dec.size))
+    {
+        return {first, std::errc::invalid_argument};
+    }
+    if (dec.negative && !std::is_signed<Integer>::value)
+    {
+        return {r.ptr, std::errc::result_out_of_range};
+    }
+
+    Unsigned magnitude = 0;
+    const auto digits_result = detail::from_chars_integer_impl<Unsigned, Unsigned>(dec.digits, dec.digits + dec.size, magnitude, 10);
+    if (digits_result.ec != std::errc())
+    {
+        return {r.ptr, std::errc::result_out_of_range};
+    }
+    for (int i = static_cast<int>(dec.size); i < dec.exponent; ++i)
+    {
+        if (magnitude > (std::numeric_limits<Unsigned>::max)() / 10)
+        {
+            return {r.ptr, std::errc::result_out_of_range};
+        }
+        magnitude *= 10;
+    }
+
+    // The magnitude of the most negative value is one more than the largest positive value
+    const auto max_magnitude = static_cast<Unsigned>((std::numeric_limits<Integer>::max)()) + static_cast<Unsigned>(dec.negative);
+    if (magnitude > max_magnitude)
+    {
+        return {r.ptr, std::errc::result_out_of_range};
+    }
+
+    value = dec.negative ? static_cast<Integer>(0 - magnitude) : static_cast<Integer>(magnitude);
+    return r;
+}
+
+BOOST_CHARCONV_DECL from_chars_result from_chars_sortable(const char* first, const char* last, float& value) noexcept;
+BOOST_CHARCONV_DECL from_chars_result from_chars_sortable(const char* first, const char* last, double& value) noexcept;
+
+}} // Namespaces
+
+#endif // BOOST_CHARCONV_SORTABLE_HPP
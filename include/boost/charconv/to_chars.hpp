@@ -17,8 +17,12 @@
 #include <boost/charconv/detail/to_chars_integer_impl.hpp>
 #include <boost/charconv/detail/to_chars_result.hpp>
 #include <boost/charconv/detail/emulated128.hpp>
+#include <boost/charconv/detail/profile.hpp>
 #include <boost/charconv/config.hpp>
 #include <boost/charconv/chars_format.hpp>
+#include <boost/charconv/shortest_style.hpp>
+#include <boost/charconv/limits.hpp>
+#include <boost/core/bit.hpp>
 #include <system_error>
 #include <type_traits>
 #include <array>
@@ -440,6 +444,7 @@ to_chars_result to_chars_float_impl(char* first, char* last, Real value, chars_f
 
             if (abs_value >= 1 && abs_value < max_fractional_value)
             {
+                BOOST_CHARCONV_PROFILE_PATH(to_chars_dragonbox_fixed);
                 auto value_struct = boost::charconv::detail::to_decimal(value);
                 if (value_struct.is_negative)
                 {
@@ -471,6 +476,7 @@ to_chars_result to_chars_float_impl(char* first, char* last, Real value, chars_f
             }
             else if (abs_value >= max_fractional_value && abs_value < max_value)
             {
+                BOOST_CHARCONV_PROFILE_PATH(to_chars_integer);
                 if (value < 0)
                 {
                     *first++ = '-';
@@ -479,12 +485,14 @@ to_chars_result to_chars_float_impl(char* first, char* last, Real value, chars_f
             }
             else
             {
+                BOOST_CHARCONV_PROFILE_PATH(to_chars_dragonbox);
                 auto* ptr = boost::charconv::detail::to_chars(value, first, fmt);
                 return { ptr, std::errc() };
             }
         }
         else if (fmt == boost::charconv::chars_format::scientific)
         {
+            BOOST_CHARCONV_PROFILE_PATH(to_chars_dragonbox);
             auto* ptr = boost::charconv::detail::to_chars(value, first, fmt);
             return { ptr, std::errc() };
         }
@@ -493,7 +501,8 @@ to_chars_result to_chars_float_impl(char* first, char* last, Real value, chars_f
     {
         if (fmt != boost::charconv::chars_format::hex)
         {
-            auto* ptr = boost::charconv::detail::floff<boost::charconv::detail::main_cache_full, boost::charconv::detail::extended_cache_long>(value, precision, first, fmt);
+            BOOST_CHARCONV_PROFILE_PATH(to_chars_floff);
+            auto* ptr = boost::charconv::detail::floff<boost::charconv::detail::main_cache_default, boost::charconv::detail::extended_cache_long>(value, precision, first, fmt);
             return { ptr, std::errc() };
         }
     }
@@ -521,6 +530,7 @@ to_chars_result to_chars_float_impl(char* first, char* last, Real value, chars_f
     }
 
     // Hex handles both cases already
+    BOOST_CHARCONV_PROFILE_PATH(to_chars_hex);
     return boost::charconv::detail::to_chars_hex(first, last, value, precision);
 }
 
@@ -678,10 +688,35 @@ BOOST_CHARCONV_CONSTEXPR to_chars_result to_chars(char* first, char* last, boost
 // Floating Point
 //----------------------------------------------------------------------------------------------------------------------
 
+#ifdef BOOST_CHARCONV_HAS_INLINE_FLOAT
+
+// With BOOST_CHARCONV_INLINE_FLOAT constant fmt and precision arguments select the engine at compile time.
+// The inline namespace keeps these apart from the exported functions of the library.
+inline namespace inline_float {
+
+inline to_chars_result to_chars(char* first, char* last, float value,
+                                chars_format fmt = chars_format::general, int precision = -1 ) noexcept
+{
+    return detail::to_chars_float_impl(first, last, value, fmt, precision);
+}
+
+inline to_chars_result to_chars(char* first, char* last, double value,
+                                chars_format fmt = chars_format::general, int precision = -1 ) noexcept
+{
+    return detail::to_chars_float_impl(first, last, value, fmt, precision);
+}
+
+} // Namespace inline_float
+
+#else
+
 BOOST_CHARCONV_DECL to_chars_result to_chars(char* first, char* last, float value,
                                              chars_format fmt = chars_format::general, int precision = -1 ) noexcept;
 BOOST_CHARCONV_DECL to_chars_result to_chars(char* first, char* last, double value, 
                                              chars_format fmt = chars_format::general, int precision = -1 ) noexcept;
+
+#endif
+
 BOOST_CHARCONV_DECL to_chars_result to_chars(char* first, char* last, long double value,
                                              chars_format fmt = chars_format::general, int precision = -1 ) noexcept;
 
@@ -690,6 +725,19 @@ BOOST_CHARCONV_DECL to_chars_result to_chars(char* first, char* last, __float128
                                              chars_format fmt = chars_format::general, int precision = -1 ) noexcept;
 #endif
 
+// Shortest representation with the notation, exponent, and non-finite spelling controlled by style
+BOOST_CHARCONV_DECL to_chars_result to_chars(char* first, char* last, float value, const shortest_style& style) noexcept;
+BOOST_CHARCONV_DECL to_chars_result to_chars(char* first, char* last, double value, const shortest_style& style) noexcept;
+
+// The shortest representation, but with at most max_digits significant digits. Values whose shortest representation
+// is longer are correctly rounded to max_digits digits, and the trailing zeros of the result are removed.
+BOOST_CHARCONV_DECL to_chars_result to_chars_max_digits(char* first, char* last, float value, int max_digits,
+                                                        chars_format fmt = chars_format::general) noexcept;
+BOOST_CHARCONV_DECL to_chars_result to_chars_max_digits(char* first, char* last, double value, int max_digits,
+                                                        chars_format fmt = chars_format::general) noexcept;
+BOOST_CHARCONV_DECL to_chars_result to_chars_max_digits(char* first, char* last, float value, int max_digits, const shortest_style& style) noexcept;
+BOOST_CHARCONV_DECL to_chars_result to_chars_max_digits(char* first, char* last, double value, int max_digits, const shortest_style& style) noexcept;
+
 #ifdef BOOST_CHARCONV_HAS_FLOAT16
 BOOST_CHARCONV_DECL to_chars_result to_chars(char* first, char* last, std::float16_t value, 
                                              chars_format fmt = chars_format::general, int precision = -1 ) noexcept;
@@ -711,6 +759,315 @@ BOOST_CHARCONV_DECL to_chars_result to_chars(char* first, char* last, std::bfloa
                                              chars_format fmt = chars_format::general, int precision = -1 ) noexcept;
 #endif
 
+//----------------------------------------------------------------------------------------------------------------------
+// Floating Point with compile time format and precision
+//----------------------------------------------------------------------------------------------------------------------
+
+namespace detail {
+
+template <chars_format Fmt, int Precision, typename Real>
+to_chars_result to_chars_static_format(char* first, char* last, Real value, std::true_type) noexcept
+{
+    constexpr std::size_t max_chars = float_chars_bound<Real>(Fmt, Precision);
+    constexpr bool use_runtime_impl = Fmt == chars_format::hex || (Precision == -1 && Fmt != chars_format::scientific);
+
+    // Buffers smaller than the worst case, and the formats with special cases for exact integers
+    // or subnormals, share the runtime implementation (with constant arguments)
+    if (use_runtime_impl || last - first < static_cast<std::ptrdiff_t>(max_chars))
+    {
+        return to_chars_float_impl(first, last, value, Fmt, Precision);
+    }
+
+    BOOST_IF_CONSTEXPR (Precision == -1)
+    {
+        BOOST_CHARCONV_PROFILE_PATH(to_chars_dragonbox);
+        return {to_chars(value, first, Fmt), std::errc()};
+    }
+    else
+    {
+        BOOST_CHARCONV_PROFILE_PATH(to_chars_floff);
+        return {floff<main_cache_default, extended_cache_long>(value, Precision, first, Fmt), std::errc()};
+    }
+}
+
+template <chars_format Fmt, int Precision, typename Real>
+to_chars_result to_chars_static_format(char* first, char* last, Real value, std::false_type) noexcept
+{
+    return boost::charconv::to_chars(first, last, value, Fmt, Precision);
+}
+
+} // namespace detail
+
+// Same output as to_chars(first, last, value, Fmt, Precision), but the engine is selected at compile time.
+// A buffer of at least limits<Real>::max_chars10 + Precision characters (plus max_exponent10 for fixed)
+// never needs the bounds checked code path.
+template <chars_format Fmt, int Precision = -1, typename Real>
+BOOST_FORCEINLINE to_chars_result to_chars(char* first, char* last, Real value) noexcept
+{
+    static_assert(std::is_floating_point<Real>::value, "The compile time format is only available for floating point types");
+    static_assert(Fmt == chars_format::general || Fmt == chars_format::fixed ||
+                  Fmt == chars_format::scientific || Fmt == chars_format::hex, "Fmt must be one of the enumerators of chars_format");
+    static_assert(Precision >= -1, "Precision must be -1 (unspecified) or non-negative");
+
+    using is_dragonbox_type = std::integral_constant<bool, std::is_same<Real, float>::value || std::is_same<Real, double>::value>;
+    return detail::to_chars_static_format<Fmt, Precision>(first, last, value, is_dragonbox_type{});
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// Approximate Floating Point
+//----------------------------------------------------------------------------------------------------------------------
+
+namespace detail {
+
+static constexpr std::uint64_t approx_pow10[] = {
+    UINT64_C(1), UINT64_C(10), UINT64_C(100), UINT64_C(1000), UINT64_C(10000), UINT64_C(100000), UINT64_C(1000000),
+    UINT64_C(10000000), UINT64_C(100000000), UINT64_C(1000000000), UINT64_C(10000000000), UINT64_C(100000000000),
+    UINT64_C(1000000000000), UINT64_C(10000000000000), UINT64_C(100000000000000), UINT64_C(1000000000000000),
+    UINT64_C(10000000000000000), UINT64_C(100000000000000000), UINT64_C(1000000000000000000)
+};
+
+// Multiplies significand * 2^exponent by 10^s using the upper half of the Dragonbox cache entry,
+// leaving the significand normalized. 10^s is approximately high * 2^(floor_log2_pow10(s) - 63).
+inline void approx_scale(std::uint64_t& significand, int& exponent, int s) noexcept
+{
+    using cache_policy = policy_impl::cache::default_cache;
+
+    significand = umul128_upper64(significand, cache_policy::get_cache<ieee754_binary64>(s).high);
+    exponent += log::floor_log2_pow10(s) + 1;
+
+    const int leading_zeros = boost::core::countl_zero(significand);
+    significand <<= leading_zeros;
+    exponent -= leading_zeros;
+}
+
+// Finds q with digits digits and k such that q * 10^(k - digits + 1) is within one unit of q of value (positive and finite).
+// value * 10^(digits - 1 - k) is computed as a 64 bit fixed point number and rounded once, so the only error beyond
+// correct rounding comes from truncating the cache entries and the products, less than 2^-61 relative to value.
+inline void approx_decimal(double value, int digits, std::uint64_t& q, int& k) noexcept
+{
+    using cache = cache_holder_ieee754_binary64;
+
+    std::uint64_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+
+    std::uint64_t significand = bits & ((UINT64_C(1) << 52) - 1);
+    const auto biased_exponent = static_cast<int>(bits >> 52);
+    int exponent = -1074;
+    if (biased_exponent != 0)
+    {
+        significand |= UINT64_C(1) << 52;
+        exponent = biased_exponent - 1075;
+    }
+
+    const int leading_zeros = boost::core::countl_zero(significand);
+    significand <<= leading_zeros;
+    exponent -= leading_zeros;
+
+    // value is in [2^(exponent + 63), 2^(exponent + 64)), so k is floor(log10(value)) or one less
+    k = log::floor_log10_pow2(exponent + 63);
+    int s = digits - 1 - k;
+
+    // The largest values and the subnormals need a power of ten outside the cache, which takes two steps
+    if (BOOST_UNLIKELY(s > cache::max_k))
+    {
+        approx_scale(significand, exponent, s - cache::max_k);
+        s = cache::max_k;
+    }
+    else if (BOOST_UNLIKELY(s < cache::min_k))
+    {
+        approx_scale(significand, exponent, s - cache::min_k);
+        s = cache::min_k;
+    }
+
+    // value * 10^(digits - 1 - k) is x / 2^shift
+    using cache_policy = policy_impl::cache::default_cache;
+    std::uint64_t x = umul128_upper64(significand, cache_policy::get_cache<ieee754_binary64>(s).high);
+    const int shift = -(exponent + log::floor_log2_pow10(s) + 1);
+
+    if ((x >> shift) >= approx_pow10[digits])
+    {
+        x /= 10;
+        ++k;
+    }
+
+    q = (x >> shift) + ((x >> (shift - 1)) & 1);
+    if (q == approx_pow10[digits])
+    {
+        q /= 10;
+        ++k;
+    }
+}
+
+// Writes exactly digits digits of q (q < 10^digits) ending at last, two at a time
+inline void write_approx_digits(char* last, std::uint64_t q, int digits) noexcept
+{
+    while (q >= UINT64_C(100000000))
+    {
+        auto r = static_cast<std::uint32_t>(q % UINT64_C(100000000));
+        q /= UINT64_C(100000000);
+        for (int i = 0; i < 4; ++i)
+        {
+            last -= 2;
+            std::memcpy(last, radix_table + (r % 100) * 2, 2);
+            r /= 100;
+        }
+        digits -= 8;
+    }
+
+    auto r = static_cast<std::uint32_t>(q);
+    for (; digits >= 2; digits -= 2)
+    {
+        last -= 2;
+        std::memcpy(last, radix_table + (r % 100) * 2, 2);
+        r /= 100;
+    }
+    if (digits == 1)
+    {
+        *--last = static_cast<char>('0' + r);
+    }
+}
+
+// The longest text of to_chars_approx, "-d.dddddddddddddddde-ddd"
+static constexpr std::ptrdiff_t approx_max_chars = 25;
+
+// Lays out the digits of q * 10^(k - digits + 1) like printf's %.*g into at least approx_max_chars chars.
+// Every char is written once, or read back right after being written on its own, so nothing waits on a store.
+inline char* write_approx_text(char* ptr, bool is_negative, std::uint64_t q, int digits, int k) noexcept
+{
+    *ptr = '-';
+    ptr += static_cast<int>(is_negative);
+
+    if (k < -4 || k >= digits)
+    {
+        // Leave room for the point after the first digit
+        write_approx_digits(ptr + 1 + digits, q, digits);
+        ptr[0] = ptr[1];
+        ptr[1] = '.';
+
+        // q has exactly digits digits, the leading one not zero; trailing zeros are dropped from the text
+        ptr += digits;
+        while (*ptr == '0')
+        {
+            --ptr;
+        }
+        if (*ptr != '.')
+        {
+            ++ptr;
+        }
+
+        const auto abs_k = static_cast<std::uint32_t>(k < 0 ? -k : k);
+        ptr[0] = 'e';
+        ptr[1] = k < 0 ? '-' : '+';
+        ptr += 2;
+        if (abs_k >= 100)
+        {
+            *ptr++ = static_cast<char>('0' + abs_k / 100);
+        }
+        std::memcpy(ptr, radix_table + (abs_k % 100) * 2, 2);
+        return ptr + 2;
+    }
+
+    if (k < 0)
+    {
+        std::memcpy(ptr, "0.000", 5); // NOLINT : No null terminator is purposeful
+        ptr += 1 - k;
+        write_approx_digits(ptr + digits, q, digits);
+        ptr += digits - 1;
+        while (*ptr == '0')
+        {
+            --ptr;
+        }
+        return ptr + 1;
+    }
+
+    // The integer part keeps its zeros, the fraction drops them along with the point
+    write_approx_digits(ptr + 1 + digits, q, digits);
+    for (int i = 0; i <= k; ++i)
+    {
+        ptr[i] = ptr[i + 1];
+    }
+    char* const point = ptr + k + 1;
+    *point = '.';
+    ptr += digits;
+    while (ptr > point && *ptr == '0')
+    {
+        --ptr;
+    }
+    return ptr == point ? ptr : ptr + 1;
+}
+
+inline to_chars_result to_chars_approx_digits(char* first, char* last, bool is_negative, std::uint64_t q, int digits, int k) noexcept
+{
+    if (last - first >= approx_max_chars)
+    {
+        return {write_approx_text(first, is_negative, q, digits, k), std::errc()};
+    }
+
+    char buffer[approx_max_chars];
+    const std::ptrdiff_t total_length = write_approx_text(buffer, is_negative, q, digits, k) - buffer;
+    if (total_length > last - first)
+    {
+        return {last, std::errc::result_out_of_range};
+    }
+
+    std::memcpy(first, buffer, static_cast<std::size_t>(total_length));
+    return {first + total_length, std::errc()};
+}
+
+template <typename Real>
+to_chars_result to_chars_approx_impl(char* first, char* last, Real value, int significant_digits) noexcept
+{
+    if (first > last)
+    {
+        return {last, std::errc::invalid_argument};
+    }
+
+    // The text of inf and nan is that of the library's to_chars
+    if (!std::isfinite(value))
+    {
+        return boost::charconv::to_chars(first, last, value);
+    }
+
+    const bool is_negative = std::signbit(value);
+    if (value == 0)
+    {
+        if (last - first < 1 + static_cast<std::ptrdiff_t>(is_negative))
+        {
+            return {last, std::errc::result_out_of_range};
+        }
+        if (is_negative)
+        {
+            *first++ = '-';
+        }
+        *first++ = '0';
+        return {first, std::errc()};
+    }
+
+    // Digits past max_digits10 carry no information about the value
+    constexpr int max_digits = std::numeric_limits<Real>::max_digits10;
+    const int digits = significant_digits < 1 ? 1 : significant_digits > max_digits ? max_digits : significant_digits;
+
+    std::uint64_t q;
+    int k;
+    approx_decimal(std::abs(static_cast<double>(value)), digits, q, k);
+
+    return to_chars_approx_digits(first, last, is_negative, q, digits, k);
+}
+
+} // namespace detail
+
+// The first significant_digits digits of value laid out like printf's %.*g, where the last digit may be one off.
+// The printed number differs from value by less than one unit in its last digit.
+inline to_chars_result to_chars_approx(char* first, char* last, float value, int significant_digits) noexcept
+{
+    return detail::to_chars_approx_impl(first, last, value, significant_digits);
+}
+
+inline to_chars_result to_chars_approx(char* first, char* last, double value, int significant_digits) noexcept
+{
+    return detail::to_chars_approx_impl(first, last, value, significant_digits);
+}
+
 } // namespace charconv
 } // namespace boost
 
@@ -0,0 +1,182 @@
+// Copyright 2023 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_CHARCONV_TO_STRING_HPP
+#define BOOST_CHARCONV_TO_STRING_HPP
+
+#include <boost/charconv/to_chars.hpp>
+#include <boost/charconv/limits.hpp>
+#include <boost/charconv/chars_format.hpp>
+#include <boost/charconv/detail/config.hpp>
+#include <boost/config.hpp>
+#include <type_traits>
+#include <system_error>
+#include <limits>
+#include <string>
+#include <iosfwd>
+#include <cstring>
+#include <cstddef>
+
+#ifndef BOOST_NO_CXX17_HDR_STRING_VIEW
+#  include <string_view>
+#endif
+
+namespace boost { namespace charconv {
+
+// Null terminated string of at most N characters stored inline, so it never allocates.
+// It is the return type of to_string, where N is limits<T>::max_chars10.
+template <std::size_t N>
+class inline_string
+{
+private:
+    char data_[N + 1];
+    std::size_t size_;
+
+public:
+    using value_type = char;
+    using size_type = std::size_t;
+    using const_iterator = const char*;
+
+    static constexpr std::size_t static_capacity = N;
+
+    inline_string() noexcept : size_ {0}
+    {
+        data_[0] = '\0';
+    }
+
+    char* data() noexcept { return data_; }
+    const char* data() const noexcept { return data_; }
+    const char* c_str() const noexcept { return data_; }
+
+    std::size_t size() const noexcept { return size_; }
+    std::size_t length() const noexcept { return size_; }
+    bool empty() const noexcept { return size_ == 0; }
+    static constexpr std::size_t capacity() noexcept { return N; }
+    static constexpr std::size_t max_size() noexcept { return N; }
+
+    const char* begin() const noexcept { return data_; }
+    const char* end() const noexcept { return data_ + size_; }
+
+    char operator[](std::size_t pos) const noexcept { return data_[pos]; }
+
+    // count must not exceed N. Characters in [size(), count) keep whatever was written to data().
+    void resize(std::size_t count) noexcept
+    {
+        size_ = count;
+        data_[count] = '\0';
+    }
+
+    std::string str() const { return std::string(data_, size_); }
+    operator std::string() const { return str(); }
+
+    #ifndef BOOST_NO_CXX17_HDR_STRING_VIEW
+    operator std::string_view() const noexcept { return std::string_view(data_, size_); }
+    #endif
+
+    template <std::size_t M>
+    friend bool operator==(const inline_string& lhs, const inline_string<M>& rhs) noexcept
+    {
+        return lhs.size() == rhs.size() && std::memcmp(lhs.data(), rhs.data(), lhs.size()) == 0;
+    }
+
+    template <std::size_t M>
+    friend bool operator!=(const inline_string& lhs, const inline_string<M>& rhs) noexcept
+    {
+        return !(lhs == rhs);
+    }
+
+    friend bool operator==(const inline_string& lhs, const char* rhs) noexcept
+    {
+        return std::strlen(rhs) == lhs.size() && std::memcmp(lhs.data(), rhs, lhs.size()) == 0;
+    }
+
+    friend bool operator!=(const inline_string& lhs, const char* rhs) noexcept
+    {
+        return !(lhs == rhs);
+    }
+
+    friend bool operator==(const inline_string& lhs, const std::string& rhs) noexcept
+    {
+        return rhs.size() == lhs.size() && std::memcmp(lhs.data(), rhs.data(), lhs.size()) == 0;
+    }
+
+    friend bool operator!=(const inline_string& lhs, const std::string& rhs) noexcept
+    {
+        return !(lhs == rhs);
+    }
+
+    template <typename CharT, typename Traits>
+    friend std::basic_ostream<CharT, Traits>& operator<<(std::basic_ostream<CharT, Traits>& os, const inline_string& str)
+    {
+        for (const char c : str)
+        {
+            os << static_cast<CharT>(c);
+        }
+        return os;
+    }
+};
+
+#if defined(BOOST_NO_CXX17_INLINE_VARIABLES)
+template <std::size_t N> constexpr std::size_t inline_string<N>::static_capacity;
+#endif
+
+namespace detail {
+
+template <typename T>
+struct is_to_string_type : std::integral_constant<bool,
+    (std::is_integral<T>::value && !std::is_same<T, bool>::value) || std::is_floating_point<T>::value> {};
+
+// Makes room for count more characters, growing the capacity at least geometrically
+inline char* append_reserve(std::string& str, std::size_t count)
+{
+    const std::size_t old_size = str.size();
+    const std::size_t new_size = old_size + count;
+    if (new_size > str.capacity())
+    {
+        const std::size_t doubled = str.capacity() * 2;
+        str.reserve(new_size > doubled ? new_size : doubled);
+    }
+    str.resize(new_size);
+    return &str[old_size];
+}
+
+} // namespace detail
+
+// Shortest round trip representation of value in base 10, formatted by the same
+// algorithms as to_chars. Unlike std::to_string this never allocates and is not locale dependent.
+template <typename T, typename std::enable_if<detail::is_to_string_type<T>::value, bool>::type = true>
+inline_string<static_cast<std::size_t>(limits<T>::max_chars10)> to_string(T value) noexcept
+{
+    inline_string<static_cast<std::size_t>(limits<T>::max_chars10)> str;
+    const auto r = to_chars(str.data(), str.data() + str.capacity(), value);
+    BOOST_CHARCONV_ASSERT(r.ec == std::errc());
+    str.resize(static_cast<std::size_t>(r.ptr - str.data()));
+    return str;
+}
+
+// Appends the characters of to_chars(first, last, value, base) to str
+template <typename Integer, typename std::enable_if<std::is_integral<Integer>::value && !std::is_same<Integer, bool>::value, bool>::type = true>
+std::string& append_to(std::string& str, Integer value, int base = 10)
+{
+    const auto max_chars = static_cast<std::size_t>(base == 10 ? limits<Integer>::max_chars10 : limits<Integer>::max_chars);
+    char* first = detail::append_reserve(str, max_chars);
+    const auto r = to_chars(first, first + max_chars, value, base);
+    str.resize(r.ec == std::errc() ? static_cast<std::size_t>(r.ptr - str.data()) : str.size() - max_chars);
+    return str;
+}
+
+// Appends the characters of to_chars(first, last, value, fmt, precision) to str
+template <typename Real, typename std::enable_if<std::is_floating_point<Real>::value, bool>::type = true>
+std::string& append_to(std::string& str, Real value, chars_format fmt = chars_format::general, int precision = -1)
+{
+    const auto max_chars = detail::float_chars_bound<Real>(fmt, precision);
+    char* first = detail::append_reserve(str, max_chars);
+    const auto r = to_chars(first, first + max_chars, value, fmt, precision);
+    str.resize(r.ec == std::errc() ? static_cast<std::size_t>(r.ptr - str.data()) : str.size() - max_chars);
+    return str;
+}
+
+}} // Namespaces
+
+#endif // BOOST_CHARCONV_TO_STRING_HPP
@@ -0,0 +1,151 @@
+// Copyright 2023 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_CHARCONV_WRITER_HPP
+#define BOOST_CHARCONV_WRITER_HPP
+
+#include <boost/charconv/to_chars.hpp>
+#include <boost/charconv/limits.hpp>
+#include <boost/charconv/chars_format.hpp>
+#include <boost/charconv/config.hpp>
+#include <boost/config.hpp>
+#include <system_error>
+#include <type_traits>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <cstring>
+#include <cstddef>
+
+namespace boost { namespace charconv {
+
+// Buffered output sink that formats numbers with to_chars directly into its buffer, and hands
+// the buffer to a file descriptor or a callback when it is full.
+//
+// Errors are sticky: after the first failure (e.g. a failed write) all further output is discarded
+// and error() reports the failure.
+class BOOST_CHARCONV_DECL writer
+{
+public:
+    // Receives each flushed block. Returns false to report a failure.
+    using flush_function = bool (*)(void* context, const char* data, std::size_t size);
+
+    static constexpr std::size_t default_buffer_size = 65536;
+
+    // Writes to the file descriptor fd, which is not closed by the writer
+    explicit writer(int fd, std::size_t buffer_size = default_buffer_size);
+    writer(int fd, char* buffer, std::size_t buffer_size) noexcept;
+
+    writer(flush_function fn, void* context, std::size_t buffer_size = default_buffer_size);
+    writer(flush_function fn, void* context, char* buffer, std::size_t buffer_size) noexcept;
+
+    writer(const writer&) = delete;
+    writer& operator=(const writer&) = delete;
+
+    // Flushes the remaining output
+    ~writer();
+
+    template <typename Integer, typename std::enable_if<std::is_integral<Integer>::value && !std::is_same<Integer, bool>::value, bool>::type = true>
+    writer& write(Integer value, int base = 10) noexcept
+    {
+        if (ensure(static_cast<std::size_t>(base == 10 ? limits<Integer>::max_chars10 : limits<Integer>::max_chars)))
+        {
+            commit(to_chars(pos_, end_, value, base));
+        }
+        return *this;
+    }
+
+    template <typename Real, typename std::enable_if<std::is_floating_point<Real>::value, bool>::type = true>
+    writer& write(Real value, chars_format fmt = chars_format::general, int precision = -1) noexcept
+    {
+        if (ensure(detail::float_chars_bound<Real>(fmt, precision)))
+        {
+            commit(to_chars(pos_, end_, value, fmt, precision));
+        }
+        return *this;
+    }
+
+    // Pieces larger than half of the buffer are not copied, but written together with the buffer
+    writer& write(const char* data, std::size_t size) noexcept;
+
+    writer& write(const char* str) noexcept
+    {
+        return write(str, std::strlen(str));
+    }
+
+    writer& put(char c) noexcept
+    {
+        if (ensure(1))
+        {
+            *pos_++ = c;
+        }
+        return *this;
+    }
+
+    // Writes every value in [first, last) followed by separator in the shortest base 10 form.
+    // The free space is checked once per buffer's worth of values rather than once per value.
+    template <typename ForwardIt>
+    writer& write_range(ForwardIt first, ForwardIt last, char separator) noexcept
+    {
+        using value_type = typename std::iterator_traits<ForwardIt>::value_type;
+        constexpr auto max_chars = static_cast<std::size_t>(limits<value_type>::max_chars10) + 1;
+
+        while (first != last && ensure(max_chars))
+        {
+            for (auto n = static_cast<std::size_t>(end_ - pos_) / max_chars; n != 0 && first != last; --n, ++first)
+            {
+                pos_ = to_chars(pos_, end_, *first).ptr;
+                *pos_++ = separator;
+            }
+        }
+        return *this;
+    }
+
+    // Hands all buffered output to the sink
+    std::errc flush() noexcept;
+
+    std::errc error() const noexcept { return error_; }
+    std::size_t size() const noexcept { return static_cast<std::size_t>(pos_ - first_); }
+    std::size_t capacity() const noexcept { return static_cast<std::size_t>(end_ - first_); }
+
+private:
+    std::unique_ptr<char[]> owned_;
+    char* first_;
+    char* pos_;
+    char* end_;
+    int fd_;
+    flush_function fn_;
+    void* context_;
+    std::errc error_;
+
+    // Makes n characters available, flushing if required. Returns false if the writer has failed.
+    bool ensure(std::size_t n) noexcept
+    {
+        if (BOOST_LIKELY(static_cast<std::size_t>(end_ - pos_) >= n && error_ == std::errc()))
+        {
+            return true;
+        }
+        return ensure_slow(n);
+    }
+
+    bool ensure_slow(std::size_t n) noexcept;
+
+    void commit(to_chars_result r) noexcept
+    {
+        if (r.ec == std::errc())
+        {
+            pos_ = r.ptr;
+        }
+        else
+        {
+            error_ = r.ec;
+        }
+    }
+
+    bool sink(const char* data, std::size_t size, const char* extra_data, std::size_t extra_size) noexcept;
+};
+
+}} // Namespaces
+
+#endif // BOOST_CHARCONV_WRITER_HPP
@@ -0,0 +1,292 @@
+// Copyright 2023 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/charconv/batch_to_chars.hpp>
+#include <boost/charconv/parallel_to_chars.hpp>
+#include <boost/charconv/to_chars.hpp>
+#include <boost/charconv/limits.hpp>
+#include <boost/charconv/detail/dragonbox/dragonbox.hpp>
+#include <boost/charconv/detail/to_chars_integer_impl.hpp>
+#include <boost/charconv/detail/config.hpp>
+#include <boost/config.hpp>
+#include <system_error>
+#include <limits>
+#include <cstring>
+#include <cstdint>
+#include <cstddef>
+#include <cmath>
+
+#if !defined(BOOST_CHARCONV_NO_SIMD) && !defined(BOOST_CHARCONV_NO_AVX2)
+#  if defined(BOOST_CHARCONV_HAS_RUNTIME_DISPATCH)
+#    define BOOST_CHARCONV_BATCH_AVX2
+#    ifndef BOOST_CHARCONV_NO_AVX512
+#      define BOOST_CHARCONV_BATCH_AVX512
+#    endif
+#  elif defined(__AVX512F__) && defined(__AVX512DQ__) && !defined(BOOST_CHARCONV_NO_AVX512)
+#    define BOOST_CHARCONV_BATCH_AVX512
+#  elif defined(__AVX2__)
+#    define BOOST_CHARCONV_BATCH_AVX2
+#  endif
+#endif
+
+#if defined(BOOST_CHARCONV_BATCH_AVX2) || defined(BOOST_CHARCONV_BATCH_AVX512)
+#  include <immintrin.h>
+#endif
+
+namespace boost { namespace charconv { namespace detail {
+
+#if defined(BOOST_CHARCONV_BATCH_AVX2) || defined(BOOST_CHARCONV_BATCH_AVX512)
+
+// Writes the text of a finite non-zero value whose shortest representation is significand * 10^exponent, without trailing
+// zeros in the significand, with the layouts of to_chars_float_impl. The shortest digits are only used where it uses them.
+static char* write_shortest_float(char* first, char* last, float value, std::uint32_t significand, int exponent, chars_format fmt) noexcept
+{
+    const float abs_value = std::abs(value);
+    if (value < 0)
+    {
+        *first++ = '-';
+    }
+
+    if (fmt != chars_format::scientific)
+    {
+        if (abs_value >= 1 && abs_value < 1e7F)
+        {
+            auto ptr = to_chars_integer_impl(first, last, significand).ptr;
+            if (exponent < 0)
+            {
+                std::memmove(ptr + exponent + 1, ptr + exponent, static_cast<std::size_t>(-exponent));
+                ptr[exponent] = '.';
+                return ptr + 1;
+            }
+
+            std::memset(ptr, '0', static_cast<std::size_t>(exponent));
+            return ptr + exponent;
+        }
+        else if (abs_value >= 1e7F && abs_value < static_cast<float>(std::numeric_limits<std::uint32_t>::max()))
+        {
+            return to_chars_integer_impl(first, last, static_cast<std::uint64_t>(abs_value)).ptr;
+        }
+    }
+
+    return to_chars_detail::to_chars<float, dragonbox_float_traits<float>>(significand, exponent, first, fmt);
+}
+
+// Dragonbox for binary32 with nearest to even rounding, as in impl::compute_nearest_normal, on one value per
+// 64-bit lane. All three outcomes of the comparison of r with deltai are computed and the result is selected per lane.
+// The shorter interval case only occurs for powers of two, so its results are looked up by the exponent bits.
+// Zeros, infinities and NaNs are left to to_chars.
+
+// The shortest significand and exponent of 2^(exponent_bits - 150), for the powers of two among the normal values
+struct shorter_interval_table
+{
+    std::uint64_t significand[256];
+    std::uint64_t exponent[256];
+
+    shorter_interval_table() noexcept : significand(), exponent()
+    {
+        for (std::uint32_t exponent_bits = 1; exponent_bits < 255; ++exponent_bits)
+        {
+            const std::uint32_t bits = exponent_bits << 23;
+            float value;
+            std::memcpy(&value, &bits, sizeof(value));
+
+            const auto dec = to_decimal(value);
+            significand[exponent_bits] = dec.significand;
+            exponent[exponent_bits] = static_cast<std::uint64_t>(static_cast<std::int64_t>(dec.exponent));
+        }
+    }
+};
+
+static const shorter_interval_table& get_shorter_interval_table() noexcept
+{
+    static const shorter_interval_table table;
+    return table;
+}
+
+#endif
+
+#ifdef BOOST_CHARCONV_BATCH_AVX512
+
+namespace avx512 {
+
+#define BOOST_CHARCONV_BATCH_TARGET BOOST_CHARCONV_TARGET("avx512f,avx512dq")
+
+// The AVX-512 intrinsics of GCC start from _mm512_undefined_epi32, which it then reports as uninitialized
+#if defined(__GNUC__) && !defined(__clang__)
+#  pragma GCC diagnostic push
+#  pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+
+// Masks are kept as vectors of all ones or all zeros lanes, so that the kernel is written once for both instruction sets
+struct batch_ops
+{
+    static constexpr std::size_t lanes = 8;
+
+    using vec = __m512i;    // 64-bit lanes
+    using half = __m256i;   // 32-bit lanes
+
+    BOOST_CHARCONV_BATCH_TARGET static half load(const float* p) noexcept { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)); }
+    BOOST_CHARCONV_BATCH_TARGET static half set1_32(std::int32_t x) noexcept { return _mm256_set1_epi32(x); }
+    BOOST_CHARCONV_BATCH_TARGET static half add_32(half a, half b) noexcept { return _mm256_add_epi32(a, b); }
+    BOOST_CHARCONV_BATCH_TARGET static half sub_32(half a, half b) noexcept { return _mm256_sub_epi32(a, b); }
+    BOOST_CHARCONV_BATCH_TARGET static half and_32(half a, half b) noexcept { return _mm256_and_si256(a, b); }
+    BOOST_CHARCONV_BATCH_TARGET static half mul_32(half a, half b) noexcept { return _mm256_mullo_epi32(a, b); }
+    BOOST_CHARCONV_BATCH_TARGET static half blend_32(half mask, half a, half b) noexcept { return _mm256_blendv_epi8(a, b, mask); }
+    BOOST_CHARCONV_BATCH_TARGET static half eq_32(half a, half b) noexcept { return _mm256_cmpeq_epi32(a, b); }
+    template <int N> BOOST_CHARCONV_BATCH_TARGET static half srl_32(half a) noexcept { return _mm256_srli_epi32(a, N); }
+    template <int N> BOOST_CHARCONV_BATCH_TARGET static half sra_32(half a) noexcept { return _mm256_srai_epi32(a, N); }
+    template <int N> BOOST_CHARCONV_BATCH_TARGET static half sll_32(half a) noexcept { return _mm256_slli_epi32(a, N); }
+
+    BOOST_CHARCONV_BATCH_TARGET static vec widen(half a) noexcept { return _mm512_cvtepi32_epi64(a); }
+    BOOST_CHARCONV_BATCH_TARGET static vec gather(const std::uint64_t* table, half index) noexcept { return _mm512_i32gather_epi64(index, table, 8); }
+
+    BOOST_CHARCONV_BATCH_TARGET static vec set1(std::uint64_t x) noexcept { return _mm512_set1_epi64(static_cast<long long>(x)); }
+    BOOST_CHARCONV_BATCH_TARGET static vec add(vec a, vec b) noexcept { return _mm512_add_epi64(a, b); }
+    BOOST_CHARCONV_BATCH_TARGET static vec sub(vec a, vec b) noexcept { return _mm512_sub_epi64(a, b); }
+    BOOST_CHARCONV_BATCH_TARGET static vec and_(vec a, vec b) noexcept { return _mm512_and_si512(a, b); }
+    BOOST_CHARCONV_BATCH_TARGET static vec andnot(vec a, vec b) noexcept { return _mm512_andnot_si512(a, b); }
+    BOOST_CHARCONV_BATCH_TARGET static vec or_(vec a, vec b) noexcept { return _mm512_or_si512(a, b); }
+    BOOST_CHARCONV_BATCH_TARGET static vec xor_(vec a, vec b) noexcept { return _mm512_xor_si512(a, b); }
+    BOOST_CHARCONV_BATCH_TARGET static vec mul_32x32(vec a, vec b) noexcept { return _mm512_mul_epu32(a, b); }
+    template <int N> BOOST_CHARCONV_BATCH_TARGET static vec srl(vec a) noexcept { return _mm512_srli_epi64(a, N); }
+    template <int N> BOOST_CHARCONV_BATCH_TARGET static vec sll(vec a) noexcept { return _mm512_slli_epi64(a, N); }
+    BOOST_CHARCONV_BATCH_TARGET static vec srlv(vec a, vec n) noexcept { return _mm512_srlv_epi64(a, n); }
+    BOOST_CHARCONV_BATCH_TARGET static vec sllv(vec a, vec n) noexcept { return _mm512_sllv_epi64(a, n); }
+    BOOST_CHARCONV_BATCH_TARGET static vec eq(vec a, vec b) noexcept { return _mm512_movm_epi64(_mm512_cmpeq_epi64_mask(a, b)); }
+    BOOST_CHARCONV_BATCH_TARGET static vec gt(vec a, vec b) noexcept { return _mm512_movm_epi64(_mm512_cmpgt_epi64_mask(a, b)); }
+    BOOST_CHARCONV_BATCH_TARGET static vec blend(vec mask, vec a, vec b) noexcept { return _mm512_mask_blend_epi64(_mm512_movepi64_mask(mask), a, b); }
+    BOOST_CHARCONV_BATCH_TARGET static bool any(vec mask) noexcept { return _mm512_movepi64_mask(mask) != 0; }
+    BOOST_CHARCONV_BATCH_TARGET static void store(std::uint64_t* p, vec a) noexcept { _mm512_storeu_si512(p, a); }
+};
+
+#if defined(__GNUC__) && !defined(__clang__)
+#  pragma GCC diagnostic pop
+#endif
+
+#include "batch_to_chars_kernel.ipp"
+
+#undef BOOST_CHARCONV_BATCH_TARGET
+
+} // namespace avx512
+
+#endif // BOOST_CHARCONV_BATCH_AVX512
+
+#ifdef BOOST_CHARCONV_BATCH_AVX2
+
+namespace avx2 {
+
+#define BOOST_CHARCONV_BATCH_TARGET BOOST_CHARCONV_TARGET("avx2")
+
+struct batch_ops
+{
+    static constexpr std::size_t lanes = 4;
+
+    using vec = __m256i;    // 64-bit lanes
+    using half = __m128i;   // 32-bit lanes
+
+    BOOST_CHARCONV_BATCH_TARGET static half load(const float* p) noexcept { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p)); }
+    BOOST_CHARCONV_BATCH_TARGET static half set1_32(std::int32_t x) noexcept { return _mm_set1_epi32(x); }
+    BOOST_CHARCONV_BATCH_TARGET static half add_32(half a, half b) noexcept { return _mm_add_epi32(a, b); }
+    BOOST_CHARCONV_BATCH_TARGET static half sub_32(half a, half b) noexcept { return _mm_sub_epi32(a, b); }
+    BOOST_CHARCONV_BATCH_TARGET static half and_32(half a, half b) noexcept { return _mm_and_si128(a, b); }
+    BOOST_CHARCONV_BATCH_TARGET static half mul_32(half a, half b) noexcept { return _mm_mullo_epi32(a, b); }
+    BOOST_CHARCONV_BATCH_TARGET static half blend_32(half mask, half a, half b) noexcept { return _mm_blendv_epi8(a, b, mask); }
+    BOOST_CHARCONV_BATCH_TARGET static half eq_32(half a, half b) noexcept { return _mm_cmpeq_epi32(a, b); }
+    template <int N> BOOST_CHARCONV_BATCH_TARGET static half srl_32(half a) noexcept { return _mm_srli_epi32(a, N); }
+    template <int N> BOOST_CHARCONV_BATCH_TARGET static half sra_32(half a) noexcept { return _mm_srai_epi32(a, N); }
+    template <int N> BOOST_CHARCONV_BATCH_TARGET static half sll_32(half a) noexcept { return _mm_slli_epi32(a, N); }
+
+    BOOST_CHARCONV_BATCH_TARGET static vec widen(half a) noexcept { return _mm256_cvtepi32_epi64(a); }
+    BOOST_CHARCONV_BATCH_TARGET static vec gather(const std::uint64_t* table, half index) noexcept
+    {
+        return _mm256_i32gather_epi64(reinterpret_cast<const long long*>(table), index, 8);
+    }
+
+    BOOST_CHARCONV_BATCH_TARGET static vec set1(std::uint64_t x) noexcept { return _mm256_set1_epi64x(static_cast<long long>(x)); }
+    BOOST_CHARCONV_BATCH_TARGET static vec add(vec a, vec b) noexcept { return _mm256_add_epi64(a, b); }
+    BOOST_CHARCONV_BATCH_TARGET static vec sub(vec a, vec b) noexcept { return _mm256_sub_epi64(a, b); }
+    BOOST_CHARCONV_BATCH_TARGET static vec and_(vec a, vec b) noexcept { return _mm256_and_si256(a, b); }
+    BOOST_CHARCONV_BATCH_TARGET static vec andnot(vec a, vec b) noexcept { return _mm256_andnot_si256(a, b); }
+    BOOST_CHARCONV_BATCH_TARGET static vec or_(vec a, vec b) noexcept { return _mm256_or_si256(a, b); }
+    BOOST_CHARCONV_BATCH_TARGET static vec xor_(vec a, vec b) noexcept { return _mm256_xor_si256(a, b); }
+    BOOST_CHARCONV_BATCH_TARGET static vec mul_32x32(vec a, vec b) noexcept { return _mm256_mul_epu32(a, b); }
+    template <int N> BOOST_CHARCONV_BATCH_TARGET static vec srl(vec a) noexcept { return _mm256_srli_epi64(a, N); }
+    template <int N> BOOST_CHARCONV_BATCH_TARGET static vec sll(vec a) noexcept { return _mm256_slli_epi64(a, N); }
+    BOOST_CHARCONV_BATCH_TARGET static vec srlv(vec a, vec n) noexcept { return _mm256_srlv_epi64(a, n); }
+    BOOST_CHARCONV_BATCH_TARGET static vec sllv(vec a, vec n) noexcept { return _mm256_sllv_epi64(a, n); }
+    BOOST_CHARCONV_BATCH_TARGET static vec eq(vec a, vec b) noexcept { return _mm256_cmpeq_epi64(a, b); }
+    BOOST_CHARCONV_BATCH_TARGET static vec gt(vec a, vec b) noexcept { return _mm256_cmpgt_epi64(a, b); }
+    BOOST_CHARCONV_BATCH_TARGET static vec blend(vec mask, vec a, vec b) noexcept { return _mm256_blendv_epi8(a, b, mask); }
+    BOOST_CHARCONV_BATCH_TARGET static bool any(vec mask) noexcept { return _mm256_movemask_epi8(mask) != 0; }
+    BOOST_CHARCONV_BATCH_TARGET static void store(std::uint64_t* p, vec a) noexcept { _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), a); }
+};
+
+#include "batch_to_chars_kernel.ipp"
+
+#undef BOOST_CHARCONV_BATCH_TARGET
+
+} // namespace avx2
+
+#endif // BOOST_CHARCONV_BATCH_AVX2
+
+static char* batch_format(char* first, char* last, const float* values, std::size_t count, char separator, chars_format fmt) noexcept
+{
+    #ifdef BOOST_CHARCONV_BATCH_AVX512
+    if (BOOST_CHARCONV_CPU_SUPPORTS("avx512f") && BOOST_CHARCONV_CPU_SUPPORTS("avx512dq"))
+    {
+        return avx512::batch_format(first, last, values, count, separator, fmt);
+    }
+    #endif
+
+    #ifdef BOOST_CHARCONV_BATCH_AVX2
+    if (BOOST_CHARCONV_CPU_SUPPORTS("avx2"))
+    {
+        return avx2::batch_format(first, last, values, count, separator, fmt);
+    }
+    #endif
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        first = to_chars(first, last, values[i], fmt).ptr;
+        *first++ = separator;
+    }
+
+    return first;
+}
+
+static to_chars_result batch_to_chars_impl(char* first, char* last, const float* values, std::size_t count, char separator, chars_format fmt) noexcept
+{
+    // Check the exact length only when the buffer is smaller than the longest output
+    const auto room = static_cast<std::size_t>(last - first);
+    if (room / (limits<float>::max_chars10 + 1) < count && parallel_to_chars_size(values, count, fmt) > room)
+    {
+        return {last, std::errc::result_out_of_range};
+    }
+
+    if (fmt == chars_format::hex)
+    {
+        // The hex layout wants room for the maximum precision even when the output is shorter
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            char buffer[64];
+            const auto r = to_chars(buffer, buffer + sizeof(buffer), values[i], fmt);
+            const auto size = static_cast<std::size_t>(r.ptr - buffer);
+            std::memcpy(first, buffer, size);
+            first += size;
+            *first++ = separator;
+        }
+
+        return {first, std::errc()};
+    }
+
+    return {batch_format(first, last, values, count, separator, fmt), std::errc()};
+}
+
+}}} // Namespaces
+
+boost::charconv::to_chars_result boost::charconv::batch_to_chars(char* first, char* last, const float* values, std::size_t count, char separator,
+                                                                 boost::charconv::chars_format fmt) noexcept
+{
+    return boost::charconv::detail::batch_to_chars_impl(first, last, values, count, separator, fmt);
+}
@@ -0,0 +1,161 @@
+// Copyright 2023 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+// The vector kernel of batch_to_chars. batch_to_chars.cpp includes it once per instruction set, in a namespace
+// that defines batch_ops and BOOST_CHARCONV_BATCH_TARGET, the target attribute of the functions, so there is no include guard.
+
+using batch_vec = batch_ops::vec;
+using batch_half = batch_ops::half;
+
+// Parity and integer check of the fractional part of two_f * cache * 2^beta, as in impl::compute_mul_parity
+BOOST_CHARCONV_BATCH_TARGET BOOST_FORCEINLINE void batch_mul_parity(batch_vec two_f, batch_vec cache, batch_vec beta, batch_vec& parity, batch_vec& is_integer) noexcept
+{
+    using ops = batch_ops;
+    const auto low32 = ops::set1(UINT64_C(0xFFFFFFFF));
+
+    // The lower 64 bits of the 96-bit product
+    const auto r = ops::add(ops::mul_32x32(two_f, cache), ops::sll<32>(ops::mul_32x32(two_f, ops::srl<32>(cache))));
+
+    parity = ops::and_(ops::srlv(r, ops::sub(ops::set1(64), beta)), ops::set1(1));
+    is_integer = ops::eq(ops::and_(ops::srlv(r, ops::sub(ops::set1(32), beta)), low32), ops::set1(0));
+}
+
+// Computes the shortest significand without trailing zeros and the decimal exponent of the lanes of values
+BOOST_CHARCONV_BATCH_TARGET BOOST_FORCEINLINE void batch_to_decimal(const float* values, std::uint64_t* significands, std::uint64_t* exponents,
+                                        const shorter_interval_table& shorter) noexcept
+{
+    using ops = batch_ops;
+    using cache_holder = cache_holder_ieee754_binary32;
+
+    const auto bits = ops::load(values);
+    const auto exponent_bits = ops::and_32(ops::srl_32<23>(bits), ops::set1_32(0xFF));
+    const auto significand_bits = ops::and_32(bits, ops::set1_32(0x7FFFFF));
+    const auto is_subnormal_32 = ops::eq_32(exponent_bits, ops::set1_32(0));
+
+    // Binary exponent, k and beta; the products fit into 32 bits for every binary32 exponent
+    const auto e = ops::blend_32(is_subnormal_32, ops::sub_32(exponent_bits, ops::set1_32(150)), ops::set1_32(-149));
+    const auto minus_k_32 = ops::sub_32(ops::sra_32<20>(ops::mul_32(e, ops::set1_32(315653))), ops::set1_32(1));
+    const auto k_32 = ops::sub_32(ops::set1_32(0), minus_k_32);
+    const auto beta_32 = ops::add_32(e, ops::sra_32<19>(ops::mul_32(k_32, ops::set1_32(1741647))));
+
+    const auto cache = ops::gather(cache_holder::cache, ops::sub_32(k_32, ops::set1_32(cache_holder::min_k)));
+    const auto beta = ops::widen(beta_32);
+    const auto minus_k = ops::widen(minus_k_32);
+    const auto is_subnormal = ops::widen(is_subnormal_32);
+
+    const auto zero = ops::set1(0);
+    const auto one = ops::set1(1);
+    const auto low32 = ops::set1(UINT64_C(0xFFFFFFFF));
+
+    const auto two_fc = ops::or_(ops::widen(ops::sll_32<1>(significand_bits)), ops::andnot(is_subnormal, ops::set1(UINT64_C(1) << 24)));
+    const auto is_even = ops::eq(ops::and_(two_fc, ops::set1(2)), zero);
+
+    // deltai and zi
+    const auto deltai = ops::srlv(cache, ops::sub(ops::set1(63), beta));
+    const auto u = ops::sllv(ops::or_(two_fc, one), beta);
+    const auto z = ops::add(ops::mul_32x32(u, ops::srl<32>(cache)), ops::srl<32>(ops::mul_32x32(u, cache)));
+    const auto zi = ops::srl<32>(z);
+    const auto is_z_integer = ops::eq(ops::and_(z, low32), zero);
+
+    // zi / 100 for every 32-bit zi
+    auto significand = ops::srl<37>(ops::mul_32x32(zi, ops::set1(1374389535)));
+    auto r = ops::sub(zi, ops::mul_32x32(significand, ops::set1(100)));
+
+    batch_vec x_parity;
+    batch_vec x_is_integer;
+    batch_mul_parity(ops::sub(two_fc, one), cache, beta, x_parity, x_is_integer);
+
+    // r == 0 below deltai with an excluded right endpoint moves to the smaller divisor with r = 100
+    const auto below = ops::gt(deltai, r);
+    const auto exclude_right = ops::and_(below, ops::andnot(is_even, ops::and_(ops::eq(r, zero), is_z_integer)));
+    const auto at = ops::and_(ops::eq(r, deltai), ops::or_(ops::eq(x_parity, one), ops::and_(x_is_integer, is_even)));
+    const auto big_divisor = ops::or_(ops::andnot(exclude_right, below), at);
+
+    significand = ops::add(significand, exclude_right);
+    r = ops::blend(exclude_right, r, ops::set1(100));
+
+    // The smaller divisor
+    auto dist = ops::add(ops::sub(r, ops::srl<1>(deltai)), ops::set1(5));
+    const auto approx_y_parity = ops::and_(ops::xor_(dist, ops::set1(5)), one);
+    dist = ops::mul_32x32(dist, ops::set1(6554));
+    const auto divisible = ops::gt(ops::set1(6554), ops::and_(dist, ops::set1(0xFFFF)));
+    auto small_significand = ops::add(ops::mul_32x32(significand, ops::set1(10)), ops::srl<16>(dist));
+
+    batch_vec y_parity;
+    batch_vec y_is_integer;
+    batch_mul_parity(two_fc, cache, beta, y_parity, y_is_integer);
+
+    const auto round_down = ops::or_(ops::xor_(ops::eq(y_parity, approx_y_parity), ops::set1(~UINT64_C(0))),
+                                     ops::and_(y_is_integer, ops::eq(ops::and_(small_significand, one), one)));
+    small_significand = ops::add(small_significand, ops::and_(divisible, round_down));
+
+    significand = ops::blend(big_divisor, small_significand, significand);
+    auto exponent = ops::add(minus_k, ops::blend(big_divisor, one, ops::set1(2)));
+
+    // Powers of two
+    const auto is_shorter = ops::andnot(is_subnormal, ops::widen(ops::eq_32(significand_bits, ops::set1_32(0))));
+    significand = ops::blend(is_shorter, significand, ops::gather(shorter.significand, exponent_bits));
+    exponent = ops::blend(is_shorter, exponent, ops::gather(shorter.exponent, exponent_bits));
+
+    // Remove trailing zeros two and then one at a time, as in impl::remove_trailing_zeros
+    const auto nonzero = ops::xor_(ops::eq(significand, zero), ops::set1(~UINT64_C(0)));
+    while (true)
+    {
+        const auto t = ops::and_(ops::mul_32x32(significand, ops::set1(UINT32_C(0xcccccccd) * UINT32_C(0xcccccccd))), low32);
+        const auto q = ops::and_(ops::or_(ops::srl<2>(t), ops::sll<30>(t)), low32);
+        const auto divisible_by_100 = ops::and_(nonzero, ops::gt(ops::set1(std::numeric_limits<std::uint32_t>::max() / 100 + 1), q));
+        if (!ops::any(divisible_by_100))
+        {
+            break;
+        }
+        significand = ops::blend(divisible_by_100, significand, q);
+        exponent = ops::sub(exponent, ops::add(divisible_by_100, divisible_by_100));
+    }
+
+    const auto t = ops::and_(ops::mul_32x32(significand, ops::set1(UINT32_C(0xcccccccd))), low32);
+    const auto q = ops::and_(ops::or_(ops::srl<1>(t), ops::sll<31>(t)), low32);
+    const auto divisible_by_10 = ops::and_(nonzero, ops::gt(ops::set1(std::numeric_limits<std::uint32_t>::max() / 10 + 1), q));
+    significand = ops::blend(divisible_by_10, significand, q);
+    exponent = ops::sub(exponent, divisible_by_10);
+
+    ops::store(significands, significand);
+    ops::store(exponents, exponent);
+}
+
+BOOST_CHARCONV_BATCH_TARGET static char* batch_format(char* first, char* last, const float* values, std::size_t count, char separator, chars_format fmt) noexcept
+{
+    constexpr std::size_t lanes = batch_ops::lanes;
+    const auto& shorter = get_shorter_interval_table();
+
+    std::size_t i = 0;
+    for (; i + lanes <= count; i += lanes)
+    {
+        std::uint64_t significands[lanes];
+        std::uint64_t exponents[lanes];
+        batch_to_decimal(values + i, significands, exponents, shorter);
+
+        for (std::size_t j = 0; j < lanes; ++j)
+        {
+            const float value = values[i + j];
+            if (std::isfinite(value) && value != 0)
+            {
+                first = write_shortest_float(first, last, value, static_cast<std::uint32_t>(significands[j]),
+                                             static_cast<int>(static_cast<std::int64_t>(exponents[j])), fmt);
+            }
+            else
+            {
+                first = to_chars(first, last, value, fmt).ptr;
+            }
+            *first++ = separator;
+        }
+    }
+
+    for (; i < count; ++i)
+    {
+        first = to_chars(first, last, values[i], fmt).ptr;
+        *first++ = separator;
+    }
+
+    return first;
+}
@@ -0,0 +1,242 @@
+// Copyright 2023 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/charconv/column_profile.hpp>
+#include <boost/charconv/from_chars.hpp>
+#include <boost/charconv/detail/parser.hpp>
+#include <system_error>
+#include <cstring>
+#include <cstddef>
+#include <cmath>
+
+namespace boost { namespace charconv { namespace detail {
+
+// Shape of a field that from_chars matches completely
+struct decimal_shape
+{
+    column_kind kind;
+    int digits;
+    int fraction_digits;
+    bool exponent;
+};
+
+static decimal_shape decimal_field_shape(const char* first, const char* last) noexcept
+{
+    decimal_shape shape {column_kind::integer, 0, 0, false};
+
+    if (*first == '-')
+    {
+        ++first;
+    }
+
+    if (!is_integer_char(*first) && *first != '.')
+    {
+        shape.kind = column_kind::floating;
+        return shape;
+    }
+
+    bool leading = true;
+    for (; first != last && is_integer_char(*first); ++first)
+    {
+        leading = leading && *first == '0';
+        shape.digits += leading ? 0 : 1;
+    }
+
+    if (first != last && *first == '.')
+    {
+        shape.kind = column_kind::fixed_point;
+        for (++first; first != last && is_integer_char(*first); ++first)
+        {
+            leading = leading && *first == '0';
+            shape.digits += leading ? 0 : 1;
+            ++shape.fraction_digits;
+        }
+    }
+
+    if (first != last)
+    {
+        shape.exponent = true;
+        shape.kind = column_kind::floating;
+    }
+    else if (shape.kind == column_kind::fixed_point && shape.digits > 19)
+    {
+        shape.kind = column_kind::floating;
+    }
+
+    return shape;
+}
+
+// Number of hexadecimal digits after an optional minus sign from the first non-zero one, or -1 for other fields
+static int hex_field_digits(const char* first, const char* last) noexcept
+{
+    if (*first == '-')
+    {
+        ++first;
+    }
+
+    if (first == last)
+    {
+        return -1;
+    }
+
+    while (first != last && *first == '0')
+    {
+        ++first;
+    }
+
+    int digits = 0;
+    for (; first != last; ++first, ++digits)
+    {
+        if (!is_hex_char(*first))
+        {
+            return -1;
+        }
+    }
+
+    return digits;
+}
+
+// The narrowest kind that covers a column of the kind profile.kind and the decimal field of the given kind and width
+static column_kind join_decimal(const column_profile& profile, column_kind kind, std::size_t width) noexcept
+{
+    if (kind == column_kind::integer)
+    {
+        if (profile.kind == column_kind::empty ||
+            (profile.kind == column_kind::fixed_width_integer && profile.min_width == width && profile.max_width == width))
+        {
+            return column_kind::fixed_width_integer;
+        }
+        if (profile.kind == column_kind::fixed_width_integer)
+        {
+            return column_kind::integer;
+        }
+    }
+
+    return static_cast<unsigned>(kind) > static_cast<unsigned>(profile.kind) ? kind : profile.kind;
+}
+
+static void profile_field_impl(column_profile& profile, const char* first, const char* last) noexcept
+{
+    ++profile.fields;
+    if (first == last)
+    {
+        ++profile.empty_fields;
+        return;
+    }
+
+    const auto width = static_cast<std::size_t>(last - first);
+    const int hex = hex_field_digits(first, last);
+
+    double value;
+    const auto r = from_chars_ext(first, last, value);
+    const bool decimal = r.ptr == last && (r.ec == std::errc() || r.ec == std::errc::result_out_of_range);
+
+    column_kind kind = column_kind::invalid;
+    if (decimal)
+    {
+        const auto shape = decimal_field_shape(first, last);
+        profile.max_digits = shape.digits > profile.max_digits ? shape.digits : profile.max_digits;
+        profile.max_fraction_digits = shape.fraction_digits > profile.max_fraction_digits ? shape.fraction_digits : profile.max_fraction_digits;
+        profile.needs_exponent = profile.needs_exponent || shape.exponent;
+        profile.has_nonfinite = profile.has_nonfinite || !std::isfinite(value);
+        profile.has_negative = profile.has_negative || *first == '-';
+        profile.exact_in_double = profile.exact_in_double && r.exact;
+
+        if (profile.kind == column_kind::hex)
+        {
+            kind = hex >= 0 ? column_kind::hex : column_kind::invalid;
+        }
+        else if (profile.kind != column_kind::invalid)
+        {
+            kind = join_decimal(profile, shape.kind, width);
+        }
+    }
+    else if (hex >= 0)
+    {
+        profile.has_negative = profile.has_negative || *first == '-';
+        kind = profile.hex_digits && profile.kind != column_kind::invalid ? column_kind::hex : column_kind::invalid;
+    }
+
+    if (!decimal && hex < 0)
+    {
+        ++profile.invalid_fields;
+    }
+
+    if (hex >= 0)
+    {
+        profile.max_hex_digits = hex > profile.max_hex_digits ? hex : profile.max_hex_digits;
+    }
+    profile.hex_digits = profile.hex_digits && hex >= 0;
+
+    if (profile.fields - profile.empty_fields == 1)
+    {
+        profile.min_width = width;
+        profile.max_width = width;
+    }
+    else
+    {
+        profile.min_width = width < profile.min_width ? width : profile.min_width;
+        profile.max_width = width > profile.max_width ? width : profile.max_width;
+    }
+
+    profile.kind = kind;
+}
+
+static column_profile profile_column_impl(const char* first, const char* last, char separator, std::size_t samples) noexcept
+{
+    column_profile profile;
+    if (first == last)
+    {
+        return profile;
+    }
+
+    const auto size = static_cast<std::size_t>(last - first);
+    if (samples == 0 || samples > size)
+    {
+        samples = size;
+    }
+
+    // Sample k is the field that starts at or after the k-th of samples evenly spaced positions,
+    // and next is the first position after the last field examined so far
+    const char* next = first;
+    for (std::size_t k = 0; k < samples && next != last; ++k)
+    {
+        const char* start = first + size / samples * k + size % samples * k / samples;
+        if (start <= next)
+        {
+            start = next;
+        }
+        else if (start[-1] != separator)
+        {
+            start = static_cast<const char*>(std::memchr(start, separator, static_cast<std::size_t>(last - start)));
+            if (start == nullptr || ++start == last)
+            {
+                break;
+            }
+        }
+
+        const char* end = static_cast<const char*>(std::memchr(start, separator, static_cast<std::size_t>(last - start)));
+        if (end == nullptr)
+        {
+            end = last;
+        }
+
+        profile_field_impl(profile, start, end);
+        next = end == last ? last : end + 1;
+    }
+
+    return profile;
+}
+
+}}} // Namespaces
+
+void boost::charconv::profile_field(boost::charconv::column_profile& profile, const char* first, const char* last) noexcept
+{
+    boost::charconv::detail::profile_field_impl(profile, first, last);
+}
+
+boost::charconv::column_profile boost::charconv::profile_column(const char* first, const char* last, char separator, std::size_t samples) noexcept
+{
+    return boost::charconv::detail::profile_column_impl(first, last, separator, samples);
+}
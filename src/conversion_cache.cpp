@@ -0,0 +1,249 @@
+// Copyright 2023 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/charconv/conversion_cache.hpp>
+#include <boost/charconv/from_chars.hpp>
+#include <boost/charconv/to_chars.hpp>
+#include <boost/config.hpp>
+#include <system_error>
+#include <memory>
+#include <new>
+#include <cstring>
+#include <cstdint>
+#include <cstddef>
+
+#ifndef BOOST_NO_CXX11_THREAD_LOCAL
+
+namespace boost { namespace charconv { namespace detail {
+
+struct to_chars_cache_entry
+{
+    std::uint64_t bits;
+    std::int32_t precision;
+    std::uint8_t fmt;
+    std::uint8_t size; // Zero for an empty slot
+    char chars[conversion_cache_max_chars];
+};
+
+struct from_chars_cache_entry
+{
+    double value;
+    std::uint8_t fmt;
+    std::uint8_t size; // Zero for an empty slot
+    std::uint8_t matched; // Number of characters consumed by from_chars
+    char chars[conversion_cache_max_chars];
+};
+
+struct conversion_cache
+{
+    std::unique_ptr<to_chars_cache_entry[]> to_chars_entries;
+    std::unique_ptr<from_chars_cache_entry[]> from_chars_entries;
+    std::size_t size;
+    bool initialized;
+    conversion_cache_stats stats;
+};
+
+static thread_local conversion_cache thread_cache {};
+
+static bool resize(conversion_cache& cache, std::size_t entries) noexcept
+{
+    std::size_t size = 1;
+    while (size <= entries / 2)
+    {
+        size *= 2;
+    }
+
+    cache.initialized = true;
+    cache.size = 0;
+    cache.to_chars_entries.reset();
+    cache.from_chars_entries.reset();
+
+    if (entries == 0)
+    {
+        return true;
+    }
+
+    // Value initialization marks every slot as empty
+    cache.to_chars_entries.reset(new (std::nothrow) to_chars_cache_entry[size]());
+    cache.from_chars_entries.reset(new (std::nothrow) from_chars_cache_entry[size]());
+    if (!cache.to_chars_entries || !cache.from_chars_entries)
+    {
+        cache.to_chars_entries.reset();
+        cache.from_chars_entries.reset();
+        return false;
+    }
+
+    cache.size = size;
+    return true;
+}
+
+static conversion_cache& get_cache() noexcept
+{
+    conversion_cache& cache = thread_cache;
+    if (BOOST_UNLIKELY(!cache.initialized))
+    {
+        resize(cache, default_conversion_cache_size);
+    }
+    return cache;
+}
+
+static std::size_t slot(std::uint64_t key, std::size_t size) noexcept
+{
+    key *= UINT64_C(0x9E3779B97F4A7C15);
+    return static_cast<std::size_t>(key ^ (key >> 32)) & (size - 1);
+}
+
+static std::size_t slot(const char* first, std::size_t n, chars_format fmt, std::size_t size) noexcept
+{
+    char chars[conversion_cache_max_chars] {};
+    std::memcpy(chars, first, n);
+
+    std::uint64_t words[3];
+    std::memcpy(words, chars, sizeof(words));
+
+    const std::uint64_t key = (words[0] * UINT64_C(0xC2B2AE3D27D4EB4F)) ^ (words[1] * UINT64_C(0x165667B19E3779F9)) ^
+                              (words[2] * UINT64_C(0x85EBCA77C2B2AE63)) ^ (n << 8) ^ static_cast<std::uint64_t>(fmt);
+    return slot(key ^ (key >> 29), size);
+}
+
+static_assert(conversion_cache_max_chars == 3 * sizeof(std::uint64_t), "The input hash reads three words");
+
+}}} // Namespaces
+
+bool boost::charconv::set_conversion_cache_size(std::size_t entries) noexcept
+{
+    return boost::charconv::detail::resize(boost::charconv::detail::thread_cache, entries);
+}
+
+std::size_t boost::charconv::conversion_cache_size() noexcept
+{
+    return boost::charconv::detail::get_cache().size;
+}
+
+boost::charconv::conversion_cache_stats boost::charconv::get_conversion_cache_stats() noexcept
+{
+    return boost::charconv::detail::thread_cache.stats;
+}
+
+void boost::charconv::reset_conversion_cache_stats() noexcept
+{
+    boost::charconv::detail::thread_cache.stats = boost::charconv::conversion_cache_stats {};
+}
+
+boost::charconv::to_chars_result boost::charconv::cached_to_chars(char* first, char* last, double value,
+                                                                  boost::charconv::chars_format fmt, int precision) noexcept
+{
+    auto& cache = boost::charconv::detail::get_cache();
+    if (cache.size == 0)
+    {
+        return boost::charconv::to_chars(first, last, value, fmt, precision);
+    }
+
+    std::uint64_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+
+    const std::uint64_t key = bits ^ (static_cast<std::uint64_t>(static_cast<std::uint32_t>(precision)) << 3) ^
+                              static_cast<std::uint64_t>(fmt);
+    auto& entry = cache.to_chars_entries[boost::charconv::detail::slot(key, cache.size)];
+
+    if (entry.size != 0 && entry.bits == bits && entry.precision == precision && entry.fmt == static_cast<std::uint8_t>(fmt))
+    {
+        ++cache.stats.to_chars_hits;
+        if (entry.size > last - first)
+        {
+            return {last, std::errc::result_out_of_range};
+        }
+        std::memcpy(first, entry.chars, entry.size);
+        return {first + entry.size, std::errc()};
+    }
+
+    ++cache.stats.to_chars_misses;
+    const auto r = boost::charconv::to_chars(first, last, value, fmt, precision);
+    const auto size = static_cast<std::size_t>(r.ptr - first);
+
+    if (r.ec == std::errc() && size != 0 && size <= boost::charconv::conversion_cache_max_chars)
+    {
+        entry.bits = bits;
+        entry.precision = precision;
+        entry.fmt = static_cast<std::uint8_t>(fmt);
+        entry.size = static_cast<std::uint8_t>(size);
+        std::memcpy(entry.chars, first, size);
+    }
+
+    return r;
+}
+
+boost::charconv::from_chars_result boost::charconv::cached_from_chars(const char* first, const char* last, double& value,
+                                                                      boost::charconv::chars_format fmt) noexcept
+{
+    auto& cache = boost::charconv::detail::get_cache();
+    const auto size = static_cast<std::size_t>(last - first);
+    if (cache.size == 0 || size == 0 || size > boost::charconv::conversion_cache_max_chars)
+    {
+        if (cache.size != 0)
+        {
+            ++cache.stats.from_chars_misses;
+        }
+        return boost::charconv::from_chars(first, last, value, fmt);
+    }
+
+    auto& entry = cache.from_chars_entries[boost::charconv::detail::slot(first, size, fmt, cache.size)];
+
+    if (entry.size == size && entry.fmt == static_cast<std::uint8_t>(fmt) && std::memcmp(entry.chars, first, size) == 0)
+    {
+        ++cache.stats.from_chars_hits;
+        value = entry.value;
+        return {first + entry.matched, std::errc()};
+    }
+
+    ++cache.stats.from_chars_misses;
+    const auto r = boost::charconv::from_chars(first, last, value, fmt);
+
+    // Only successful conversions are stored, since failures may leave value unchanged
+    if (r.ec == std::errc())
+    {
+        entry.value = value;
+        entry.fmt = static_cast<std::uint8_t>(fmt);
+        entry.size = static_cast<std::uint8_t>(size);
+        entry.matched = static_cast<std::uint8_t>(r.ptr - first);
+        std::memcpy(entry.chars, first, size);
+    }
+
+    return r;
+}
+
+#else // Without thread_local storage the functions always convert
+
+bool boost::charconv::set_conversion_cache_size(std::size_t entries) noexcept
+{
+    return entries == 0;
+}
+
+std::size_t boost::charconv::conversion_cache_size() noexcept
+{
+    return 0;
+}
+
+boost::charconv::conversion_cache_stats boost::charconv::get_conversion_cache_stats() noexcept
+{
+    return boost::charconv::conversion_cache_stats {};
+}
+
+void boost::charconv::reset_conversion_cache_stats() noexcept
+{
+}
+
+boost::charconv::to_chars_result boost::charconv::cached_to_chars(char* first, char* last, double value,
+                                                                  boost::charconv::chars_format fmt, int precision) noexcept
+{
+    return boost::charconv::to_chars(first, last, value, fmt, precision);
+}
+
+boost::charconv::from_chars_result boost::charconv::cached_from_chars(const char* first, const char* last, double& value,
+                                                                      boost::charconv::chars_format fmt) noexcept
+{
+    return boost::charconv::from_chars(first, last, value, fmt);
+}
+
+#endif // BOOST_NO_CXX11_THREAD_LOCAL
@@ -13,13 +13,20 @@
 
 #include <boost/charconv/detail/fast_float/fast_float.hpp>
 #include <boost/charconv/detail/from_chars_float_impl.hpp>
+#include <boost/charconv/detail/fixed_width_records.hpp>
 #include <boost/charconv/from_chars.hpp>
+#include <boost/charconv/sortable.hpp>
 #include <boost/charconv/detail/bit_layouts.hpp>
+#include <boost/charconv/detail/integer_search_trees.hpp>
+#include <boost/core/bit.hpp>
 #include <system_error>
 #include <string>
 #include <cstdlib>
 #include <cerrno>
 #include <cstring>
+#include <cstdint>
+#include <cstddef>
+#include <cmath>
 #include <limits>
 
 #if BOOST_CHARCONV_LDBL_BITS > 64
@@ -27,6 +34,23 @@
 #  include <boost/charconv/detail/emulated128.hpp>
 #endif
 
+#if !defined(BOOST_CHARCONV_NO_SIMD) && !defined(BOOST_CHARCONV_NO_AVX2)
+#  if defined(BOOST_CHARCONV_HAS_RUNTIME_DISPATCH)
+#    define BOOST_CHARCONV_FIXED_WIDTH_AVX2
+#    ifndef BOOST_CHARCONV_NO_AVX512
+#      define BOOST_CHARCONV_FIXED_WIDTH_AVX512
+#    endif
+#  elif defined(__AVX512F__) && defined(__AVX512BW__) && defined(__AVX512DQ__) && !defined(BOOST_CHARCONV_NO_AVX512)
+#    define BOOST_CHARCONV_FIXED_WIDTH_AVX512
+#  elif defined(__AVX2__)
+#    define BOOST_CHARCONV_FIXED_WIDTH_AVX2
+#  endif
+#endif
+
+#if defined(BOOST_CHARCONV_FIXED_WIDTH_AVX2) || defined(BOOST_CHARCONV_FIXED_WIDTH_AVX512)
+#  include <immintrin.h>
+#endif
+
 #if defined(__GNUC__) && __GNUC__ < 5
 # pragma GCC diagnostic ignored "-Wmissing-field-initializers"
 #endif
@@ -49,6 +73,557 @@ boost::charconv::from_chars_result boost::charconv::from_chars(const char* first
     return boost::charconv::detail::from_chars_float_impl(first, last, value, fmt);
 }
 
+boost::charconv::from_chars_result boost::charconv::from_chars_padded(const char* first, const char* last, float& value, boost::charconv::chars_format fmt) noexcept
+{
+    if (fmt != boost::charconv::chars_format::hex)
+    {
+        return boost::charconv::detail::fast_float::from_chars_padded(first, last, value, fmt);
+    }
+    return boost::charconv::detail::from_chars_float_impl(first, last, value, fmt);
+}
+
+boost::charconv::from_chars_result boost::charconv::from_chars_padded(const char* first, const char* last, double& value, boost::charconv::chars_format fmt) noexcept
+{
+    if (fmt != boost::charconv::chars_format::hex)
+    {
+        return boost::charconv::detail::fast_float::from_chars_padded(first, last, value, fmt);
+    }
+    return boost::charconv::detail::from_chars_float_impl(first, last, value, fmt);
+}
+
+namespace boost { namespace charconv { namespace detail {
+
+// Whether significand * 10^exponent is representable in T, where significand is not a multiple of 10
+template <typename T>
+static bool is_exact_decimal(std::uint64_t significand, std::int64_t exponent) noexcept
+{
+    constexpr std::uint64_t limit = UINT64_C(1) << (fast_float::binary_format<T>::mantissa_explicit_bits() + 1);
+
+    if (significand == 0)
+    {
+        return true;
+    }
+
+    // A negative power of ten needs the same power of five in the significand to leave only a power of two
+    for (; exponent < 0; ++exponent)
+    {
+        if (significand % 5 != 0)
+        {
+            return false;
+        }
+        significand /= 5;
+    }
+
+    significand >>= boost::core::countr_zero(significand);
+    for (; exponent > 0 && significand < limit; --exponent)
+    {
+        significand *= 5;
+    }
+
+    return significand < limit;
+}
+
+// Digit i of the digits before and after the decimal point
+static char digit_at(const fast_float::parsed_number_string& pns, std::size_t i) noexcept
+{
+    return i < pns.integer.len() ? pns.integer[i] : pns.fraction[i - pns.integer.len()];
+}
+
+// The same test for more than 19 significant digits. All the digits of the text are compared with value
+// as big integers, which only happens for unusually long inputs.
+template <typename T>
+static bool is_exact_long_decimal(fast_float::parsed_number_string& pns, T value, std::size_t digits) noexcept
+{
+    if (value == 0)
+    {
+        return digits == 0;
+    }
+
+    return fast_float::compare_digits<T>(pns, std::abs(value)) == 0;
+}
+
+template <typename T>
+static from_chars_ext_result from_chars_ext_impl(const char* first, const char* last, T& value, chars_format fmt) noexcept
+{
+    from_chars_ext_result result {first, std::errc::invalid_argument, 0, 0, false};
+
+    if (fmt == chars_format::hex)
+    {
+        const auto r = from_chars_float_impl(first, last, value, fmt);
+        result.ptr = r.ptr;
+        result.ec = r.ec;
+        return result;
+    }
+
+    if (first == last)
+    {
+        return result;
+    }
+
+    fast_float::parsed_number_string pns = fast_float::parse_number_string(first, last, fast_float::parse_options{fmt});
+    if (!pns.valid)
+    {
+        const auto r = fast_float::detail::parse_infnan(first, last, value);
+        result.ptr = r.ptr;
+        result.ec = r.ec;
+        result.exact = r.ec == std::errc();
+        return result;
+    }
+
+    const auto r = fast_float::from_chars_parsed<T, char, false>(pns, value);
+    result.ptr = r.ptr;
+    result.ec = r.ec;
+
+    if (!pns.too_many_digits)
+    {
+        std::uint64_t significand = pns.mantissa;
+        std::int64_t exponent = pns.exponent;
+        if (significand != 0)
+        {
+            while (significand % 10 == 0)
+            {
+                significand /= 10;
+                ++exponent;
+            }
+            result.digits = static_cast<std::size_t>(num_digits(significand));
+            result.exponent = exponent;
+        }
+
+        result.exact = r.ec == std::errc() && is_exact_decimal<T>(significand, exponent);
+        return result;
+    }
+
+    // The parser kept only the first 19 significant digits, so count them all from the text
+    const std::size_t total = pns.integer.len() + pns.fraction.len();
+    std::size_t leading_zeros = 0;
+    while (digit_at(pns, leading_zeros) == '0')
+    {
+        ++leading_zeros;
+    }
+    std::size_t trailing_zeros = 0;
+    while (digit_at(pns, total - 1 - trailing_zeros) == '0')
+    {
+        ++trailing_zeros;
+    }
+
+    // pns.exponent belongs to the first 19 significant digits, which end 19 digits after the leading zeros
+    const auto explicit_exponent = pns.exponent - (static_cast<std::int64_t>(pns.integer.len()) - static_cast<std::int64_t>(leading_zeros + 19));
+
+    result.digits = total - leading_zeros - trailing_zeros;
+    result.exponent = explicit_exponent - static_cast<std::int64_t>(pns.fraction.len()) + static_cast<std::int64_t>(trailing_zeros);
+    result.exact = r.ec == std::errc() && is_exact_long_decimal(pns, value, result.digits);
+
+    return result;
+}
+
+// The digits of the key are handed to fast_float as if they had been parsed from text,
+// which gives the correctly rounded value also for keys with more than 19 digits
+template <typename T>
+static from_chars_result from_chars_sortable_impl(const char* first, const char* last, T& value) noexcept
+{
+    sortable_decimal dec;
+    const auto r = read_sortable(first, last, dec);
+    if (r.ec != std::errc())
+    {
+        return r;
+    }
+
+    switch (dec.kind)
+    {
+        case 'A':
+            value = -std::numeric_limits<T>::infinity();
+            return r;
+        case 'C':
+            value = 0;
+            return r;
+        case 'E':
+            value = std::numeric_limits<T>::infinity();
+            return r;
+        case 'F':
+            value = std::numeric_limits<T>::quiet_NaN();
+            return r;
+        default:
+            break;
+    }
+
+    fast_float::parsed_number_string pns;
+    pns.negative = dec.negative;
+    pns.valid = true;
+    pns.lastmatch = dec.digits + dec.size;
+    pns.integer = fast_float::span<const char>(dec.digits, dec.size);
+
+    const std::size_t mantissa_digits = dec.size > 19 ? 19 : dec.size;
+    for (std::size_t i = 0; i < mantissa_digits; ++i)
+    {
+        pns.mantissa = pns.mantissa * 10 + static_cast<std::uint64_t>(dec.digits[i] - '0');
+    }
+    pns.exponent = dec.exponent - static_cast<std::int64_t>(mantissa_digits);
+    pns.too_many_digits = dec.size > 19;
+
+    const auto result = fast_float::from_chars_parsed<T, char, false>(pns, value);
+    return {r.ptr, result.ec};
+}
+
+// The next float away from zero, for a positive value packed as fast_float does
+template <typename T>
+static fast_float::adjusted_mantissa next_float(fast_float::adjusted_mantissa am) noexcept
+{
+    ++am.mantissa;
+    if (am.mantissa == (UINT64_C(1) << fast_float::binary_format<T>::mantissa_explicit_bits()))
+    {
+        am.mantissa = 0;
+        ++am.power2;
+    }
+    return am;
+}
+
+// A single product with the power of five gives the float below the number and whether the number
+// is that float. Only when the product is too close to a float to tell, or the digits beyond the
+// first 19 could move the number across one, the correctly rounded value is compared with the digits.
+template <typename T>
+static from_chars_result from_chars_interval_impl(const char* first, const char* last, T& lo, T& hi, chars_format fmt) noexcept
+{
+    if (fmt == chars_format::hex)
+    {
+        // Only the rounded value is known, and the number may be on either side of it
+        T value;
+        const auto r = from_chars_float_impl(first, last, value, fmt);
+        if (r.ec == std::errc())
+        {
+            lo = std::nextafter(value, -std::numeric_limits<T>::infinity());
+            hi = std::nextafter(value, std::numeric_limits<T>::infinity());
+        }
+        return r;
+    }
+
+    if (first == last)
+    {
+        return {first, std::errc::invalid_argument};
+    }
+
+    fast_float::parsed_number_string pns = fast_float::parse_number_string(first, last, fast_float::parse_options{fmt});
+    if (!pns.valid)
+    {
+        T value;
+        const auto r = fast_float::detail::parse_infnan(first, last, value);
+        if (r.ec == std::errc())
+        {
+            lo = value;
+            hi = value;
+        }
+        return {r.ptr, r.ec};
+    }
+
+    using binary = fast_float::binary_format<T>;
+    const bool negative = pns.negative;
+
+    bool exact;
+    fast_float::adjusted_mantissa below = fast_float::compute_float_truncated<binary>(pns.exponent, pns.mantissa, exact);
+    if (pns.too_many_digits && below.power2 >= 0)
+    {
+        // The number is at or above the first 19 digits and below the next 19 digit number
+        bool plus_exact;
+        if (exact || below != fast_float::compute_float_truncated<binary>(pns.exponent, pns.mantissa + 1, plus_exact) || plus_exact)
+        {
+            below.power2 = -1;
+        }
+    }
+
+    T lo_abs;
+    T hi_abs;
+    if (below.power2 >= 0)
+    {
+        fast_float::to_float(false, below, lo_abs);
+        if (exact)
+        {
+            hi_abs = lo_abs;
+        }
+        else
+        {
+            fast_float::to_float(false, next_float<T>(below), hi_abs);
+        }
+    }
+    else
+    {
+        pns.negative = false;
+        fast_float::from_chars_parsed<T, char, false>(pns, lo_abs);
+        hi_abs = lo_abs;
+
+        if (!pns.too_many_digits && is_exact_decimal<T>(pns.mantissa, pns.exponent))
+        {
+            // Exact values with a negative exponent, the rounded value is the number
+        }
+        else if (lo_abs == std::numeric_limits<T>::infinity())
+        {
+            lo_abs = (std::numeric_limits<T>::max)();
+        }
+        else if (lo_abs == 0)
+        {
+            hi_abs = std::numeric_limits<T>::denorm_min();
+        }
+        else
+        {
+            const int ord = fast_float::compare_digits<T>(pns, lo_abs);
+            if (ord > 0)
+            {
+                hi_abs = std::nextafter(lo_abs, std::numeric_limits<T>::infinity());
+            }
+            else if (ord < 0)
+            {
+                lo_abs = std::nextafter(lo_abs, T(0));
+            }
+        }
+    }
+
+    lo = negative ? -hi_abs : lo_abs;
+    hi = negative ? -lo_abs : hi_abs;
+
+    // Like from_chars, numbers beyond the finite range or below the smallest subnormal are out of range
+    const bool out_of_range = hi_abs == std::numeric_limits<T>::infinity() || (lo_abs == 0 && hi_abs != 0);
+    return {pns.lastmatch, out_of_range ? std::errc::result_out_of_range : std::errc()};
+}
+
+#ifdef BOOST_CHARCONV_FIXED_WIDTH_AVX512
+
+namespace avx512 {
+
+#define BOOST_CHARCONV_FIXED_WIDTH_TARGET BOOST_CHARCONV_TARGET("avx512f,avx512bw,avx512dq")
+
+// The AVX-512 intrinsics of GCC start from _mm512_undefined_epi32, which it then reports as uninitialized
+#if defined(__GNUC__) && !defined(__clang__)
+#  pragma GCC diagnostic push
+#  pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+
+constexpr std::size_t fixed_width_lanes = 8;
+
+// The significands of the four records in the 128-bit lanes of chars, in the 64-bit elements 0, 2, 4 and 6.
+// The digits are combined in pairs with pmaddubsw, then in fours and eights with pmaddwd.
+BOOST_CHARCONV_FIXED_WIDTH_TARGET BOOST_FORCEINLINE __m512i fixed_width_digits(__m512i chars, const fixed_width_simd_layout& simd, bool* matched) noexcept
+{
+    const __m512i d = _mm512_sub_epi8(chars, _mm512_set1_epi8('0'));
+    const std::uint64_t is_digit = _mm512_cmple_epu8_mask(d, _mm512_set1_epi8(9));
+    const std::uint64_t is_point = _mm512_cmpeq_epi8_mask(chars, _mm512_set1_epi8('.'));
+    match_fixed_width_lanes(is_digit, is_point, simd, matched, 4);
+
+    const __m128i shuffle = _mm_loadu_si128(reinterpret_cast<const __m128i*>(simd.shuffle));
+    const __m512i digits = _mm512_shuffle_epi8(d, _mm512_broadcast_i32x4(shuffle));
+    const __m512i pairs = _mm512_maddubs_epi16(digits, _mm512_set1_epi16(0x010A));
+    const __m512i fours = _mm512_madd_epi16(pairs, _mm512_set1_epi32(0x00010064));
+    const __m512i eights = _mm512_madd_epi16(_mm512_packus_epi32(fours, fours), _mm512_set1_epi32(0x00012710));
+    return _mm512_add_epi64(_mm512_mul_epu32(eights, _mm512_set1_epi64(100000000)), _mm512_srli_epi64(eights, 32));
+}
+
+BOOST_CHARCONV_FIXED_WIDTH_TARGET BOOST_FORCEINLINE __m512i load_four_records(const char* rec, std::size_t stride) noexcept
+{
+    __m512i v = _mm512_castsi128_si512(_mm_loadu_si128(reinterpret_cast<const __m128i*>(rec)));
+    v = _mm512_inserti32x4(v, _mm_loadu_si128(reinterpret_cast<const __m128i*>(rec + stride)), 1);
+    v = _mm512_inserti32x4(v, _mm_loadu_si128(reinterpret_cast<const __m128i*>(rec + 2 * stride)), 2);
+    return _mm512_inserti32x4(v, _mm_loadu_si128(reinterpret_cast<const __m128i*>(rec + 3 * stride)), 3);
+}
+
+// Checks and converts the eight records starting at rec. Each record is read as 16 characters.
+BOOST_CHARCONV_FIXED_WIDTH_TARGET BOOST_FORCEINLINE void decode_fixed_width_block(const char* rec, std::size_t stride, const fixed_width_simd_layout& simd,
+                                                                                  std::uint64_t* significands, bool* matched) noexcept
+{
+    const __m512i a = fixed_width_digits(load_four_records(rec, stride), simd, matched);
+    const __m512i b = fixed_width_digits(load_four_records(rec + 4 * stride, stride), simd, matched + 4);
+
+    // The even elements of a and b, in record order
+    const __m512i v = _mm512_permutex2var_epi64(a, _mm512_setr_epi64(0, 2, 4, 6, 8, 10, 12, 14), b);
+    _mm512_storeu_si512(significands, v);
+}
+
+// Clinger's fast path for a block: every significand is at most 2^52 and 10^fraction_digits is exact
+BOOST_CHARCONV_FIXED_WIDTH_TARGET BOOST_FORCEINLINE __m512d clinger_fixed_width_block(const std::uint64_t* significands, const bool* negative, double pow10) noexcept
+{
+    const __m512d x = _mm512_cvtepu64_pd(_mm512_loadu_si512(significands));
+
+    __mmask8 sign_mask = 0;
+    for (unsigned i = 0; i < 8; ++i)
+    {
+        sign_mask = static_cast<__mmask8>(sign_mask | (static_cast<unsigned>(negative[i]) << i));
+    }
+    const __m512i sign = _mm512_maskz_set1_epi64(sign_mask, INT64_MIN);
+    return _mm512_xor_pd(_mm512_div_pd(x, _mm512_set1_pd(pow10)), _mm512_castsi512_pd(sign));
+}
+
+BOOST_CHARCONV_FIXED_WIDTH_TARGET BOOST_FORCEINLINE void store_fixed_width_block(double* values, __m512d x) noexcept
+{
+    _mm512_storeu_pd(values, x);
+}
+
+BOOST_CHARCONV_FIXED_WIDTH_TARGET BOOST_FORCEINLINE void store_fixed_width_block(float* values, __m512d x) noexcept
+{
+    _mm256_storeu_ps(values, _mm512_cvtpd_ps(x));
+}
+
+#include "from_chars_fixed_width_kernel.ipp"
+
+#if defined(__GNUC__) && !defined(__clang__)
+#  pragma GCC diagnostic pop
+#endif
+
+#undef BOOST_CHARCONV_FIXED_WIDTH_TARGET
+
+} // namespace avx512
+
+#endif // BOOST_CHARCONV_FIXED_WIDTH_AVX512
+
+#ifdef BOOST_CHARCONV_FIXED_WIDTH_AVX2
+
+namespace avx2 {
+
+#define BOOST_CHARCONV_FIXED_WIDTH_TARGET BOOST_CHARCONV_TARGET("avx2")
+
+constexpr std::size_t fixed_width_lanes = 4;
+
+// The significands of the two records in the halves of chars, in the 64-bit elements 0 and 2.
+// The digits are combined in pairs with pmaddubsw, then in fours and eights with pmaddwd.
+BOOST_CHARCONV_FIXED_WIDTH_TARGET BOOST_FORCEINLINE __m256i fixed_width_digits(__m256i chars, const fixed_width_simd_layout& simd, bool* matched) noexcept
+{
+    const __m256i d = _mm256_sub_epi8(chars, _mm256_set1_epi8('0'));
+    const auto is_digit = static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_max_epu8(d, _mm256_set1_epi8(9)), _mm256_set1_epi8(9))));
+    const auto is_point = static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(chars, _mm256_set1_epi8('.'))));
+    match_fixed_width_lanes(is_digit, is_point, simd, matched, 2);
+
+    const __m128i shuffle = _mm_loadu_si128(reinterpret_cast<const __m128i*>(simd.shuffle));
+    const __m256i digits = _mm256_shuffle_epi8(d, _mm256_broadcastsi128_si256(shuffle));
+    const __m256i pairs = _mm256_maddubs_epi16(digits, _mm256_set1_epi16(0x010A));
+    const __m256i fours = _mm256_madd_epi16(pairs, _mm256_set1_epi32(0x00010064));
+    const __m256i eights = _mm256_madd_epi16(_mm256_packus_epi32(fours, fours), _mm256_set1_epi32(0x00012710));
+    return _mm256_add_epi64(_mm256_mul_epu32(eights, _mm256_set1_epi64x(100000000)), _mm256_srli_epi64(eights, 32));
+}
+
+BOOST_CHARCONV_FIXED_WIDTH_TARGET BOOST_FORCEINLINE __m256i load_two_records(const char* rec, std::size_t stride) noexcept
+{
+    const __m128i lo = _mm_loadu_si128(reinterpret_cast<const __m128i*>(rec));
+    const __m128i hi = _mm_loadu_si128(reinterpret_cast<const __m128i*>(rec + stride));
+    return _mm256_inserti128_si256(_mm256_castsi128_si256(lo), hi, 1);
+}
+
+// Checks and converts the four records starting at rec. Each record is read as 16 characters.
+BOOST_CHARCONV_FIXED_WIDTH_TARGET BOOST_FORCEINLINE void decode_fixed_width_block(const char* rec, std::size_t stride, const fixed_width_simd_layout& simd,
+                                                                                  std::uint64_t* significands, bool* matched) noexcept
+{
+    const __m256i a = fixed_width_digits(load_two_records(rec, stride), simd, matched);
+    const __m256i b = fixed_width_digits(load_two_records(rec + 2 * stride, stride), simd, matched + 2);
+
+    // Elements 0 and 2 of a and b, in record order
+    const __m256i v = _mm256_permute4x64_epi64(_mm256_unpacklo_epi64(a, b), 0xD8);
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(significands), v);
+}
+
+// Clinger's fast path for a block: every significand is at most 2^52 and 10^fraction_digits is exact
+BOOST_CHARCONV_FIXED_WIDTH_TARGET BOOST_FORCEINLINE __m256d clinger_fixed_width_block(const std::uint64_t* significands, const bool* negative, double pow10) noexcept
+{
+    const __m256i magic = _mm256_set1_epi64x(INT64_C(0x4330000000000000));
+    const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(significands));
+    const __m256d x = _mm256_sub_pd(_mm256_castsi256_pd(_mm256_or_si256(v, magic)), _mm256_castsi256_pd(magic));
+
+    const __m256i sign = _mm256_set_epi64x(negative[3] ? INT64_MIN : 0, negative[2] ? INT64_MIN : 0,
+                                           negative[1] ? INT64_MIN : 0, negative[0] ? INT64_MIN : 0);
+    return _mm256_xor_pd(_mm256_div_pd(x, _mm256_set1_pd(pow10)), _mm256_castsi256_pd(sign));
+}
+
+BOOST_CHARCONV_FIXED_WIDTH_TARGET BOOST_FORCEINLINE void store_fixed_width_block(double* values, __m256d x) noexcept
+{
+    _mm256_storeu_pd(values, x);
+}
+
+BOOST_CHARCONV_FIXED_WIDTH_TARGET BOOST_FORCEINLINE void store_fixed_width_block(float* values, __m256d x) noexcept
+{
+    _mm_storeu_ps(values, _mm256_cvtpd_ps(x));
+}
+
+#include "from_chars_fixed_width_kernel.ipp"
+
+#undef BOOST_CHARCONV_FIXED_WIDTH_TARGET
+
+} // namespace avx2
+
+#endif // BOOST_CHARCONV_FIXED_WIDTH_AVX2
+
+template <typename T>
+static from_chars_result from_chars_fixed_width_dispatch(const char* first, std::size_t width, std::size_t stride, T* values, std::size_t count) noexcept
+{
+    #ifdef BOOST_CHARCONV_FIXED_WIDTH_AVX512
+    if (BOOST_CHARCONV_CPU_SUPPORTS("avx512f") && BOOST_CHARCONV_CPU_SUPPORTS("avx512bw") && BOOST_CHARCONV_CPU_SUPPORTS("avx512dq"))
+    {
+        return avx512::from_chars_fixed_width(first, width, stride, values, count);
+    }
+    #endif
+
+    #ifdef BOOST_CHARCONV_FIXED_WIDTH_AVX2
+    if (BOOST_CHARCONV_CPU_SUPPORTS("avx2"))
+    {
+        return avx2::from_chars_fixed_width(first, width, stride, values, count);
+    }
+    #endif
+
+    return from_chars_fixed_width(first, width, stride, values, count);
+}
+
+}}} // Namespaces
+
+boost::charconv::from_chars_ext_result boost::charconv::from_chars_ext(const char* first, const char* last, float& value, boost::charconv::chars_format fmt) noexcept
+{
+    return boost::charconv::detail::from_chars_ext_impl(first, last, value, fmt);
+}
+
+boost::charconv::from_chars_ext_result boost::charconv::from_chars_ext(const char* first, const char* last, double& value, boost::charconv::chars_format fmt) noexcept
+{
+    return boost::charconv::detail::from_chars_ext_impl(first, last, value, fmt);
+}
+
+boost::charconv::from_chars_result boost::charconv::from_chars_fixed_width(const char* first, std::size_t width, std::size_t stride, float* values, std::size_t count) noexcept
+{
+    return boost::charconv::detail::from_chars_fixed_width_dispatch(first, width, stride, values, count);
+}
+
+boost::charconv::from_chars_result boost::charconv::from_chars_fixed_width(const char* first, std::size_t width, std::size_t stride, double* values, std::size_t count) noexcept
+{
+    return boost::charconv::detail::from_chars_fixed_width_dispatch(first, width, stride, values, count);
+}
+
+boost::charconv::from_chars_result boost::charconv::from_chars_faithful(const char* first, const char* last, float& value, boost::charconv::chars_format fmt) noexcept
+{
+    if (fmt != boost::charconv::chars_format::hex)
+    {
+        return boost::charconv::detail::fast_float::from_chars_faithful(first, last, value, fmt);
+    }
+    return boost::charconv::detail::from_chars_float_impl(first, last, value, fmt);
+}
+
+boost::charconv::from_chars_result boost::charconv::from_chars_faithful(const char* first, const char* last, double& value, boost::charconv::chars_format fmt) noexcept
+{
+    if (fmt != boost::charconv::chars_format::hex)
+    {
+        return boost::charconv::detail::fast_float::from_chars_faithful(first, last, value, fmt);
+    }
+    return boost::charconv::detail::from_chars_float_impl(first, last, value, fmt);
+}
+
+boost::charconv::from_chars_result boost::charconv::from_chars_interval(const char* first, const char* last, float& lo, float& hi, boost::charconv::chars_format fmt) noexcept
+{
+    return boost::charconv::detail::from_chars_interval_impl(first, last, lo, hi, fmt);
+}
+
+boost::charconv::from_chars_result boost::charconv::from_chars_interval(const char* first, const char* last, double& lo, double& hi, boost::charconv::chars_format fmt) noexcept
+{
+    return boost::charconv::detail::from_chars_interval_impl(first, last, lo, hi, fmt);
+}
+
+boost::charconv::from_chars_result boost::charconv::from_chars_sortable(const char* first, const char* last, float& value) noexcept
+{
+    return boost::charconv::detail::from_chars_sortable_impl(first, last, value);
+}
+
+boost::charconv::from_chars_result boost::charconv::from_chars_sortable(const char* first, const char* last, double& value) noexcept
+{
+    return boost::charconv::detail::from_chars_sortable_impl(first, last, value);
+}
+
 #ifdef BOOST_CHARCONV_HAS_FLOAT128
 boost::charconv::from_chars_result boost::charconv::from_chars(const char* first, const char* last, __float128& value, boost::charconv::chars_format fmt) noexcept
 {
@@ -204,11 +779,13 @@ boost::charconv::from_chars_result boost::charconv::from_chars(const char* first
 
     if (r.ec == std::errc() || r.ec == std::errc::result_out_of_range)
     {
+        BOOST_CHARCONV_PROFILE_PATH(from_chars_compute_float);
         value = return_val;
     }
     else if (r.ec == std::errc::not_supported)
     {
         // Fallback routine
+        BOOST_CHARCONV_PROFILE_PATH(from_chars_strtod);
         errno = 0; // Set to zero, so we get a clean reading from strtold
         std::string temp (first, last); // zero termination
         char* ptr = nullptr;
@@ -0,0 +1,70 @@
+// Copyright 2023 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+// The vector kernel of from_chars_fixed_width. from_chars.cpp includes it once per instruction set, in a namespace that
+// defines fixed_width_lanes, the block functions and BOOST_CHARCONV_FIXED_WIDTH_TARGET, so there is no include guard.
+
+template <typename T>
+BOOST_CHARCONV_FIXED_WIDTH_TARGET static from_chars_result from_chars_fixed_width(const char* first, std::size_t width, std::size_t stride, T* values, std::size_t count) noexcept
+{
+    using binary = fast_float::binary_format<T>;
+
+    if (count == 0)
+    {
+        return {first, std::errc()};
+    }
+
+    const fixed_width_layout layout = analyze_fixed_width_layout(first, width);
+    const bool clinger = fixed_width_clinger<T>(layout);
+
+    constexpr std::size_t lanes = fixed_width_lanes;
+    std::uint64_t significands[lanes];
+    bool negative[lanes];
+    bool matched[lanes];
+
+    // The vector lanes read 16 characters of every record, which the last records may not have
+    const fixed_width_simd_layout simd = make_fixed_width_simd_layout(layout, width);
+    const std::size_t end = (count - 1) * stride + width;
+    std::size_t simd_count = !simd.usable || end < 16 ? 0 : stride == 0 ? count : (end - 16) / stride + 1;
+    simd_count = simd_count < count ? simd_count : count;
+
+    for (std::size_t block = 0; block < count; block += lanes)
+    {
+        const std::size_t n = count - block < lanes ? count - block : lanes;
+        const char* const rec = first + block * stride;
+
+        if (block + lanes <= simd_count)
+        {
+            decode_fixed_width_block(rec, stride, simd, significands, matched);
+
+            bool fast = clinger;
+            for (std::size_t i = 0; i < lanes; ++i)
+            {
+                const char sign = layout.sign_column ? rec[i * stride] : '\0';
+                matched[i] = matched[i] && (!layout.sign_column || sign == '-' || sign == '+' || sign == ' ');
+                negative[i] = sign == '-';
+                fast = fast && matched[i] && significands[i] <= binary::max_mantissa_fast_path();
+            }
+
+            if (fast)
+            {
+                store_fixed_width_block(values + block, clinger_fixed_width_block(significands, negative,
+                                        fast_float::binary_format<double>::exact_power_of_ten(layout.fraction_digits)));
+                continue;
+            }
+        }
+        else
+        {
+            decode_fixed_width_records(rec, stride, layout, n, significands, negative, matched);
+        }
+
+        const auto r = convert_fixed_width_records(rec, width, stride, layout, clinger, n, significands, negative, matched, values + block);
+        if (r.ec != std::errc())
+        {
+            return r;
+        }
+    }
+
+    return {first + (count - 1) * stride + width, std::errc()};
+}
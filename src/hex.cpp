@@ -0,0 +1,419 @@
+// Copyright 2023 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/charconv/hex.hpp>
+#include <boost/charconv/detail/padded_digits.hpp>
+#include <boost/charconv/detail/config.hpp>
+#include <boost/config.hpp>
+#include <system_error>
+#include <cstring>
+#include <cstdint>
+#include <cstddef>
+
+#if !defined(BOOST_CHARCONV_NO_SIMD) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#  define BOOST_CHARCONV_HEX_SSE2
+#  include <emmintrin.h>
+#  if defined(BOOST_CHARCONV_HAS_RUNTIME_DISPATCH) || defined(__SSSE3__) || defined(__AVX2__)
+#    define BOOST_CHARCONV_HEX_SSSE3
+#    include <tmmintrin.h>
+#  endif
+#  if !defined(BOOST_CHARCONV_NO_AVX2) && (defined(BOOST_CHARCONV_HAS_RUNTIME_DISPATCH) || defined(__AVX2__))
+#    define BOOST_CHARCONV_HEX_AVX2
+#    include <immintrin.h>
+#  endif
+#endif
+
+namespace boost { namespace charconv { namespace detail {
+
+static constexpr char hex_digits_lower[] = "0123456789abcdef";
+static constexpr char hex_digits_upper[] = "0123456789ABCDEF";
+
+// Stores eight characters with the one in the lowest byte first regardless of endianness
+BOOST_FORCEINLINE void store_eight_chars(char* p, std::uint64_t chars) noexcept
+{
+    #if BOOST_CHARCONV_ENDIAN_BIG_BYTE
+    chars = load_eight_chars(reinterpret_cast<const char*>(&chars));
+    #endif
+
+    std::memcpy(p, &chars, sizeof(chars));
+}
+
+// The eight characters of four bytes, with the first byte in the lowest byte of bytes. Each byte is spread
+// into two bytes holding its nibbles, and the nibbles above 9 get the distance from '9' + 1 to the letters added.
+BOOST_FORCEINLINE std::uint64_t encode_four_bytes(std::uint32_t bytes, bool uppercase) noexcept
+{
+    std::uint64_t x = bytes;
+    x = (x | (x << 16)) & UINT64_C(0x0000FFFF0000FFFF);
+    x = (x | (x << 8)) & UINT64_C(0x00FF00FF00FF00FF);
+    x = ((x >> 4) & UINT64_C(0x000F000F000F000F)) | ((x & UINT64_C(0x000F000F000F000F)) << 8);
+
+    const std::uint64_t letters = ((x + UINT64_C(0x0606060606060606)) >> 4) & UINT64_C(0x0101010101010101);
+    return x + UINT64_C(0x3030303030303030) + letters * (uppercase ? 7 : 39);
+}
+
+// The four bytes of eight characters, or false if one of them is not a hexadecimal digit. The range checks add
+// 0x80 - lo and 0x7F - hi to every byte, so that the high bit is set when the byte is at least lo and clear when it
+// is at most hi. They carry into the next byte only for bytes with the high bit set, which are rejected anyway.
+BOOST_FORCEINLINE bool decode_eight_chars(std::uint64_t x, std::uint32_t& bytes) noexcept
+{
+    constexpr std::uint64_t high = UINT64_C(0x8080808080808080);
+    const std::uint64_t lower = x | UINT64_C(0x2020202020202020);
+    const std::uint64_t digits = (x + UINT64_C(0x5050505050505050)) & ~(x + UINT64_C(0x4646464646464646));
+    const std::uint64_t letters = (lower + UINT64_C(0x1F1F1F1F1F1F1F1F)) & ~(lower + UINT64_C(0x1919191919191919));
+
+    if ((x & high) != 0 || ((digits | letters) & high) != high)
+    {
+        return false;
+    }
+
+    // Byte i of v is the value of character i, and the even bytes of t the two values of a pair
+    const std::uint64_t v = (x & UINT64_C(0x0F0F0F0F0F0F0F0F)) + ((letters & high) >> 7) * 9;
+    std::uint64_t t = ((v << 4) | (v >> 8)) & UINT64_C(0x00FF00FF00FF00FF);
+    t = (t | (t >> 8)) & UINT64_C(0x0000FFFF0000FFFF);
+    t = (t | (t >> 16)) & UINT64_C(0x00000000FFFFFFFF);
+
+    bytes = static_cast<std::uint32_t>(t);
+    return true;
+}
+
+BOOST_FORCEINLINE std::uint32_t load_four_bytes(const unsigned char* p) noexcept
+{
+    return static_cast<std::uint32_t>(p[0]) | (static_cast<std::uint32_t>(p[1]) << 8) |
+           (static_cast<std::uint32_t>(p[2]) << 16) | (static_cast<std::uint32_t>(p[3]) << 24);
+}
+
+BOOST_FORCEINLINE void store_four_bytes(unsigned char* p, std::uint32_t bytes) noexcept
+{
+    p[0] = static_cast<unsigned char>(bytes);
+    p[1] = static_cast<unsigned char>(bytes >> 8);
+    p[2] = static_cast<unsigned char>(bytes >> 16);
+    p[3] = static_cast<unsigned char>(bytes >> 24);
+}
+
+BOOST_FORCEINLINE int hex_value(char c) noexcept
+{
+    if (c >= '0' && c <= '9')
+    {
+        return c - '0';
+    }
+    c = static_cast<char>(c | 0x20);
+    return c >= 'a' && c <= 'f' ? c - 'a' + 10 : -1;
+}
+
+#ifdef BOOST_CHARCONV_HEX_SSE2
+
+// The characters of the nibbles in n
+BOOST_FORCEINLINE __m128i nibble_chars(__m128i n, bool uppercase) noexcept
+{
+    const __m128i letters = _mm_and_si128(_mm_cmpgt_epi8(n, _mm_set1_epi8(9)), _mm_set1_epi8(uppercase ? 7 : 39));
+    return _mm_add_epi8(_mm_add_epi8(n, _mm_set1_epi8('0')), letters);
+}
+
+BOOST_FORCEINLINE void encode_16_bytes(char* out, const unsigned char* data, bool uppercase) noexcept
+{
+    const __m128i mask = _mm_set1_epi8(0x0F);
+    const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+    const __m128i hi = nibble_chars(_mm_and_si128(_mm_srli_epi16(v, 4), mask), uppercase);
+    const __m128i lo = nibble_chars(_mm_and_si128(v, mask), uppercase);
+
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(out), _mm_unpacklo_epi8(hi, lo));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(out + 16), _mm_unpackhi_epi8(hi, lo));
+}
+
+// The values of the sixteen characters in c, with every byte of valid set for the characters that are
+// hexadecimal digits. x <= n is tested as min(x, n) == x for unsigned bytes.
+BOOST_FORCEINLINE __m128i hex_values(__m128i c, __m128i& valid) noexcept
+{
+    const __m128i d = _mm_sub_epi8(c, _mm_set1_epi8('0'));
+    const __m128i l = _mm_sub_epi8(_mm_or_si128(c, _mm_set1_epi8(0x20)), _mm_set1_epi8('a'));
+    const __m128i is_digit = _mm_cmpeq_epi8(_mm_min_epu8(d, _mm_set1_epi8(9)), d);
+    const __m128i is_letter = _mm_cmpeq_epi8(_mm_min_epu8(l, _mm_set1_epi8(5)), l);
+
+    valid = _mm_and_si128(valid, _mm_or_si128(is_digit, is_letter));
+    return _mm_or_si128(_mm_and_si128(is_digit, d), _mm_and_si128(is_letter, _mm_add_epi8(l, _mm_set1_epi8(10))));
+}
+
+// The bytes of the pairs of values in v, in the low byte of each 16-bit lane
+BOOST_FORCEINLINE __m128i combine_pairs(__m128i v) noexcept
+{
+    return _mm_and_si128(_mm_or_si128(_mm_slli_epi16(v, 4), _mm_srli_epi16(v, 8)), _mm_set1_epi16(0x00FF));
+}
+
+BOOST_FORCEINLINE bool decode_32_chars(unsigned char* out, const char* chars) noexcept
+{
+    __m128i valid = _mm_set1_epi8(-1);
+    const __m128i v0 = hex_values(_mm_loadu_si128(reinterpret_cast<const __m128i*>(chars)), valid);
+    const __m128i v1 = hex_values(_mm_loadu_si128(reinterpret_cast<const __m128i*>(chars + 16)), valid);
+
+    if (_mm_movemask_epi8(valid) != 0xFFFF)
+    {
+        return false;
+    }
+
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(out), _mm_packus_epi16(combine_pairs(v0), combine_pairs(v1)));
+    return true;
+}
+
+#endif // BOOST_CHARCONV_HEX_SSE2
+
+#ifdef BOOST_CHARCONV_HEX_SSSE3
+
+// Same as encode_16_bytes, with the characters of the nibbles looked up by a byte shuffle
+BOOST_CHARCONV_TARGET("ssse3") static void encode_hex_ssse3(char* out, const unsigned char* data, std::size_t size, bool uppercase, std::size_t& i) noexcept
+{
+    const __m128i mask = _mm_set1_epi8(0x0F);
+    const __m128i table = _mm_loadu_si128(reinterpret_cast<const __m128i*>(uppercase ? hex_digits_upper : hex_digits_lower));
+
+    for (; size - i >= 16; i += 16)
+    {
+        const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+        const __m128i hi = _mm_shuffle_epi8(table, _mm_and_si128(_mm_srli_epi16(v, 4), mask));
+        const __m128i lo = _mm_shuffle_epi8(table, _mm_and_si128(v, mask));
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + 2 * i), _mm_unpacklo_epi8(hi, lo));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + 2 * i + 16), _mm_unpackhi_epi8(hi, lo));
+    }
+}
+
+#endif // BOOST_CHARCONV_HEX_SSSE3
+
+#ifdef BOOST_CHARCONV_HEX_AVX2
+
+// Same as the SSE2 functions on both 128-bit lanes, which are then put back in order
+BOOST_CHARCONV_TARGET("avx2") BOOST_FORCEINLINE void encode_32_bytes(char* out, const unsigned char* data, bool uppercase) noexcept
+{
+    const __m256i mask = _mm256_set1_epi8(0x0F);
+    const __m256i table = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(uppercase ? hex_digits_upper : hex_digits_lower)));
+    const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data));
+    const __m256i hi = _mm256_shuffle_epi8(table, _mm256_and_si256(_mm256_srli_epi16(v, 4), mask));
+    const __m256i lo = _mm256_shuffle_epi8(table, _mm256_and_si256(v, mask));
+
+    // Bytes 0-7 and 16-23, and bytes 8-15 and 24-31
+    const __m256i a = _mm256_unpacklo_epi8(hi, lo);
+    const __m256i b = _mm256_unpackhi_epi8(hi, lo);
+
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(out), _mm256_permute2x128_si256(a, b, 0x20));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 32), _mm256_permute2x128_si256(a, b, 0x31));
+}
+
+BOOST_CHARCONV_TARGET("avx2") BOOST_FORCEINLINE __m256i hex_values(__m256i c, __m256i& valid) noexcept
+{
+    const __m256i d = _mm256_sub_epi8(c, _mm256_set1_epi8('0'));
+    const __m256i l = _mm256_sub_epi8(_mm256_or_si256(c, _mm256_set1_epi8(0x20)), _mm256_set1_epi8('a'));
+    const __m256i is_digit = _mm256_cmpeq_epi8(_mm256_min_epu8(d, _mm256_set1_epi8(9)), d);
+    const __m256i is_letter = _mm256_cmpeq_epi8(_mm256_min_epu8(l, _mm256_set1_epi8(5)), l);
+
+    valid = _mm256_and_si256(valid, _mm256_or_si256(is_digit, is_letter));
+    return _mm256_or_si256(_mm256_and_si256(is_digit, d), _mm256_and_si256(is_letter, _mm256_add_epi8(l, _mm256_set1_epi8(10))));
+}
+
+BOOST_CHARCONV_TARGET("avx2") BOOST_FORCEINLINE __m256i combine_pairs(__m256i v) noexcept
+{
+    return _mm256_and_si256(_mm256_or_si256(_mm256_slli_epi16(v, 4), _mm256_srli_epi16(v, 8)), _mm256_set1_epi16(0x00FF));
+}
+
+BOOST_CHARCONV_TARGET("avx2") BOOST_FORCEINLINE bool decode_64_chars(unsigned char* out, const char* chars) noexcept
+{
+    __m256i valid = _mm256_set1_epi8(-1);
+    const __m256i v0 = hex_values(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(chars)), valid);
+    const __m256i v1 = hex_values(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(chars + 32)), valid);
+
+    if (_mm256_movemask_epi8(valid) != -1)
+    {
+        return false;
+    }
+
+    // The pack interleaves the lanes as bytes 0-7, 16-23, 8-15, 24-31
+    const __m256i packed = _mm256_packus_epi16(combine_pairs(v0), combine_pairs(v1));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(out), _mm256_permute4x64_epi64(packed, 0xD8));
+    return true;
+}
+
+BOOST_CHARCONV_TARGET("avx2") static void encode_hex_avx2(char* out, const unsigned char* data, std::size_t size, bool uppercase, std::size_t& i) noexcept
+{
+    for (; size - i >= 32; i += 32)
+    {
+        encode_32_bytes(out + 2 * i, data + i, uppercase);
+    }
+}
+
+BOOST_CHARCONV_TARGET("avx2") static bool decode_hex_avx2(unsigned char* out, const char* chars, std::size_t size, std::size_t& i) noexcept
+{
+    for (; size - i >= 32; i += 32)
+    {
+        if (!decode_64_chars(out + i, chars + 2 * i))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+#endif // BOOST_CHARCONV_HEX_AVX2
+
+static void encode_hex(char* out, const unsigned char* data, std::size_t size, bool uppercase) noexcept
+{
+    std::size_t i = 0;
+
+    #ifdef BOOST_CHARCONV_HEX_AVX2
+    if (size >= 32 && BOOST_CHARCONV_CPU_SUPPORTS("avx2"))
+    {
+        encode_hex_avx2(out, data, size, uppercase, i);
+    }
+    #endif
+
+    #ifdef BOOST_CHARCONV_HEX_SSSE3
+    if (size - i >= 16 && BOOST_CHARCONV_CPU_SUPPORTS("ssse3"))
+    {
+        encode_hex_ssse3(out, data, size, uppercase, i);
+    }
+    #endif
+
+    #ifdef BOOST_CHARCONV_HEX_SSE2
+    for (; size - i >= 16; i += 16)
+    {
+        encode_16_bytes(out + 2 * i, data + i, uppercase);
+    }
+    #endif
+
+    for (; size - i >= 4; i += 4)
+    {
+        store_eight_chars(out + 2 * i, encode_four_bytes(load_four_bytes(data + i), uppercase));
+    }
+
+    const char* digits = uppercase ? hex_digits_upper : hex_digits_lower;
+    for (; i < size; ++i)
+    {
+        out[2 * i] = digits[data[i] >> 4];
+        out[2 * i + 1] = digits[data[i] & 15];
+    }
+}
+
+static bool decode_hex(unsigned char* out, const char* chars, std::size_t size) noexcept
+{
+    std::size_t i = 0;
+
+    #ifdef BOOST_CHARCONV_HEX_AVX2
+    if (size >= 32 && BOOST_CHARCONV_CPU_SUPPORTS("avx2") && !decode_hex_avx2(out, chars, size, i))
+    {
+        return false;
+    }
+    #endif
+
+    #ifdef BOOST_CHARCONV_HEX_SSE2
+    for (; size - i >= 16; i += 16)
+    {
+        if (!decode_32_chars(out + i, chars + 2 * i))
+        {
+            return false;
+        }
+    }
+    #endif
+
+    for (; size - i >= 4; i += 4)
+    {
+        std::uint32_t bytes;
+        if (!decode_eight_chars(load_eight_chars(chars + 2 * i), bytes))
+        {
+            return false;
+        }
+        store_four_bytes(out + i, bytes);
+    }
+
+    for (; i < size; ++i)
+    {
+        const int hi = hex_value(chars[2 * i]);
+        const int lo = hex_value(chars[2 * i + 1]);
+        if ((hi | lo) < 0)
+        {
+            return false;
+        }
+        out[i] = static_cast<unsigned char>(hi * 16 + lo);
+    }
+
+    return true;
+}
+
+// Offsets of the groups of the UUID layout in the text and in the 32 digits
+static constexpr std::size_t uuid_group_offsets[] = {0, 9, 14, 19, 24};
+static constexpr std::size_t uuid_group_digits[] = {0, 8, 12, 16, 20};
+static constexpr std::size_t uuid_group_sizes[] = {8, 4, 4, 4, 12};
+
+static to_chars_result to_chars_uuid_impl(char* first, char* last, const unsigned char* uuid, bool uppercase) noexcept
+{
+    if (static_cast<std::size_t>(last - first) < uuid_chars)
+    {
+        return {last, std::errc::result_out_of_range};
+    }
+
+    char digits[32];
+    encode_hex(digits, uuid, 16, uppercase);
+
+    for (std::size_t i = 0; i < 5; ++i)
+    {
+        std::memcpy(first + uuid_group_offsets[i], digits + uuid_group_digits[i], uuid_group_sizes[i]);
+    }
+    first[8] = '-';
+    first[13] = '-';
+    first[18] = '-';
+    first[23] = '-';
+
+    return {first + uuid_chars, std::errc()};
+}
+
+static from_chars_result from_chars_uuid_impl(const char* first, const char* last, unsigned char* uuid) noexcept
+{
+    if (static_cast<std::size_t>(last - first) < uuid_chars || first[8] != '-' || first[13] != '-' || first[18] != '-' || first[23] != '-')
+    {
+        return {first, std::errc::invalid_argument};
+    }
+
+    char digits[32];
+    for (std::size_t i = 0; i < 5; ++i)
+    {
+        std::memcpy(digits + uuid_group_digits[i], first + uuid_group_offsets[i], uuid_group_sizes[i]);
+    }
+
+    unsigned char bytes[16];
+    if (!decode_hex(bytes, digits, 16))
+    {
+        return {first, std::errc::invalid_argument};
+    }
+
+    std::memcpy(uuid, bytes, 16);
+    return {first + uuid_chars, std::errc()};
+}
+
+}}} // Namespaces
+
+boost::charconv::to_chars_result boost::charconv::to_chars_hex_bytes(char* first, char* last, const unsigned char* data, std::size_t size, bool uppercase) noexcept
+{
+    if (size > static_cast<std::size_t>(last - first) / 2)
+    {
+        return {last, std::errc::result_out_of_range};
+    }
+
+    boost::charconv::detail::encode_hex(first, data, size, uppercase);
+    return {first + 2 * size, std::errc()};
+}
+
+boost::charconv::from_chars_result boost::charconv::from_chars_hex_bytes(const char* first, const char* last, unsigned char* data, std::size_t size) noexcept
+{
+    if (size > static_cast<std::size_t>(last - first) / 2 || !boost::charconv::detail::decode_hex(data, first, size))
+    {
+        return {first, std::errc::invalid_argument};
+    }
+
+    return {first + 2 * size, std::errc()};
+}
+
+boost::charconv::to_chars_result boost::charconv::to_chars_uuid(char* first, char* last, const unsigned char* uuid, bool uppercase) noexcept
+{
+    return boost::charconv::detail::to_chars_uuid_impl(first, last, uuid, uppercase);
+}
+
+boost::charconv::from_chars_result boost::charconv::from_chars_uuid(const char* first, const char* last, unsigned char* uuid) noexcept
+{
+    return boost::charconv::detail::from_chars_uuid_impl(first, last, uuid);
+}
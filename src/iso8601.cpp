@@ -0,0 +1,330 @@
+// Copyright 2023 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/charconv/iso8601.hpp>
+#include <boost/charconv/detail/to_chars_integer_impl.hpp>
+#include <boost/charconv/detail/padded_digits.hpp>
+#include <boost/charconv/detail/parser.hpp>
+#include <boost/config.hpp>
+#include <system_error>
+#include <limits>
+#include <cstring>
+#include <cstdint>
+#include <cstddef>
+
+namespace boost { namespace charconv { namespace detail {
+
+static constexpr std::int64_t time_unit_scale[] = {1, 1000, 1000000, 1000000000};
+static constexpr std::size_t time_unit_digits[] = {0, 3, 6, 9};
+static constexpr std::uint32_t fraction_pow10[] = {1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000};
+
+// The smallest and largest count of each unit split into seconds and a fraction as by floor division,
+// so that the fraction is never negative
+struct time_unit_limits
+{
+    std::int64_t max_seconds;
+    std::int64_t max_fraction;
+    std::int64_t min_seconds;
+    std::int64_t min_fraction;
+};
+
+static constexpr time_unit_limits make_time_unit_limits(std::int64_t scale) noexcept
+{
+    return {(std::numeric_limits<std::int64_t>::max)() / scale, (std::numeric_limits<std::int64_t>::max)() % scale,
+            (std::numeric_limits<std::int64_t>::min)() / scale - ((std::numeric_limits<std::int64_t>::min)() % scale != 0 ? 1 : 0),
+            (std::numeric_limits<std::int64_t>::min)() % scale != 0 ? (std::numeric_limits<std::int64_t>::min)() % scale + scale : 0};
+}
+
+static constexpr time_unit_limits time_unit_limits_table[] = {make_time_unit_limits(1), make_time_unit_limits(1000),
+                                                              make_time_unit_limits(1000000), make_time_unit_limits(1000000000)};
+
+// Days from 1970-01-01 to 0000-01-01 and to 9999-12-31
+static constexpr std::int64_t min_iso8601_days = -719528;
+static constexpr std::int64_t max_iso8601_days = 2932896;
+
+// Both conversions follow http://howardhinnant.github.io/date_algorithms.html, with years that start on March 1st
+// so that the leap day is the last day of a year. The days are shifted by one 400 year era so that all of the
+// arithmetic is unsigned for the years 0000 to 9999, and the month conversions are selects rather than branches.
+struct civil_date
+{
+    std::uint32_t year;
+    std::uint32_t month;
+    std::uint32_t day;
+};
+
+static civil_date civil_from_days(std::int64_t days) noexcept
+{
+    const auto z = static_cast<std::uint32_t>(days + 719468 + 146097);
+    const std::uint32_t era = z / 146097;
+    const std::uint32_t doe = z - era * 146097;
+    const std::uint32_t yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+    const std::uint32_t doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+    const std::uint32_t mp = (5 * doy + 2) / 153;
+    const std::uint32_t day = doy - (153 * mp + 2) / 5 + 1;
+    const std::uint32_t month = mp < 10 ? mp + 3 : mp - 9;
+    return {yoe + era * 400 + (month <= 2 ? 1U : 0U) - 400, month, day};
+}
+
+static std::int64_t days_from_civil(std::uint32_t year, std::uint32_t month, std::uint32_t day) noexcept
+{
+    const std::uint32_t y = year + 400 - (month <= 2 ? 1U : 0U);
+    const std::uint32_t era = y / 400;
+    const std::uint32_t yoe = y - era * 400;
+    const std::uint32_t mp = month > 2 ? month - 3 : month + 9;
+    const std::uint32_t doy = (153 * mp + 2) / 5 + day - 1;
+    const std::uint32_t doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+    return static_cast<std::int64_t>(era) * 146097 + static_cast<std::int64_t>(doe) - 719468 - 146097;
+}
+
+static std::uint32_t days_in_month(std::uint32_t year, std::uint32_t month) noexcept
+{
+    static constexpr std::uint8_t days[] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+    const bool leap = year % 4 == 0 && (year % 100 != 0 || year % 400 == 0);
+    return days[month - 1] + (month == 2 && leap ? 1U : 0U);
+}
+
+BOOST_FORCEINLINE void write_two_digits(char* first, std::uint32_t value) noexcept
+{
+    std::memcpy(first, radix_table + static_cast<std::size_t>(value) * 2, 2);
+}
+
+static to_chars_result to_chars_iso8601_impl(char* first, char* last, std::int64_t value, time_unit unit) noexcept
+{
+    const std::int64_t scale = time_unit_scale[static_cast<unsigned>(unit)];
+    const std::size_t digits = time_unit_digits[static_cast<unsigned>(unit)];
+
+    // Floor divisions, so that the time of day and the fraction of instants before 1970 are positive
+    std::int64_t seconds = value / scale;
+    std::int64_t fraction = value % scale;
+    if (fraction < 0)
+    {
+        fraction += scale;
+        --seconds;
+    }
+
+    std::int64_t days = seconds / 86400;
+    std::int64_t time = seconds % 86400;
+    if (time < 0)
+    {
+        time += 86400;
+        --days;
+    }
+
+    if (days < min_iso8601_days || days > max_iso8601_days)
+    {
+        return {last, std::errc::value_too_large};
+    }
+
+    const std::size_t size = 20 + (digits == 0 ? 0 : digits + 1);
+    if (static_cast<std::size_t>(last - first) < size)
+    {
+        return {last, std::errc::result_out_of_range};
+    }
+
+    const civil_date date = civil_from_days(days);
+    const auto t = static_cast<std::uint32_t>(time);
+
+    write_two_digits(first, date.year / 100);
+    write_two_digits(first + 2, date.year % 100);
+    first[4] = '-';
+    write_two_digits(first + 5, date.month);
+    first[7] = '-';
+    write_two_digits(first + 8, date.day);
+    first[10] = 'T';
+    write_two_digits(first + 11, t / 3600);
+    first[13] = ':';
+    write_two_digits(first + 14, t / 60 % 60);
+    first[16] = ':';
+    write_two_digits(first + 17, t % 60);
+
+    char* p = first + 19;
+    if (digits != 0)
+    {
+        *p++ = '.';
+
+        // The fraction from the right, two digits at a time
+        auto f = static_cast<std::uint32_t>(fraction);
+        std::size_t i = digits;
+        for (; i >= 2; i -= 2)
+        {
+            write_two_digits(p + i - 2, f % 100);
+            f /= 100;
+        }
+        if (i == 1)
+        {
+            *p = static_cast<char>('0' + f);
+        }
+        p += digits;
+    }
+    *p++ = 'Z';
+
+    return {p, std::errc()};
+}
+
+// Whether chars matches layout, where '0' in layout stands for any digit and every other byte for itself.
+// After the xor, digit bytes hold 0 to 9 and the other bytes hold 0 exactly when they match, so adding 0x76 to
+// the digit bytes and 0x7F to the others sets the high bit of the bytes that do not match, without any carries.
+// On a match values holds the value of each digit and zero in the other bytes.
+BOOST_FORCEINLINE bool match_layout(std::uint64_t chars, const char* layout, std::uint64_t& values) noexcept
+{
+    std::uint64_t digit_mask = 0;
+    for (int i = 0; i < 8; ++i)
+    {
+        digit_mask |= layout[i] == '0' ? UINT64_C(0xFF) << (8 * i) : 0;
+    }
+
+    values = chars ^ load_eight_chars(layout);
+    const std::uint64_t limit = (UINT64_C(0x7676767676767676) & digit_mask) | (UINT64_C(0x7F7F7F7F7F7F7F7F) & ~digit_mask);
+    return (((values + limit) | values) & UINT64_C(0x8080808080808080)) == 0;
+}
+
+// Byte i of the result is the number made of the digits in bytes i and i + 1 of the values of match_layout
+BOOST_FORCEINLINE std::uint64_t digit_pairs(std::uint64_t values) noexcept
+{
+    return values * 10 + (values >> 8);
+}
+
+BOOST_FORCEINLINE std::uint32_t byte_at(std::uint64_t value, int i) noexcept
+{
+    return static_cast<std::uint32_t>(value >> (8 * i)) & 0xFF;
+}
+
+// Parses the digits of a fraction, keeping the first max_digits of them. At least one digit is required.
+static const char* parse_fraction(const char* p, const char* last, std::uint32_t& fraction, std::size_t& digits) noexcept
+{
+    constexpr std::size_t max_digits = 9;
+    const char* const start = p;
+
+    while (last - p >= 8)
+    {
+        const std::uint64_t chars = load_eight_chars(p);
+        const int n = leading_digit_count(chars);
+        const std::size_t take = max_digits - digits < static_cast<std::size_t>(n) ? max_digits - digits : static_cast<std::size_t>(n);
+        if (take != 0)
+        {
+            fraction = fraction * fraction_pow10[take] + (take == 8 ? parse_eight_digits(chars) : parse_leading_digits(chars, static_cast<int>(take)));
+        }
+        digits += take;
+        p += n;
+
+        if (n < 8)
+        {
+            return p == start ? nullptr : p;
+        }
+    }
+
+    for (; p != last && is_integer_char(*p); ++p)
+    {
+        if (digits < max_digits)
+        {
+            fraction = fraction * 10 + static_cast<std::uint32_t>(*p - '0');
+            ++digits;
+        }
+    }
+
+    return p == start ? nullptr : p;
+}
+
+static from_chars_result from_chars_iso8601_impl(const char* first, const char* last, std::int64_t& value, time_unit unit) noexcept
+{
+    if (last - first < 20)
+    {
+        return {first, std::errc::invalid_argument};
+    }
+
+    // YYYY-MM-, DDThh:mm and hh:mm:ss, the last two overlapping. The separator between the date and the time
+    // is checked on its own and replaced by T for the layout.
+    const char separator = first[10];
+    const std::uint64_t date = load_eight_chars(first);
+    const std::uint64_t day = (load_eight_chars(first + 8) & ~(UINT64_C(0xFF) << 16)) | (static_cast<std::uint64_t>('T') << 16);
+    const std::uint64_t time = load_eight_chars(first + 11);
+
+    std::uint64_t date_values;
+    std::uint64_t day_values;
+    std::uint64_t time_values;
+    if ((separator != 'T' && separator != 't' && separator != ' ') || !match_layout(date, "0000-00-", date_values) ||
+        !match_layout(day, "00T00:00", day_values) || !match_layout(time, "00:00:00", time_values))
+    {
+        return {first, std::errc::invalid_argument};
+    }
+
+    const std::uint64_t date_pairs = digit_pairs(date_values);
+    const std::uint64_t time_pairs = digit_pairs(time_values);
+    const std::uint32_t year = byte_at(date_pairs, 0) * 100 + byte_at(date_pairs, 2);
+    const std::uint32_t month = byte_at(date_pairs, 5);
+    const std::uint32_t mday = byte_at(digit_pairs(day_values), 0);
+    const std::uint32_t hour = byte_at(time_pairs, 0);
+    const std::uint32_t minute = byte_at(time_pairs, 3);
+    const std::uint32_t second = byte_at(time_pairs, 6);
+
+    if (month < 1 || month > 12 || mday < 1 || mday > days_in_month(year, month) || hour > 23 || minute > 59 || second > 59)
+    {
+        return {first, std::errc::invalid_argument};
+    }
+
+    const char* p = first + 19;
+    std::uint32_t fraction = 0;
+    std::size_t fraction_digits = 0;
+    if (*p == '.')
+    {
+        p = parse_fraction(p + 1, last, fraction, fraction_digits);
+        if (p == nullptr)
+        {
+            return {first, std::errc::invalid_argument};
+        }
+    }
+
+    std::int64_t offset = 0;
+    if (p != last && (*p == 'Z' || *p == 'z'))
+    {
+        ++p;
+    }
+    else if (last - p >= 6 && (*p == '+' || *p == '-') && is_integer_char(p[1]) && is_integer_char(p[2]) && p[3] == ':' &&
+             is_integer_char(p[4]) && is_integer_char(p[5]))
+    {
+        const int offset_hours = (p[1] - '0') * 10 + (p[2] - '0');
+        const int offset_minutes = (p[4] - '0') * 10 + (p[5] - '0');
+        if (offset_hours > 23 || offset_minutes > 59)
+        {
+            return {first, std::errc::invalid_argument};
+        }
+        offset = (offset_hours * 3600 + offset_minutes * 60) * (*p == '-' ? -1 : 1);
+        p += 6;
+    }
+    else
+    {
+        return {first, std::errc::invalid_argument};
+    }
+
+    // The local time is the UTC time plus the offset
+    const std::int64_t seconds = days_from_civil(year, month, mday) * 86400 + hour * 3600 + minute * 60 + second - offset;
+
+    const std::size_t digits = time_unit_digits[static_cast<unsigned>(unit)];
+    const std::int64_t scale = time_unit_scale[static_cast<unsigned>(unit)];
+    const std::int64_t scaled_fraction = fraction_digits >= digits ? fraction / fraction_pow10[fraction_digits - digits] :
+                                                                     static_cast<std::int64_t>(fraction) * fraction_pow10[digits - fraction_digits];
+
+    const time_unit_limits& limits = time_unit_limits_table[static_cast<unsigned>(unit)];
+    if (seconds > limits.max_seconds || (seconds == limits.max_seconds && scaled_fraction > limits.max_fraction) ||
+        seconds < limits.min_seconds || (seconds == limits.min_seconds && scaled_fraction < limits.min_fraction))
+    {
+        return {p, std::errc::result_out_of_range};
+    }
+
+    // Before 1970 the fraction is taken from the next second, so that the product does not overflow at the lower limit
+    value = seconds < 0 && scaled_fraction != 0 ? (seconds + 1) * scale - (scale - scaled_fraction) : seconds * scale + scaled_fraction;
+    return {p, std::errc()};
+}
+
+}}} // Namespaces
+
+boost::charconv::to_chars_result boost::charconv::to_chars_iso8601(char* first, char* last, std::int64_t value, boost::charconv::time_unit unit) noexcept
+{
+    return boost::charconv::detail::to_chars_iso8601_impl(first, last, value, unit);
+}
+
+boost::charconv::from_chars_result boost::charconv::from_chars_iso8601(const char* first, const char* last, std::int64_t& value, boost::charconv::time_unit unit) noexcept
+{
+    return boost::charconv::detail::from_chars_iso8601_impl(first, last, value, unit);
+}
@@ -0,0 +1,237 @@
+// Copyright 2023 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/charconv/parallel_to_chars.hpp>
+#include <boost/charconv/to_chars.hpp>
+#include <boost/charconv/detail/integer_search_trees.hpp>
+#include <boost/config.hpp>
+#include <system_error>
+#include <type_traits>
+#include <limits>
+#include <cstring>
+#include <cstdint>
+#include <cstddef>
+#include <cmath>
+
+#ifndef BOOST_NO_CXX11_HDR_THREAD
+#  include <thread>
+#endif
+
+namespace boost { namespace charconv { namespace detail {
+
+// Below this many values per thread starting the threads costs more than it saves
+static constexpr std::size_t parallel_min_slice = 8192;
+
+// The number of characters to_chars_float_impl writes for the shortest representation of value,
+// following each of its layouts without producing the digits
+template <typename Real>
+static std::size_t shortest_chars_length(Real value, chars_format fmt) noexcept
+{
+    using Unsigned_Integer = typename std::conditional<std::is_same<Real, double>::value, std::uint64_t, std::uint32_t>::type;
+
+    if (!std::isfinite(value) || fmt == chars_format::hex)
+    {
+        char buffer[64];
+        return static_cast<std::size_t>(to_chars(buffer, buffer + sizeof(buffer), value, fmt).ptr - buffer);
+    }
+
+    const std::size_t sign = std::signbit(value) ? 1 : 0;
+    if (value == 0)
+    {
+        return sign + (fmt == chars_format::scientific ? 5 : 1);
+    }
+
+    const auto abs_value = std::abs(value);
+    if (fmt != chars_format::scientific)
+    {
+        constexpr auto max_fractional_value = std::is_same<Real, double>::value ? static_cast<Real>(1e16) : static_cast<Real>(1e7);
+        constexpr auto max_value = static_cast<Real>(std::numeric_limits<Unsigned_Integer>::max());
+
+        if (abs_value >= 1 && abs_value < max_fractional_value)
+        {
+            // The digits and either a decimal point or the zeros of the integer
+            const auto dec = to_decimal(value);
+            const auto digits = static_cast<std::size_t>(num_digits(dec.significand));
+            return sign + digits + (dec.exponent < 0 ? 1 : static_cast<std::size_t>(dec.exponent));
+        }
+        else if (abs_value >= max_fractional_value && abs_value < max_value)
+        {
+            return sign + static_cast<std::size_t>(num_digits(static_cast<std::uint64_t>(abs_value)));
+        }
+    }
+
+    // Dragonbox layout: d[.ddd] followed by the exponent, which general omits when it is zero
+    const auto dec = to_decimal(value);
+    const auto digits = static_cast<std::size_t>(num_digits(dec.significand));
+    const int exponent = dec.exponent + static_cast<int>(digits) - 1;
+
+    std::size_t length = sign + digits + (digits > 1 ? 1 : 0);
+    if (exponent != 0)
+    {
+        length += (exponent >= 100 || exponent <= -100) ? 5 : 4;
+    }
+    else if (fmt == chars_format::scientific)
+    {
+        length += 4;
+    }
+    return length;
+}
+
+template <typename Real>
+static std::size_t slice_length(const Real* values, std::size_t count, chars_format fmt) noexcept
+{
+    std::size_t length = 0;
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        length += shortest_chars_length(values[i], fmt);
+    }
+    return length + count;
+}
+
+// Every write of to_chars, including the null terminator of the Dragonbox layout, stays
+// in front of the separator of its value, so the slices of the threads never overlap
+template <typename Real>
+static void format_slice(char* first, const Real* values, std::size_t count, char separator, chars_format fmt, std::size_t length) noexcept
+{
+    char* const last = first + length;
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        if (fmt == chars_format::hex)
+        {
+            // The hex layout wants room for the maximum precision even when the output is shorter
+            char buffer[64];
+            const auto r = to_chars(buffer, buffer + sizeof(buffer), values[i], fmt);
+            const auto size = static_cast<std::size_t>(r.ptr - buffer);
+            std::memcpy(first, buffer, size);
+            first += size;
+        }
+        else
+        {
+            first = to_chars(first, last, values[i], fmt).ptr;
+        }
+        *first++ = separator;
+    }
+}
+
+// Runs fn(t) for every t in [0, threads), on new threads and the calling thread. If a thread cannot be started
+// its work is done on the calling thread instead.
+template <typename Function>
+static void run_on_threads(unsigned threads, Function fn) noexcept
+{
+    #ifndef BOOST_NO_CXX11_HDR_THREAD
+
+    std::thread workers[64];
+
+    for (unsigned t = 1; t < threads; ++t)
+    {
+        #ifndef BOOST_NO_EXCEPTIONS
+        try
+        {
+            workers[t] = std::thread(fn, t);
+        }
+        catch (...)
+        {
+            fn(t);
+        }
+        #else
+        workers[t] = std::thread(fn, t);
+        #endif
+    }
+
+    fn(0U);
+
+    for (unsigned t = 1; t < threads; ++t)
+    {
+        if (workers[t].joinable())
+        {
+            workers[t].join();
+        }
+    }
+
+    #else
+
+    for (unsigned t = 0; t < threads; ++t)
+    {
+        fn(t);
+    }
+
+    #endif
+}
+
+static unsigned thread_count(unsigned threads, std::size_t count) noexcept
+{
+    #ifndef BOOST_NO_CXX11_HDR_THREAD
+    if (threads == 0)
+    {
+        threads = std::thread::hardware_concurrency();
+    }
+    #endif
+
+    const std::size_t useful = count / parallel_min_slice;
+    if (threads > useful)
+    {
+        threads = static_cast<unsigned>(useful);
+    }
+    if (threads > 64)
+    {
+        threads = 64;
+    }
+    return threads == 0 ? 1 : threads;
+}
+
+template <typename Real>
+static to_chars_result parallel_to_chars_impl(char* first, char* last, const Real* values, std::size_t count, char separator, chars_format fmt, unsigned threads) noexcept
+{
+    threads = thread_count(threads, count);
+
+    // Thread t owns values [count * t / threads, count * (t + 1) / threads)
+    std::size_t offsets[65] {};
+    run_on_threads(threads, [&](unsigned t) {
+        const std::size_t begin = count * t / threads;
+        const std::size_t end = count * (t + 1) / threads;
+        offsets[t + 1] = slice_length(values + begin, end - begin, fmt);
+    });
+
+    for (unsigned t = 0; t < threads; ++t)
+    {
+        offsets[t + 1] += offsets[t];
+    }
+
+    if (offsets[threads] > static_cast<std::size_t>(last - first))
+    {
+        return {last, std::errc::result_out_of_range};
+    }
+
+    run_on_threads(threads, [&](unsigned t) {
+        const std::size_t begin = count * t / threads;
+        const std::size_t end = count * (t + 1) / threads;
+        format_slice(first + offsets[t], values + begin, end - begin, separator, fmt, offsets[t + 1] - offsets[t]);
+    });
+
+    return {first + offsets[threads], std::errc()};
+}
+
+}}} // Namespaces
+
+boost::charconv::to_chars_result boost::charconv::parallel_to_chars(char* first, char* last, const float* values, std::size_t count, char separator,
+                                                                    boost::charconv::chars_format fmt, unsigned threads) noexcept
+{
+    return boost::charconv::detail::parallel_to_chars_impl(first, last, values, count, separator, fmt, threads);
+}
+
+boost::charconv::to_chars_result boost::charconv::parallel_to_chars(char* first, char* last, const double* values, std::size_t count, char separator,
+                                                                    boost::charconv::chars_format fmt, unsigned threads) noexcept
+{
+    return boost::charconv::detail::parallel_to_chars_impl(first, last, values, count, separator, fmt, threads);
+}
+
+std::size_t boost::charconv::parallel_to_chars_size(const float* values, std::size_t count, boost::charconv::chars_format fmt) noexcept
+{
+    return boost::charconv::detail::slice_length(values, count, fmt);
+}
+
+std::size_t boost::charconv::parallel_to_chars_size(const double* values, std::size_t count, boost::charconv::chars_format fmt) noexcept
+{
+    return boost::charconv::detail::slice_length(values, count, fmt);
+}
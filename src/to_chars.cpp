@@ -5,12 +5,17 @@
 // https://www.boost.org/LICENSE_1_0.txt
 
 #include <boost/charconv/to_chars.hpp>
+#include <boost/charconv/sortable.hpp>
+#include <boost/charconv/grouping.hpp>
+#include <boost/charconv/format.hpp>
 #include <boost/charconv/chars_format.hpp>
 #include <limits>
 #include <cstring>
 #include <cstdio>
 #include <cstdint>
 #include <cmath>
+#include <cstddef>
+#include <algorithm>
 
 namespace boost { namespace charconv { namespace detail { namespace to_chars_detail {
 
@@ -530,6 +535,875 @@ namespace boost { namespace charconv { namespace detail { namespace to_chars_det
 
 }}}} // Namespaces
 
+namespace boost { namespace charconv { namespace detail {
+
+template <typename Real>
+to_chars_result to_chars_styled_nonfinite(char* first, char* last, Real value, const shortest_style& style) noexcept
+{
+    const char* text;
+    const bool is_nan = std::isnan(value);
+    const bool is_negative = std::signbit(value);
+
+    switch (style.nonfinite)
+    {
+        case nonfinite_style::javascript:
+            text = is_nan ? "NaN" : is_negative ? "-Infinity" : "Infinity";
+            break;
+        case nonfinite_style::python:
+            text = is_nan ? "nan" : is_negative ? "-inf" : "inf";
+            break;
+        case nonfinite_style::null:
+            text = "null";
+            break;
+        case nonfinite_style::error:
+            return {last, std::errc::invalid_argument};
+        default:
+            // The default formatter already knows how to spell the different kinds of NaN
+            return boost::charconv::to_chars(first, last, value);
+    }
+
+    const auto length = std::strlen(text);
+    if (static_cast<std::ptrdiff_t>(length) > last - first)
+    {
+        return {last, std::errc::result_out_of_range};
+    }
+
+    std::memcpy(first, text, length);
+    return {first + length, std::errc()};
+}
+
+// Writes significand * 10^exponent in the notation requested by style. The significand has no trailing zeros,
+// so it is also the exact list of significant digits.
+inline to_chars_result write_styled_decimal(char* first, char* last, bool is_negative, std::uint64_t significand, int exponent,
+                                            const shortest_style& style) noexcept
+{
+    const std::ptrdiff_t buffer_size = last - first;
+
+    char digits[20];
+    const auto r = to_chars_integer_impl(digits, digits + sizeof(digits), significand);
+    const auto digit_count = static_cast<int>(r.ptr - digits);
+    const int sci_exponent = exponent + digit_count - 1;
+
+    const bool use_fixed = sci_exponent >= style.min_fixed_exponent && sci_exponent < style.max_fixed_exponent;
+
+    std::ptrdiff_t total_length = static_cast<std::ptrdiff_t>(is_negative);
+    int exponent_digits = 0;
+    const auto abs_sci_exponent = static_cast<std::uint32_t>(sci_exponent < 0 ? -sci_exponent : sci_exponent);
+
+    if (use_fixed)
+    {
+        if (exponent >= 0)
+        {
+            total_length += digit_count + exponent + (style.force_decimal_point ? 2 : 0);
+        }
+        else if (sci_exponent >= 0)
+        {
+            total_length += digit_count + 1;
+        }
+        else
+        {
+            total_length += 1 - sci_exponent + digit_count;
+        }
+    }
+    else
+    {
+        exponent_digits = (std::max)(num_digits(abs_sci_exponent), style.exponent_min_digits);
+        total_length += digit_count + (digit_count > 1 ? 1 : 0) + 1 +
+                        (sci_exponent < 0 || style.exponent_plus_sign ? 1 : 0) + exponent_digits;
+    }
+
+    if (total_length > buffer_size)
+    {
+        return {last, std::errc::result_out_of_range};
+    }
+
+    if (is_negative)
+    {
+        *first++ = '-';
+    }
+
+    const auto unsigned_digits = static_cast<std::size_t>(digit_count);
+
+    if (use_fixed)
+    {
+        if (exponent >= 0)
+        {
+            // Integral value: digits followed by the zeros of the exponent
+            std::memcpy(first, digits, unsigned_digits);
+            first += digit_count;
+            std::memset(first, '0', static_cast<std::size_t>(exponent));
+            first += exponent;
+
+            if (style.force_decimal_point)
+            {
+                std::memcpy(first, ".0", 2); // NOLINT : No null terminator is purposeful
+                first += 2;
+            }
+        }
+        else if (sci_exponent >= 0)
+        {
+            // The decimal point falls inside the digits
+            const auto integer_digits = static_cast<std::size_t>(sci_exponent + 1);
+            std::memcpy(first, digits, integer_digits);
+            first += integer_digits;
+            *first++ = '.';
+            std::memcpy(first, digits + integer_digits, unsigned_digits - integer_digits);
+            first += unsigned_digits - integer_digits;
+        }
+        else
+        {
+            // 0.000ddd
+            const auto leading_zeros = static_cast<std::size_t>(-sci_exponent - 1);
+            std::memcpy(first, "0.", 2); // NOLINT : No null terminator is purposeful
+            first += 2;
+            std::memset(first, '0', leading_zeros);
+            first += leading_zeros;
+            std::memcpy(first, digits, unsigned_digits);
+            first += digit_count;
+        }
+
+        return {first, std::errc()};
+    }
+
+    *first++ = digits[0];
+    if (digit_count > 1)
+    {
+        *first++ = '.';
+        std::memcpy(first, digits + 1, unsigned_digits - 1);
+        first += digit_count - 1;
+    }
+
+    *first++ = 'e';
+    if (sci_exponent < 0)
+    {
+        *first++ = '-';
+    }
+    else if (style.exponent_plus_sign)
+    {
+        *first++ = '+';
+    }
+
+    // Print the exponent right aligned in its zero padded field
+    std::memset(first, '0', static_cast<std::size_t>(exponent_digits));
+    to_chars_integer_impl(first + exponent_digits - num_digits(abs_sci_exponent), last, abs_sci_exponent);
+
+    return {first + exponent_digits, std::errc()};
+}
+
+// Lays out the shortest digits given by Dragonbox directly in the notation requested by style,
+// so no reformatting of the general output is required
+template <typename Real>
+to_chars_result to_chars_styled(char* first, char* last, Real value, const shortest_style& style) noexcept
+{
+    if (first > last)
+    {
+        return {last, std::errc::invalid_argument};
+    }
+
+    if (!std::isfinite(value))
+    {
+        return to_chars_styled_nonfinite(first, last, value, style);
+    }
+
+    const bool is_negative = std::signbit(value);
+
+    const std::ptrdiff_t buffer_size = last - first;
+
+    if (value == 0)
+    {
+        const bool print_sign = is_negative && style.negative_zero_sign;
+        const std::ptrdiff_t total_length = 1 + static_cast<std::ptrdiff_t>(print_sign) + (style.force_decimal_point ? 2 : 0);
+        if (total_length > buffer_size)
+        {
+            return {last, std::errc::result_out_of_range};
+        }
+
+        if (print_sign)
+        {
+            *first++ = '-';
+        }
+
+        *first++ = '0';
+        if (style.force_decimal_point)
+        {
+            std::memcpy(first, ".0", 2); // NOLINT : No null terminator is purposeful
+            first += 2;
+        }
+
+        return {first, std::errc()};
+    }
+
+    const auto dec = to_decimal(value);
+    return write_styled_decimal(first, last, is_negative, dec.significand, dec.exponent, style);
+}
+
+// The shortest digits from Dragonbox have no trailing zeros, so they are already the significant digits of the key
+template <typename Real>
+to_chars_result to_chars_sortable_impl(char* first, char* last, Real value) noexcept
+{
+    const bool is_negative = std::signbit(value);
+
+    if (std::isnan(value))
+    {
+        return write_sortable_class(first, last, 'F');
+    }
+    else if (std::isinf(value))
+    {
+        return write_sortable_class(first, last, is_negative ? 'A' : 'E');
+    }
+    else if (value == 0)
+    {
+        return write_sortable_class(first, last, 'C');
+    }
+
+    const auto dec = to_decimal(value);
+
+    char digits[20];
+    const auto r = to_chars_integer_impl(digits, digits + sizeof(digits), dec.significand);
+    const auto digit_count = static_cast<int>(r.ptr - digits);
+
+    return write_sortable(first, last, is_negative, digits, static_cast<std::size_t>(digit_count), dec.exponent + digit_count);
+}
+
+// Copies digits [from, from + size) of a number whose digits are digits[0, count), reading zeros before and after them
+inline char* copy_fixed_digits(char* out, const char* digits, int count, int from, int size) noexcept
+{
+    if (from < 0)
+    {
+        const int zeros = (std::min)(-from, size);
+        std::memset(out, '0', static_cast<std::size_t>(zeros));
+        out += zeros;
+        from += zeros;
+        size -= zeros;
+    }
+    if (from < count && size > 0)
+    {
+        const int n = (std::min)(count - from, size);
+        std::memcpy(out, digits + from, static_cast<std::size_t>(n));
+        out += n;
+        from += n;
+        size -= n;
+    }
+    std::memset(out, '0', static_cast<std::size_t>(size));
+    return out + size;
+}
+
+// Writes digits[0, count), where the first digit is at 10^exponent, in fixed notation with fraction_digits digits
+// after the decimal point and the integer digits in groups
+inline to_chars_result write_grouped_fixed(char* first, char* last, bool is_negative, const char* digits, int count, int exponent,
+                                           int fraction_digits, char separator, int group_size, char decimal_point) noexcept
+{
+    const int integer_digits = exponent >= 0 ? exponent + 1 : 1;
+    const std::size_t length = static_cast<std::size_t>(is_negative) + grouped_length(integer_digits, group_size) +
+                               (fraction_digits > 0 ? static_cast<std::size_t>(fraction_digits) + 1 : 0);
+
+    if (length > static_cast<std::size_t>(last - first))
+    {
+        return {last, std::errc::result_out_of_range};
+    }
+
+    if (is_negative)
+    {
+        *first++ = '-';
+    }
+
+    if (exponent < 0)
+    {
+        *first++ = '0';
+    }
+    else if (group_size <= 0)
+    {
+        first = copy_fixed_digits(first, digits, count, 0, integer_digits);
+    }
+    else
+    {
+        const int leading = (integer_digits - 1) % group_size + 1;
+        first = copy_fixed_digits(first, digits, count, 0, leading);
+        for (int i = leading; i < integer_digits; i += group_size)
+        {
+            *first++ = separator;
+            first = copy_fixed_digits(first, digits, count, i, group_size);
+        }
+    }
+
+    if (fraction_digits > 0)
+    {
+        *first++ = decimal_point;
+        first = copy_fixed_digits(first, digits, count, exponent + 1, fraction_digits);
+    }
+
+    return {first, std::errc()};
+}
+
+// Splits the text of printf %e into its digits and the exponent of the first one.
+// digits may be the text itself since the digits only move to the left
+inline int parse_printf_scientific(const char* first, const char* last, char* digits, int& exponent) noexcept
+{
+    int count = 0;
+    const char* p = first;
+    for (; *p != 'e'; ++p)
+    {
+        if (*p >= '0' && *p <= '9')
+        {
+            digits[count++] = *p;
+        }
+    }
+
+    int e = 0;
+    const bool negative_exponent = p[1] == '-';
+    for (p += 2; p != last; ++p)
+    {
+        e = e * 10 + (*p - '0');
+    }
+    exponent = negative_exponent ? -e : e;
+
+    return count;
+}
+
+// The first precision + 1 significant digits of x (positive and finite) correctly rounded, and the exponent of the
+// first one. floff is only used for normal values and up to 20 digits, beyond which the exact digits come from printf.
+inline int scientific_digits(double x, int precision, char* digits, int& exponent) noexcept
+{
+    char buffer[800];
+    char* end;
+
+    if (precision <= 19 && x >= (std::numeric_limits<double>::min)())
+    {
+        end = floff<main_cache_default, extended_cache_long>(x, precision, buffer, chars_format::scientific);
+    }
+    else
+    {
+        // No double has more than 767 significant digits, so the rest are zeros
+        const int n = std::snprintf(buffer, sizeof(buffer), "%.*e", (std::min)(precision, 780), x);
+        end = buffer + n;
+    }
+
+    return parse_printf_scientific(buffer, end, digits, exponent);
+}
+
+// Size of the digits buffers of the fixed and standard layouts, which hold every significant digit of a value
+template <typename Real>
+struct exact_digits_buffer : std::integral_constant<int, std::is_same<Real, long double>::value ? 11700 : 800> {};
+
+// The shortest digits of value (finite and not zero) that round trip, and the exponent of the first one
+template <typename Real>
+int shortest_digits(Real value, char* digits, int& exponent) noexcept
+{
+    const auto dec = to_decimal(value);
+    const auto r = to_chars_integer_impl(digits, digits + 20, dec.significand);
+    const int count = static_cast<int>(r.ptr - digits);
+    exponent = dec.exponent + count - 1;
+    return count;
+}
+
+#if (BOOST_CHARCONV_LDBL_BITS == 80 || BOOST_CHARCONV_LDBL_BITS == 128) && !defined(BOOST_MSVC)
+
+inline int shortest_digits(long double value, char* digits, int& exponent) noexcept
+{
+    const auto fd128 = ryu::long_double_to_fd128(value);
+    auto mantissa = fd128.mantissa;
+
+    char buffer[40];
+    int count = 0;
+    while (mantissa != 0)
+    {
+        buffer[count++] = static_cast<char>('0' + static_cast<int>(mantissa % 10));
+        mantissa /= 10;
+    }
+
+    int length = 0;
+    for (int i = count - 1; i >= 0; --i)
+    {
+        digits[length++] = buffer[i];
+    }
+    exponent = fd128.exponent + count - 1;
+
+    while (length > 1 && digits[length - 1] == '0')
+    {
+        --length;
+    }
+    return length;
+}
+
+// No long double has more than 11600 significant digits, so the rest are zeros
+inline int scientific_digits(long double x, int precision, char* digits, int& exponent) noexcept
+{
+    const int n = std::snprintf(digits, static_cast<std::size_t>(exact_digits_buffer<long double>::value), "%.*Le", (std::min)(precision, 11600), x);
+    return parse_printf_scientific(digits, digits + n, digits, exponent);
+}
+
+#endif
+
+// Whether x, which is below 10^-precision, rounds to nearest (ties to even) up to 10^-precision rather than down to zero
+template <typename Real>
+bool rounds_to_last_place(Real x, int precision, char* digits) noexcept
+{
+    int exponent = 0;
+    const int count = scientific_digits(x, exact_digits_buffer<Real>::value - 100, digits, exponent);
+    if (exponent != -precision - 1 || digits[0] < '5')
+    {
+        return false;
+    }
+
+    for (int i = 1; i < count; ++i)
+    {
+        if (digits[i] != '0')
+        {
+            return true;
+        }
+    }
+
+    // Exactly halfway between zero and 10^-precision, and zero is even
+    return digits[0] != '5';
+}
+
+// The exact value rounded to precision digits after the decimal point, or the shortest digits that round trip
+// if precision is negative. value is finite.
+template <typename Real>
+to_chars_result write_fixed_value(char* first, char* last, Real value, int precision, char separator, int group_size, char decimal_point) noexcept
+{
+    char digits[exact_digits_buffer<Real>::value];
+    const bool is_negative = std::signbit(value);
+    int count = 0;
+    int exponent = 0;
+
+    if (value == 0)
+    {
+        digits[0] = '0';
+        count = 1;
+    }
+    else if (precision < 0)
+    {
+        count = shortest_digits(value, digits, exponent);
+    }
+    else
+    {
+        // The shortest representation has the decimal exponent of value, or one more when it rounds up to a power of ten.
+        // The latter asks for one digit too many, which shows as a smaller exponent in the output and is redone.
+        int estimate = 0;
+        shortest_digits(value, digits, estimate);
+        const auto x = std::fabs(value);
+
+        int significant = estimate + precision;
+        if (significant >= 0)
+        {
+            count = scientific_digits(x, significant, digits, exponent);
+            if (exponent < estimate)
+            {
+                --significant;
+                if (significant >= 0)
+                {
+                    count = scientific_digits(x, significant, digits, exponent);
+                }
+            }
+        }
+
+        if (significant == -1)
+        {
+            // Below 10^-precision, so the result is either zero or one in the last place
+            count = rounds_to_last_place(x, precision, digits) ? 1 : 0;
+            digits[0] = '1';
+            exponent = -precision;
+        }
+        else if (significant < -1)
+        {
+            count = 0;
+            exponent = 0;
+        }
+    }
+
+    const int fraction_digits = precision < 0 ? (std::max)(count - 1 - exponent, 0) : precision;
+    return write_grouped_fixed(first, last, is_negative, digits, count, exponent, fraction_digits, separator, group_size, decimal_point);
+}
+
+template <typename Real>
+to_chars_result to_chars_grouped_impl(char* first, char* last, Real value, int precision, char separator, int group_size, char decimal_point) noexcept
+{
+    if (!std::isfinite(value))
+    {
+        char buffer[64];
+        const auto r = to_chars_float_impl(buffer, buffer + sizeof(buffer), value);
+        const auto size = static_cast<std::size_t>(r.ptr - buffer);
+        if (size > static_cast<std::size_t>(last - first))
+        {
+            return {last, std::errc::result_out_of_range};
+        }
+        std::memcpy(first, buffer, size);
+        return {first + size, std::errc()};
+    }
+
+    return write_fixed_value(first, last, value, precision, separator, group_size, decimal_point);
+}
+
+// Rounds the shortest digits significand * 10^exponent of value to at most max_digits significant digits,
+// and removes the trailing zeros of the result. Returns false if the digits are already short enough.
+template <typename Real>
+bool round_shortest(Real value, int max_digits, std::uint64_t& significand, int& exponent) noexcept
+{
+    const int digits = num_digits(significand);
+    if (digits <= max_digits)
+    {
+        return false;
+    }
+
+    std::uint64_t divisor = 10;
+    for (int i = max_digits + 1; i < digits; ++i)
+    {
+        divisor *= 10;
+    }
+
+    // Any point between the shortest digits and the value would be a shorter or closer representation,
+    // so rounding the shortest digits rounds the value, except when they end exactly halfway
+    const std::uint64_t remainder = significand % divisor;
+    significand /= divisor;
+    exponent += digits - max_digits;
+
+    if (remainder * 2 > divisor)
+    {
+        ++significand;
+    }
+    else if (remainder * 2 == divisor)
+    {
+        char buffer[800];
+        const int count = scientific_digits(std::abs(static_cast<double>(value)), max_digits - 1, buffer, exponent);
+        significand = 0;
+        for (int i = 0; i < count; ++i)
+        {
+            significand = significand * 10 + static_cast<std::uint64_t>(buffer[i] - '0');
+        }
+        exponent -= count - 1;
+    }
+
+    while (significand % 10 == 0)
+    {
+        significand /= 10;
+        ++exponent;
+    }
+
+    return true;
+}
+
+template <typename Real>
+to_chars_result to_chars_max_digits_impl(char* first, char* last, Real value, int max_digits, chars_format fmt) noexcept
+{
+    using Unsigned_Integer = typename std::conditional<std::is_same<Real, double>::value, std::uint64_t, std::uint32_t>::type;
+
+    if (first > last)
+    {
+        return {last, std::errc::invalid_argument};
+    }
+    if (!std::isfinite(value) || value == 0 || fmt == chars_format::hex)
+    {
+        return to_chars_float_impl(first, last, value, fmt);
+    }
+
+    const auto dec = to_decimal(value);
+    std::uint64_t significand = dec.significand;
+    int exponent = dec.exponent;
+    const bool rounded = round_shortest(value, (std::max)(max_digits, 1), significand, exponent);
+
+    // The layout of to_chars: fixed notation from 1 up to the largest integer of the same width, scientific otherwise.
+    // to_chars writes the exact integer above max_fractional_value rather than the shortest digits,
+    // which is only used when all the digits of the integer are within max_digits.
+    constexpr auto max_fractional_value = std::is_same<Real, double>::value ? static_cast<Real>(1e16) : static_cast<Real>(1e7);
+    constexpr auto max_value = static_cast<Real>((std::numeric_limits<Unsigned_Integer>::max)());
+    const auto abs_value = std::abs(value);
+    const bool fixed_range = fmt != chars_format::scientific && abs_value < max_value;
+
+    if (!rounded && fixed_range && abs_value >= max_fractional_value &&
+        num_digits(static_cast<Unsigned_Integer>(abs_value)) <= max_digits)
+    {
+        return to_chars_float_impl(first, last, value, fmt);
+    }
+
+    const shortest_style style {0, fixed_range ? (std::numeric_limits<int>::max)() : 0, 2, true, false, true, nonfinite_style::standard};
+    return write_styled_decimal(first, last, dec.is_negative, significand, exponent, style);
+}
+
+template <typename Real>
+to_chars_result to_chars_max_digits_impl(char* first, char* last, Real value, int max_digits, const shortest_style& style) noexcept
+{
+    if (first > last)
+    {
+        return {last, std::errc::invalid_argument};
+    }
+    if (!std::isfinite(value) || value == 0)
+    {
+        return to_chars_styled(first, last, value, style);
+    }
+
+    const auto dec = to_decimal(value);
+    std::uint64_t significand = dec.significand;
+    int exponent = dec.exponent;
+    round_shortest(value, (std::max)(max_digits, 1), significand, exponent);
+
+    return write_styled_decimal(first, last, dec.is_negative, significand, exponent, style);
+}
+
+// The layouts of std::to_chars, which std::format uses for the floating point types
+
+inline to_chars_result write_standard_nonfinite(char* first, char* last, bool is_negative, bool is_nan) noexcept
+{
+    if (static_cast<std::size_t>(is_negative) + 3 > static_cast<std::size_t>(last - first))
+    {
+        return {last, std::errc::result_out_of_range};
+    }
+
+    if (is_negative)
+    {
+        *first++ = '-';
+    }
+    std::memcpy(first, is_nan ? "nan" : "inf", 3);
+    return {first + 3, std::errc()};
+}
+
+// Writes digits[0, count), where the first digit is at 10^exponent, as d.ddde+dd with fraction_digits digits after the point
+inline to_chars_result write_standard_scientific(char* first, char* last, bool is_negative, const char* digits, int count,
+                                                 int exponent, int fraction_digits) noexcept
+{
+    int abs_exponent = exponent < 0 ? -exponent : exponent;
+    const int exponent_digits = abs_exponent >= 1000 ? 4 : abs_exponent >= 100 ? 3 : 2;
+    const std::size_t length = static_cast<std::size_t>(is_negative) + 1 +
+                               (fraction_digits > 0 ? static_cast<std::size_t>(fraction_digits) + 1 : 0) +
+                               2 + static_cast<std::size_t>(exponent_digits);
+
+    if (length > static_cast<std::size_t>(last - first))
+    {
+        return {last, std::errc::result_out_of_range};
+    }
+
+    if (is_negative)
+    {
+        *first++ = '-';
+    }
+
+    *first++ = digits[0];
+    if (fraction_digits > 0)
+    {
+        *first++ = '.';
+        first = copy_fixed_digits(first, digits, count, 1, fraction_digits);
+    }
+
+    *first++ = 'e';
+    *first++ = exponent < 0 ? '-' : '+';
+    for (int i = exponent_digits - 1; i >= 0; --i)
+    {
+        first[i] = static_cast<char>('0' + abs_exponent % 10);
+        abs_exponent /= 10;
+    }
+
+    return {first + exponent_digits, std::errc()};
+}
+
+// %a without the 0x prefix: writes leading_digit.fraction p exponent, where fraction holds nibbles hex digits,
+// with the trailing zeros removed if precision is negative, or rounded to nearest (ties to even) to precision digits
+inline to_chars_result write_standard_hex(char* first, char* last, bool is_negative, int leading_digit, std::uint64_t fraction,
+                                          int nibbles, int exponent, int precision) noexcept
+{
+    int fraction_digits = precision;
+    if (precision < 0)
+    {
+        fraction_digits = nibbles;
+        while (fraction_digits > 0 && ((fraction >> (4 * (nibbles - fraction_digits))) & 0xF) == 0)
+        {
+            --fraction_digits;
+        }
+    }
+    else if (precision < nibbles)
+    {
+        const int dropped_bits = 4 * (nibbles - precision);
+        const std::uint64_t rest = fraction & ((UINT64_C(1) << dropped_bits) - 1);
+        const std::uint64_t half = UINT64_C(1) << (dropped_bits - 1);
+        fraction >>= dropped_bits;
+
+        const std::uint64_t last_digit = precision == 0 ? static_cast<std::uint64_t>(leading_digit) : fraction;
+        if (rest > half || (rest == half && (last_digit & 1) != 0))
+        {
+            ++fraction;
+            if ((fraction >> (4 * precision)) != 0)
+            {
+                fraction = 0;
+                ++leading_digit;
+            }
+        }
+        fraction <<= dropped_bits;
+
+        // A leading digit of a whole nibble (80-bit long double) carries into the exponent
+        if (leading_digit == 16)
+        {
+            leading_digit = 1;
+            exponent += 4;
+        }
+    }
+
+    const int abs_exponent = exponent < 0 ? -exponent : exponent;
+    const std::size_t length = static_cast<std::size_t>(is_negative) + 1 +
+                               (fraction_digits > 0 ? static_cast<std::size_t>(fraction_digits) + 1 : 0) +
+                               2 + static_cast<std::size_t>(num_digits(static_cast<std::uint32_t>(abs_exponent)));
+
+    if (length > static_cast<std::size_t>(last - first))
+    {
+        return {last, std::errc::result_out_of_range};
+    }
+
+    if (is_negative)
+    {
+        *first++ = '-';
+    }
+
+    *first++ = "0123456789abcdef"[leading_digit];
+    if (fraction_digits > 0)
+    {
+        *first++ = '.';
+        for (int i = 0; i < fraction_digits; ++i)
+        {
+            const int digit = i < nibbles ? static_cast<int>((fraction >> (4 * (nibbles - 1 - i))) & 0xF) : 0;
+            *first++ = "0123456789abcdef"[digit];
+        }
+    }
+
+    *first++ = 'p';
+    *first++ = exponent < 0 ? '-' : '+';
+    return to_chars_integer_impl(first, last, abs_exponent);
+}
+
+// A leading 1 for normal values and 0 for subnormals and zero, followed by the fraction bits
+template <typename Real>
+to_chars_result to_chars_standard_hex(char* first, char* last, Real value, int precision) noexcept
+{
+    using Unsigned_Integer = typename std::conditional<std::is_same<Real, double>::value, std::uint64_t, std::uint32_t>::type;
+    constexpr int mantissa_bits = std::numeric_limits<Real>::digits - 1;
+    constexpr int exponent_bias = std::numeric_limits<Real>::max_exponent - 1;
+    constexpr int nibbles = (mantissa_bits + 3) / 4;
+
+    Unsigned_Integer bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+
+    const bool is_negative = (bits >> (sizeof(bits) * CHAR_BIT - 1)) != 0;
+    const int biased_exponent = static_cast<int>((bits >> mantissa_bits) & static_cast<Unsigned_Integer>(2 * exponent_bias + 1));
+    const std::uint64_t fraction = static_cast<std::uint64_t>(bits & ((static_cast<Unsigned_Integer>(1) << mantissa_bits) - 1))
+                                   << (nibbles * 4 - mantissa_bits);
+    const int exponent = biased_exponent != 0 ? biased_exponent - exponent_bias : fraction != 0 ? 1 - exponent_bias : 0;
+
+    return write_standard_hex(first, last, is_negative, biased_exponent != 0 ? 1 : 0, fraction, nibbles, exponent, precision);
+}
+
+#if BOOST_CHARCONV_LDBL_BITS == 80 && !defined(BOOST_MSVC)
+
+// The 64-bit significand has an explicit integer bit, so its first nibble is the leading digit as with printf %La
+inline to_chars_result to_chars_standard_hex(char* first, char* last, long double value, int precision) noexcept
+{
+    std::uint64_t significand;
+    std::uint16_t sign_exponent;
+    std::memcpy(&significand, &value, sizeof(significand));
+    std::memcpy(&sign_exponent, reinterpret_cast<const char*>(&value) + sizeof(significand), sizeof(sign_exponent));
+
+    const bool is_negative = (sign_exponent >> 15) != 0;
+    const int biased_exponent = sign_exponent & 0x7FFF;
+    const int exponent = significand == 0 ? 0 : (biased_exponent != 0 ? biased_exponent : 1) - 16383 - 3;
+
+    return write_standard_hex(first, last, is_negative, static_cast<int>(significand >> 60), significand & ((UINT64_C(1) << 60) - 1),
+                              15, exponent, precision);
+}
+
+#endif
+
+template <typename Real>
+to_chars_result to_chars_standard_impl(char* first, char* last, Real value, chars_format fmt, int precision) noexcept
+{
+    if (first > last)
+    {
+        return {last, std::errc::invalid_argument};
+    }
+
+    const bool is_negative = std::signbit(value);
+    if (!std::isfinite(value))
+    {
+        return write_standard_nonfinite(first, last, is_negative, std::isnan(value));
+    }
+
+    if (fmt == chars_format::fixed && precision >= 0)
+    {
+        return write_fixed_value(first, last, value, precision, ',', 0, '.');
+    }
+
+    char digits[exact_digits_buffer<Real>::value];
+    const auto x = std::fabs(value);
+    int exponent = 0;
+    int count = 1;
+    digits[0] = '0';
+
+    if (precision < 0)
+    {
+        if (value != 0)
+        {
+            count = shortest_digits(value, digits, exponent);
+        }
+
+        // Fixed notation if it is not longer than scientific notation
+        if (fmt == chars_format::general)
+        {
+            const int abs_exponent = exponent < 0 ? -exponent : exponent;
+            const int scientific_length = count + (count > 1 ? 1 : 0) + 2 + (abs_exponent >= 1000 ? 4 : abs_exponent >= 100 ? 3 : 2);
+            const int fixed_length = exponent < 0 ? count + 1 - exponent : exponent + 1 < count ? count + 1 : exponent + 1;
+            fmt = fixed_length <= scientific_length ? chars_format::fixed : chars_format::scientific;
+        }
+
+        if (fmt == chars_format::scientific)
+        {
+            return write_standard_scientific(first, last, is_negative, digits, count, exponent, count - 1);
+        }
+
+        // Integers are written with their exact digits rather than zeros after the shortest ones
+        if (exponent >= count)
+        {
+            count = scientific_digits(x, exponent, digits, exponent);
+            return write_grouped_fixed(first, last, is_negative, digits, count, exponent, 0, ',', 0, '.');
+        }
+        return write_grouped_fixed(first, last, is_negative, digits, count, exponent, (std::max)(count - 1 - exponent, 0), ',', 0, '.');
+    }
+
+    if (fmt == chars_format::scientific)
+    {
+        if (value != 0)
+        {
+            count = scientific_digits(x, precision, digits, exponent);
+        }
+        return write_standard_scientific(first, last, is_negative, digits, count, exponent, precision);
+    }
+
+    // %g: precision significant digits without the trailing zeros, in scientific notation below 10^-4 or from 10^precision
+    const int significant = precision == 0 ? 1 : precision;
+    if (value != 0)
+    {
+        count = scientific_digits(x, significant - 1, digits, exponent);
+    }
+    while (count > 1 && digits[count - 1] == '0')
+    {
+        --count;
+    }
+
+    if (exponent >= -4 && exponent < significant)
+    {
+        return write_grouped_fixed(first, last, is_negative, digits, count, exponent, (std::max)(count - 1 - exponent, 0), ',', 0, '.');
+    }
+    return write_standard_scientific(first, last, is_negative, digits, count, exponent, count - 1);
+}
+
+template <typename Real>
+to_chars_result to_chars_standard_dispatch(char* first, char* last, Real value, chars_format fmt, int precision) noexcept
+{
+    if (fmt == chars_format::hex && first <= last && std::isfinite(value))
+    {
+        return to_chars_standard_hex(first, last, value, precision);
+    }
+
+    return to_chars_standard_impl(first, last, value, fmt, precision);
+}
+
+
+}}} // Namespaces
+
 boost::charconv::to_chars_result boost::charconv::to_chars(char* first, char* last, float value,
                                                            boost::charconv::chars_format fmt, int precision) noexcept
 {
@@ -542,6 +1416,95 @@ boost::charconv::to_chars_result boost::charconv::to_chars(char* first, char* la
     return boost::charconv::detail::to_chars_float_impl(first, last, value, fmt, precision);
 }
 
+boost::charconv::to_chars_result boost::charconv::to_chars(char* first, char* last, float value,
+                                                           const boost::charconv::shortest_style& style) noexcept
+{
+    return boost::charconv::detail::to_chars_styled(first, last, value, style);
+}
+
+boost::charconv::to_chars_result boost::charconv::to_chars(char* first, char* last, double value,
+                                                           const boost::charconv::shortest_style& style) noexcept
+{
+    return boost::charconv::detail::to_chars_styled(first, last, value, style);
+}
+
+boost::charconv::to_chars_result boost::charconv::to_chars_max_digits(char* first, char* last, float value, int max_digits,
+                                                                      boost::charconv::chars_format fmt) noexcept
+{
+    return boost::charconv::detail::to_chars_max_digits_impl(first, last, value, max_digits, fmt);
+}
+
+boost::charconv::to_chars_result boost::charconv::to_chars_max_digits(char* first, char* last, double value, int max_digits,
+                                                                      boost::charconv::chars_format fmt) noexcept
+{
+    return boost::charconv::detail::to_chars_max_digits_impl(first, last, value, max_digits, fmt);
+}
+
+boost::charconv::to_chars_result boost::charconv::to_chars_max_digits(char* first, char* last, float value, int max_digits,
+                                                                      const boost::charconv::shortest_style& style) noexcept
+{
+    return boost::charconv::detail::to_chars_max_digits_impl(first, last, value, max_digits, style);
+}
+
+boost::charconv::to_chars_result boost::charconv::to_chars_max_digits(char* first, char* last, double value, int max_digits,
+                                                                      const boost::charconv::shortest_style& style) noexcept
+{
+    return boost::charconv::detail::to_chars_max_digits_impl(first, last, value, max_digits, style);
+}
+
+boost::charconv::to_chars_result boost::charconv::to_chars_sortable(char* first, char* last, float value) noexcept
+{
+    return boost::charconv::detail::to_chars_sortable_impl(first, last, value);
+}
+
+boost::charconv::to_chars_result boost::charconv::to_chars_sortable(char* first, char* last, double value) noexcept
+{
+    return boost::charconv::detail::to_chars_sortable_impl(first, last, value);
+}
+
+boost::charconv::to_chars_result boost::charconv::to_chars_grouped(char* first, char* last, float value, int precision,
+                                                                   char separator, int group_size, char decimal_point) noexcept
+{
+    return boost::charconv::detail::to_chars_grouped_impl(first, last, value, precision, separator, group_size, decimal_point);
+}
+
+boost::charconv::to_chars_result boost::charconv::to_chars_grouped(char* first, char* last, double value, int precision,
+                                                                   char separator, int group_size, char decimal_point) noexcept
+{
+    return boost::charconv::detail::to_chars_grouped_impl(first, last, value, precision, separator, group_size, decimal_point);
+}
+
+boost::charconv::to_chars_result boost::charconv::detail::to_chars_standard(char* first, char* last, float value,
+                                                                     boost::charconv::chars_format fmt, int precision) noexcept
+{
+    return boost::charconv::detail::to_chars_standard_dispatch(first, last, value, fmt, precision);
+}
+
+boost::charconv::to_chars_result boost::charconv::detail::to_chars_standard(char* first, char* last, double value,
+                                                                     boost::charconv::chars_format fmt, int precision) noexcept
+{
+    return boost::charconv::detail::to_chars_standard_dispatch(first, last, value, fmt, precision);
+}
+
+boost::charconv::to_chars_result boost::charconv::detail::to_chars_standard(char* first, char* last, long double value,
+                                                                     boost::charconv::chars_format fmt, int precision) noexcept
+{
+    #if BOOST_CHARCONV_LDBL_BITS == 64 || defined(BOOST_MSVC)
+    return boost::charconv::detail::to_chars_standard_dispatch(first, last, static_cast<double>(value), fmt, precision);
+    #elif BOOST_CHARCONV_LDBL_BITS == 80
+    return boost::charconv::detail::to_chars_standard_dispatch(first, last, value, fmt, precision);
+    #elif BOOST_CHARCONV_LDBL_BITS == 128
+    // The hex digits of a 128-bit long double are those of the library's to_chars
+    if (fmt == boost::charconv::chars_format::hex && std::isfinite(value))
+    {
+        return boost::charconv::to_chars(first, last, value, fmt, precision);
+    }
+    return boost::charconv::detail::to_chars_standard_impl(first, last, value, fmt, precision);
+    #else
+    return boost::charconv::to_chars(first, last, value, fmt, precision);
+    #endif
+}
+
 #if BOOST_CHARCONV_LDBL_BITS == 64 || defined(BOOST_MSVC)
 
 boost::charconv::to_chars_result boost::charconv::to_chars(char* first, char* last, long double value,
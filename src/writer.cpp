@@ -0,0 +1,199 @@
+// Copyright 2023 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/charconv/writer.hpp>
+#include <system_error>
+#include <cerrno>
+#include <cstring>
+#include <cstddef>
+
+#ifdef _WIN32
+#  include <io.h>
+#else
+#  include <unistd.h>
+#  include <sys/uio.h>
+#endif
+
+#if defined(BOOST_NO_CXX17_INLINE_VARIABLES)
+constexpr std::size_t boost::charconv::writer::default_buffer_size;
+#endif
+
+namespace boost { namespace charconv { namespace detail {
+
+// Writes both pieces to fd, retrying on partial writes and interruptions
+static std::errc write_fd(int fd, const char* data, std::size_t size, const char* extra_data, std::size_t extra_size) noexcept
+{
+    #ifdef _WIN32
+
+    const char* pieces[] = {data, extra_data};
+    std::size_t sizes[] = {size, extra_size};
+
+    for (std::size_t i = 0; i < 2; ++i)
+    {
+        while (sizes[i] != 0)
+        {
+            const unsigned chunk = sizes[i] > 0x40000000U ? 0x40000000U : static_cast<unsigned>(sizes[i]);
+            const int r = ::_write(fd, pieces[i], chunk);
+            if (r < 0)
+            {
+                if (errno == EINTR)
+                {
+                    continue;
+                }
+                return static_cast<std::errc>(errno);
+            }
+            pieces[i] += r;
+            sizes[i] -= static_cast<std::size_t>(r);
+        }
+    }
+
+    #else
+
+    ::iovec iov[2];
+    int count = 0;
+    if (size != 0)
+    {
+        iov[count].iov_base = const_cast<char*>(data);
+        iov[count].iov_len = size;
+        ++count;
+    }
+    if (extra_size != 0)
+    {
+        iov[count].iov_base = const_cast<char*>(extra_data);
+        iov[count].iov_len = extra_size;
+        ++count;
+    }
+
+    ::iovec* next = iov;
+
+    while (count != 0)
+    {
+        const ::ssize_t r = ::writev(fd, next, count);
+        if (r < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            return static_cast<std::errc>(errno);
+        }
+
+        // Skip over everything that has been written
+        auto written = static_cast<std::size_t>(r);
+        while (count != 0 && written >= next->iov_len)
+        {
+            written -= next->iov_len;
+            ++next;
+            --count;
+        }
+        if (count != 0)
+        {
+            next->iov_base = static_cast<char*>(next->iov_base) + written;
+            next->iov_len -= written;
+        }
+    }
+
+    #endif
+
+    return std::errc();
+}
+
+}}} // Namespaces
+
+boost::charconv::writer::writer(int fd, std::size_t buffer_size)
+    : owned_ {new char[buffer_size]}, first_ {owned_.get()}, pos_ {first_}, end_ {first_ + buffer_size},
+      fd_ {fd}, fn_ {nullptr}, context_ {nullptr}, error_ {}
+{
+}
+
+boost::charconv::writer::writer(int fd, char* buffer, std::size_t buffer_size) noexcept
+    : owned_ {}, first_ {buffer}, pos_ {buffer}, end_ {buffer + buffer_size},
+      fd_ {fd}, fn_ {nullptr}, context_ {nullptr}, error_ {}
+{
+}
+
+boost::charconv::writer::writer(flush_function fn, void* context, std::size_t buffer_size)
+    : owned_ {new char[buffer_size]}, first_ {owned_.get()}, pos_ {first_}, end_ {first_ + buffer_size},
+      fd_ {-1}, fn_ {fn}, context_ {context}, error_ {}
+{
+}
+
+boost::charconv::writer::writer(flush_function fn, void* context, char* buffer, std::size_t buffer_size) noexcept
+    : owned_ {}, first_ {buffer}, pos_ {buffer}, end_ {buffer + buffer_size},
+      fd_ {-1}, fn_ {fn}, context_ {context}, error_ {}
+{
+}
+
+boost::charconv::writer::~writer()
+{
+    flush();
+}
+
+bool boost::charconv::writer::sink(const char* data, std::size_t size, const char* extra_data, std::size_t extra_size) noexcept
+{
+    if (fn_ != nullptr)
+    {
+        if ((size != 0 && !fn_(context_, data, size)) || (extra_size != 0 && !fn_(context_, extra_data, extra_size)))
+        {
+            error_ = std::errc::io_error;
+        }
+    }
+    else
+    {
+        error_ = detail::write_fd(fd_, data, size, extra_data, extra_size);
+    }
+
+    return error_ == std::errc();
+}
+
+std::errc boost::charconv::writer::flush() noexcept
+{
+    if (error_ == std::errc() && pos_ != first_)
+    {
+        sink(first_, size(), nullptr, 0);
+    }
+
+    pos_ = first_;
+    return error_;
+}
+
+bool boost::charconv::writer::ensure_slow(std::size_t n) noexcept
+{
+    if (error_ != std::errc())
+    {
+        return false;
+    }
+
+    if (n > capacity())
+    {
+        error_ = std::errc::value_too_large;
+        return false;
+    }
+
+    return flush() == std::errc();
+}
+
+boost::charconv::writer& boost::charconv::writer::write(const char* data, std::size_t size) noexcept
+{
+    if (error_ != std::errc())
+    {
+        return *this;
+    }
+
+    if (size > capacity() / 2)
+    {
+        // One call for the buffered output and the piece instead of copying the piece
+        sink(first_, this->size(), data, size);
+        pos_ = first_;
+        return *this;
+    }
+
+    if (ensure(size))
+    {
+        std::memcpy(pos_, data, size);
+        pos_ += size;
+    }
+
+    return *this;
+}
@@ -0,0 +1,161 @@
+// Copyright 2023 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/charconv/batch_to_chars.hpp>
+#include <boost/charconv.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <system_error>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+#include <limits>
+#include <cstring>
+#include <cstdint>
+
+static const boost::charconv::chars_format formats[] = {
+    boost::charconv::chars_format::general, boost::charconv::chars_format::fixed,
+    boost::charconv::chars_format::scientific, boost::charconv::chars_format::hex
+};
+
+static float from_bits(std::uint32_t bits)
+{
+    float value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+// The output is that of to_chars for each value followed by the separator
+void test_values(const std::vector<float>& values, boost::charconv::chars_format fmt)
+{
+    std::string expected;
+    for (const float value : values)
+    {
+        char buffer[64];
+        const auto r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), value, fmt);
+        expected.append(buffer, r.ptr);
+        expected += ',';
+    }
+
+    std::vector<char> buffer(values.size() * (boost::charconv::limits<float>::max_chars10 + 1) + 1);
+    const auto r = boost::charconv::batch_to_chars(buffer.data(), buffer.data() + buffer.size(), values.data(), values.size(), ',', fmt);
+    BOOST_TEST(r.ec == std::errc());
+
+    const std::string result(buffer.data(), r.ptr);
+    if (!BOOST_TEST(result == expected))
+    {
+        for (std::size_t i = 0, j = 0; i < values.size(); ++i)                   // LCOV_EXCL_LINE
+        {
+            const auto n = expected.find(',', j) - j + 1;                       // LCOV_EXCL_LINE
+            if (result.compare(j, n, expected, j, n) != 0)                      // LCOV_EXCL_LINE
+            {
+                std::cerr << "Value: " << values[i] << " Expected: " << expected.substr(j, n - 1) // LCOV_EXCL_LINE
+                          << " Format: " << static_cast<int>(fmt) << std::endl; // LCOV_EXCL_LINE
+                break;                                                          // LCOV_EXCL_LINE
+            }
+            j += n;                                                             // LCOV_EXCL_LINE
+        }
+    }
+
+    // Exactly enough room, and one character less
+    buffer.assign(expected.size(), '\0');
+    const auto exact = boost::charconv::batch_to_chars(buffer.data(), buffer.data() + buffer.size(), values.data(), values.size(), ',', fmt);
+    BOOST_TEST(exact.ec == std::errc());
+    BOOST_TEST(exact.ptr == buffer.data() + buffer.size());
+
+    if (!expected.empty())
+    {
+        const auto short_result = boost::charconv::batch_to_chars(buffer.data(), buffer.data() + buffer.size() - 1, values.data(), values.size(), ',', fmt);
+        BOOST_TEST(short_result.ec == std::errc::result_out_of_range);
+        BOOST_TEST(short_result.ptr == buffer.data() + buffer.size() - 1);
+    }
+}
+
+void test_random(std::mt19937_64& gen)
+{
+    std::vector<float> values;
+    for (int i = 0; i < 20000; ++i)
+    {
+        values.push_back(from_bits(static_cast<std::uint32_t>(gen())));
+    }
+
+    for (const auto fmt : formats)
+    {
+        test_values(values, fmt);
+    }
+}
+
+// Every binary exponent with a few significands, including the powers of two and the subnormals
+void test_exponents(std::mt19937_64& gen)
+{
+    std::vector<float> values;
+    for (std::uint32_t exponent_bits = 0; exponent_bits < 256; ++exponent_bits)
+    {
+        for (const std::uint32_t sign : {UINT32_C(0), UINT32_C(0x80000000)})
+        {
+            const std::uint32_t bits = sign | (exponent_bits << 23);
+            values.push_back(from_bits(bits));
+            values.push_back(from_bits(bits | 1));
+            values.push_back(from_bits(bits | 0x7FFFFF));
+            values.push_back(from_bits(bits | (static_cast<std::uint32_t>(gen()) & 0x7FFFFF)));
+        }
+    }
+
+    for (const auto fmt : formats)
+    {
+        test_values(values, fmt);
+    }
+}
+
+// Values printed without an exponent and integers near the limits of the fixed layouts
+void test_decimal_values(std::mt19937_64& gen)
+{
+    std::vector<float> values;
+    for (int i = 0; i < 10000; ++i)
+    {
+        values.push_back(static_cast<float>(gen() % 100000000) / static_cast<float>(1 << (gen() % 12)));
+    }
+    for (const float value : {1e7F, 9999999.0F, 4294967296.0F, 4294967040.0F, 1.0F, 0.999999F, 1e-7F, 123456.7F})
+    {
+        values.push_back(value);
+        values.push_back(-value);
+    }
+    values.push_back(std::numeric_limits<float>::max());
+    values.push_back(std::numeric_limits<float>::min());
+    values.push_back(std::numeric_limits<float>::denorm_min());
+    values.push_back(std::numeric_limits<float>::infinity());
+    values.push_back(-std::numeric_limits<float>::quiet_NaN());
+
+    for (const auto fmt : formats)
+    {
+        test_values(values, fmt);
+    }
+}
+
+// Counts that are not a multiple of the vector width
+void test_counts(std::mt19937_64& gen)
+{
+    for (std::size_t count = 0; count <= 17; ++count)
+    {
+        std::vector<float> values;
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            values.push_back(from_bits(static_cast<std::uint32_t>(gen())));
+        }
+
+        test_values(values, boost::charconv::chars_format::general);
+    }
+}
+
+int main()
+{
+    std::mt19937_64 gen(42);
+
+    test_random(gen);
+    test_exponents(gen);
+    test_decimal_values(gen);
+    test_counts(gen);
+
+    return boost::report_errors();
+}
@@ -0,0 +1,185 @@
+// Copyright 2023 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/charconv/column_profile.hpp>
+#include <boost/charconv.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <random>
+#include <string>
+#include <vector>
+#include <cstring>
+#include <cstdio>
+#include <cstdint>
+
+using boost::charconv::column_kind;
+using boost::charconv::column_profile;
+
+static column_profile profile(const std::string& column, char separator = ',', std::size_t samples = 0)
+{
+    return boost::charconv::profile_column(column.data(), column.data() + column.size(), separator, samples);
+}
+
+void test_kinds()
+{
+    BOOST_TEST(profile("").kind == column_kind::empty);
+    BOOST_TEST(profile(",,").kind == column_kind::empty);
+    BOOST_TEST(profile("0042,1234,-001,0000").kind == column_kind::fixed_width_integer);
+    BOOST_TEST(profile("42,1234,-1,0").kind == column_kind::integer);
+    BOOST_TEST(profile("12345678901234567890123").kind == column_kind::fixed_width_integer);
+    BOOST_TEST(profile("42,12.5,-0.125,7").kind == column_kind::fixed_point);
+    BOOST_TEST(profile("12.34,5.60").kind == column_kind::fixed_point);
+    BOOST_TEST(profile("1,2.5,3e2").kind == column_kind::floating);
+    BOOST_TEST(profile("1.5,inf,-nan").kind == column_kind::floating);
+    BOOST_TEST(profile("0.12345678901234567890").kind == column_kind::floating);
+    BOOST_TEST(profile("1e400").kind == column_kind::floating);
+    BOOST_TEST(profile("ff,10,-7f,a0").kind == column_kind::hex);
+    BOOST_TEST(profile("10,20,30").kind == column_kind::fixed_width_integer);
+    BOOST_TEST(profile("1.5,ff").kind == column_kind::invalid);
+    BOOST_TEST(profile("ff,1.5").kind == column_kind::invalid);
+    BOOST_TEST(profile("1,2,x").kind == column_kind::invalid);
+    BOOST_TEST(profile("1,+2").kind == column_kind::invalid);
+    BOOST_TEST(profile("1,2 ").kind == column_kind::invalid);
+    BOOST_TEST(profile("1,-").kind == column_kind::invalid);
+
+    // Hashes that happen to look like decimal floats
+    BOOST_TEST(profile("1e5,00e1,dead,beef").kind == column_kind::hex);
+    BOOST_TEST(profile("1e5,00e1").kind == column_kind::floating);
+
+    // Empty fields do not change the kind
+    BOOST_TEST(profile("12,,34,").kind == column_kind::fixed_width_integer);
+    BOOST_TEST(profile(",1.5").kind == column_kind::fixed_point);
+}
+
+void test_statistics()
+{
+    auto p = profile("0042,-1.250,,3e-2,x,0.0007");
+    BOOST_TEST(p.kind == column_kind::invalid);
+    BOOST_TEST_EQ(p.fields, 6U);
+    BOOST_TEST_EQ(p.empty_fields, 1U);
+    BOOST_TEST_EQ(p.invalid_fields, 1U);
+    BOOST_TEST_EQ(p.min_width, 1U);
+    BOOST_TEST_EQ(p.max_width, 6U);
+    BOOST_TEST_EQ(p.max_digits, 4);
+    BOOST_TEST_EQ(p.max_fraction_digits, 4);
+    BOOST_TEST(p.needs_exponent);
+    BOOST_TEST(p.has_negative);
+    BOOST_TEST(!p.has_nonfinite);
+    BOOST_TEST(!p.hex_digits);
+    BOOST_TEST(!p.exact_in_double);
+
+    p = profile("1.5,-0.25,1024,0,9007199254740992");
+    BOOST_TEST(p.kind == column_kind::fixed_point);
+    BOOST_TEST(!p.needs_exponent);
+    BOOST_TEST(p.exact_in_double);
+    BOOST_TEST_EQ(p.max_digits, 16);
+    BOOST_TEST_EQ(p.max_fraction_digits, 2);
+
+    BOOST_TEST(!profile("9007199254740993").exact_in_double);
+    BOOST_TEST(profile("0.018973670899868011474609375,0.5").exact_in_double);
+    BOOST_TEST(profile("1e300,inf").exact_in_double == false);
+    BOOST_TEST(profile("1e22,nan").exact_in_double);
+    BOOST_TEST(profile("1e22,nan").has_nonfinite);
+    BOOST_TEST(!profile("1,2").has_negative);
+
+    p = profile("00ff,dead,-0001");
+    BOOST_TEST(p.kind == column_kind::hex);
+    BOOST_TEST(p.hex_digits);
+    BOOST_TEST(p.has_negative);
+    BOOST_TEST_EQ(p.max_hex_digits, 4);
+
+    // Fields added one at a time
+    column_profile q;
+    const char* fields[] = {"17", "2.5", "", "1e3"};
+    for (const char* f : fields)
+    {
+        boost::charconv::profile_field(q, f, f + std::strlen(f));
+    }
+    BOOST_TEST(q.kind == column_kind::floating);
+    BOOST_TEST_EQ(q.fields, 4U);
+    BOOST_TEST_EQ(q.empty_fields, 1U);
+}
+
+// At most samples fields are examined, and all of them when there are enough samples
+void test_sampling()
+{
+    std::mt19937_64 gen(42);
+    for (std::size_t count = 1; count < 200; count += 7)
+    {
+        std::string column;
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            column += std::to_string(gen() % (UINT64_C(1) << (gen() % 60)));
+            column += '\n';
+        }
+
+        for (std::size_t samples = 1; samples < 300; samples += 13)
+        {
+            const auto p = profile(column, '\n', samples);
+            BOOST_TEST(p.fields <= samples && p.fields <= count);
+            BOOST_TEST(p.fields >= 1);
+            BOOST_TEST(p.kind == column_kind::integer || p.kind == column_kind::fixed_width_integer);
+            BOOST_TEST_EQ(p.empty_fields, 0U);
+        }
+
+        BOOST_TEST_EQ(profile(column, '\n', 0).fields, count);
+        BOOST_TEST_EQ(profile(column, '\n', column.size()).fields, count);
+    }
+
+    // Short fields are all examined when there are more samples than fields
+    const std::string column = "1\n22\n333\n4444\n";
+    BOOST_TEST_EQ(profile(column, '\n', 100).fields, 4U);
+    BOOST_TEST_EQ(profile(column, '\n', 100).max_width, 4U);
+
+    // A single invalid field deep in a large column is found when every field is examined
+    std::string big;
+    for (int i = 0; i < 10000; ++i)
+    {
+        big += std::to_string(i);
+        big += ',';
+    }
+    big += "oops";
+    BOOST_TEST(profile(big, ',', 0).kind == column_kind::invalid);
+    BOOST_TEST(profile(big, ',', 64).fields <= 64U);
+}
+
+// A column of the reported kind is parsed completely by the narrowest overload
+void test_dispatch()
+{
+    std::mt19937_64 gen(42);
+    std::string column;
+    for (int i = 0; i < 1000; ++i)
+    {
+        char buffer[32];
+        std::snprintf(buffer, sizeof(buffer), "%d.%02d\n", static_cast<int>(gen() % 100000) - 50000, static_cast<int>(gen() % 100));
+        column += buffer;
+    }
+
+    const auto p = profile(column, '\n');
+    BOOST_TEST(p.kind == column_kind::fixed_point);
+    BOOST_TEST(p.max_digits <= 7);
+    BOOST_TEST_EQ(p.max_fraction_digits, 2);
+    BOOST_TEST(p.has_negative);
+    BOOST_TEST(!p.exact_in_double);
+
+    const char* first = column.data();
+    const char* last = column.data() + column.size();
+    while (first != last)
+    {
+        double value;
+        const auto r = boost::charconv::from_chars(first, last, value, boost::charconv::chars_format::fixed);
+        BOOST_TEST(r.ec == std::errc());
+        BOOST_TEST_EQ(*r.ptr, '\n');
+        first = r.ptr + 1;
+    }
+}
+
+int main()
+{
+    test_kinds();
+    test_statistics();
+    test_sampling();
+    test_dispatch();
+
+    return boost::report_errors();
+}
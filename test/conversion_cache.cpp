@@ -0,0 +1,209 @@
+// Copyright 2023 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/charconv/conversion_cache.hpp>
+#include <boost/charconv.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <boost/config.hpp>
+#include <system_error>
+#include <random>
+#include <limits>
+#include <string>
+#include <vector>
+#include <thread>
+#include <cstring>
+#include <iostream>
+
+static const boost::charconv::chars_format formats[] = {boost::charconv::chars_format::general,
+                                                        boost::charconv::chars_format::fixed,
+                                                        boost::charconv::chars_format::scientific,
+                                                        boost::charconv::chars_format::hex};
+
+// Every conversion is compared against the uncached one, so hits and collisions must give the same answers
+void test_values(const std::vector<double>& values)
+{
+    for (const double v : values)
+    {
+        for (const auto fmt : formats)
+        {
+            for (const int precision : {-1, 0, 3, 17})
+            {
+                char expected[512];
+                char actual[512];
+                const auto r1 = boost::charconv::to_chars(expected, expected + sizeof(expected), v, fmt, precision);
+                const auto r2 = boost::charconv::cached_to_chars(actual, actual + sizeof(actual), v, fmt, precision);
+                BOOST_TEST(r1.ec == r2.ec);
+                if (!BOOST_TEST(std::string(expected, r1.ptr) == std::string(actual, r2.ptr)))
+                {
+                    std::cerr << "Value: " << v << std::endl; // LCOV_EXCL_LINE
+                }
+
+                // Parse the text back with the cache as well
+                double parsed1 {};
+                double parsed2 {};
+                const auto p1 = boost::charconv::from_chars(expected, r1.ptr, parsed1, fmt);
+                const auto p2 = boost::charconv::cached_from_chars(expected, r1.ptr, parsed2, fmt);
+                BOOST_TEST(p1 == p2);
+                BOOST_TEST(std::memcmp(&parsed1, &parsed2, sizeof(double)) == 0);
+            }
+        }
+    }
+}
+
+void test_repeats()
+{
+    std::mt19937_64 gen(42);
+    std::uniform_real_distribution<double> dist(-1e6, 1e6);
+
+    // A small working set that is converted over and over
+    std::vector<double> values;
+    for (int i = 0; i < 50; ++i)
+    {
+        values.push_back(dist(gen));
+    }
+    values.push_back(0.0);
+    values.push_back(-0.0);
+    values.push_back(std::numeric_limits<double>::infinity());
+    values.push_back(std::numeric_limits<double>::quiet_NaN());
+    values.push_back(1e300);
+    values.push_back((std::numeric_limits<double>::min)());
+
+    // Large enough for the whole working set, so after the first round only outputs too long to store miss
+    BOOST_TEST(boost::charconv::set_conversion_cache_size(16384));
+    boost::charconv::reset_conversion_cache_stats();
+    for (int i = 0; i < 5; ++i)
+    {
+        test_values(values);
+    }
+    BOOST_TEST(boost::charconv::set_conversion_cache_size(boost::charconv::default_conversion_cache_size));
+
+    const auto stats = boost::charconv::get_conversion_cache_stats();
+    BOOST_TEST(stats.to_chars_hits > stats.to_chars_misses);
+    BOOST_TEST(stats.from_chars_hits > stats.from_chars_misses);
+    BOOST_TEST_EQ(stats.to_chars_hits + stats.to_chars_misses, 5 * values.size() * 4 * 4);
+}
+
+void test_collisions()
+{
+    // A single slot means that every new key replaces the previous one
+    BOOST_TEST(boost::charconv::set_conversion_cache_size(1));
+    BOOST_TEST_EQ(boost::charconv::conversion_cache_size(), 1U);
+
+    std::mt19937_64 gen(1);
+    std::vector<double> values;
+    for (int i = 0; i < 200; ++i)
+    {
+        const auto bits = gen();
+        double v;
+        std::memcpy(&v, &bits, sizeof(v));
+        values.push_back(v);
+    }
+    test_values(values);
+
+    BOOST_TEST(boost::charconv::set_conversion_cache_size(1000));
+    BOOST_TEST_EQ(boost::charconv::conversion_cache_size(), 512U);
+    test_values(values);
+
+    BOOST_TEST(boost::charconv::set_conversion_cache_size(boost::charconv::default_conversion_cache_size));
+}
+
+void test_disabled()
+{
+    BOOST_TEST(boost::charconv::set_conversion_cache_size(0));
+    BOOST_TEST_EQ(boost::charconv::conversion_cache_size(), 0U);
+    boost::charconv::reset_conversion_cache_stats();
+
+    char buffer[64];
+    const auto r = boost::charconv::cached_to_chars(buffer, buffer + sizeof(buffer), 1.5);
+    BOOST_TEST(r.ec == std::errc());
+    BOOST_TEST_EQ(std::string(buffer, r.ptr), "1.5");
+
+    double v {};
+    const auto r2 = boost::charconv::cached_from_chars(buffer, r.ptr, v);
+    BOOST_TEST(r2.ec == std::errc());
+    BOOST_TEST_EQ(v, 1.5);
+
+    const auto stats = boost::charconv::get_conversion_cache_stats();
+    BOOST_TEST_EQ(stats.to_chars_hits + stats.to_chars_misses + stats.from_chars_hits + stats.from_chars_misses, 0U);
+
+    BOOST_TEST(boost::charconv::set_conversion_cache_size(boost::charconv::default_conversion_cache_size));
+}
+
+void test_errors()
+{
+    // A hit must still respect the size of the buffer, and fail the same way as a miss
+    char buffer[64];
+    auto r = boost::charconv::cached_to_chars(buffer, buffer + 3, 654.321);
+    BOOST_TEST(r.ec == std::errc::result_out_of_range);
+    BOOST_TEST(r.ptr == buffer + 3);
+    r = boost::charconv::cached_to_chars(buffer, buffer + sizeof(buffer), 123.456);
+    BOOST_TEST(r.ec == std::errc());
+    r = boost::charconv::cached_to_chars(buffer, buffer + 3, 123.456);
+    BOOST_TEST(r.ec == std::errc::result_out_of_range);
+    BOOST_TEST(r.ptr == buffer + 3);
+
+    // Failures are not cached, and the value is left alone
+    double v = 42;
+    const char* bad = "x1.5";
+    for (int i = 0; i < 2; ++i)
+    {
+        const auto r2 = boost::charconv::cached_from_chars(bad, bad + 4, v);
+        BOOST_TEST(r2.ec == std::errc::invalid_argument);
+        BOOST_TEST_EQ(v, 42.0);
+    }
+
+    // Partial matches report the same end on a hit
+    const char* partial = "2.5abc";
+    for (int i = 0; i < 2; ++i)
+    {
+        const auto r2 = boost::charconv::cached_from_chars(partial, partial + 6, v);
+        BOOST_TEST(r2.ec == std::errc());
+        BOOST_TEST(r2.ptr == partial + 3);
+        BOOST_TEST_EQ(v, 2.5);
+    }
+
+    // Inputs longer than conversion_cache_max_chars bypass the cache
+    const std::string long_input = "3.14159265358979323846264338327950288";
+    const auto r3 = boost::charconv::cached_from_chars(long_input.data(), long_input.data() + long_input.size(), v);
+    BOOST_TEST(r3.ec == std::errc());
+    BOOST_TEST_EQ(v, 3.14159265358979323846264338327950288);
+}
+
+#ifndef BOOST_NO_CXX11_THREAD_LOCAL
+void test_threads()
+{
+    // Each thread has its own cache and counters
+    boost::charconv::reset_conversion_cache_stats();
+
+    std::size_t other_size = 1;
+    std::thread t([&other_size] {
+        char buffer[64];
+        boost::charconv::cached_to_chars(buffer, buffer + sizeof(buffer), 2.5);
+        other_size = boost::charconv::conversion_cache_size();
+        boost::charconv::set_conversion_cache_size(0);
+    });
+    t.join();
+
+    BOOST_TEST_EQ(other_size, boost::charconv::default_conversion_cache_size);
+    BOOST_TEST_EQ(boost::charconv::conversion_cache_size(), boost::charconv::default_conversion_cache_size);
+    BOOST_TEST_EQ(boost::charconv::get_conversion_cache_stats().to_chars_misses, 0U);
+}
+#endif
+
+int main()
+{
+    #ifndef BOOST_NO_CXX11_THREAD_LOCAL
+
+    BOOST_TEST_EQ(boost::charconv::conversion_cache_size(), boost::charconv::default_conversion_cache_size);
+
+    test_repeats();
+    test_collisions();
+    test_disabled();
+    test_errors();
+    test_threads();
+
+    #endif
+
+    return boost::report_errors();
+}
@@ -0,0 +1,96 @@
+// Copyright 2023 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/charconv/detail/dragonbox/dragonbox.hpp>
+#include <boost/charconv/detail/dragonbox/floff.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <random>
+#include <limits>
+#include <cstdint>
+#include <cstring>
+#include <cmath>
+
+static constexpr std::size_t N = 1024;
+
+using boost::charconv::detail::ieee754_binary32;
+using boost::charconv::detail::ieee754_binary64;
+using full = boost::charconv::detail::policy_impl::cache::full;
+using compact = boost::charconv::detail::policy_impl::cache::compact;
+
+// Every entry recovered from the compressed table is the one of the full table, or at most two more in the last bits
+void test_entries()
+{
+    using cache_holder = boost::charconv::detail::cache_holder_ieee754_binary64;
+
+    for (int k = cache_holder::min_k; k <= cache_holder::max_k; ++k)
+    {
+        const auto expected = full::get_cache<ieee754_binary64>(k);
+        const auto recovered = compact::get_cache<ieee754_binary64>(k);
+        BOOST_TEST_EQ(recovered.high, expected.high);
+        BOOST_TEST(recovered.low - expected.low <= 2);
+
+        // Entries that are stored are exact
+        if ((k - cache_holder::min_k) % boost::charconv::detail::compressed_cache_detail::compression_ratio == 0)
+        {
+            BOOST_TEST_EQ(recovered.low, expected.low);
+        }
+
+        // floff keeps its own copy of the full table
+        const auto floff_expected = boost::charconv::detail::main_cache_full::get_cache<ieee754_binary64>(k);
+        const auto floff_recovered = boost::charconv::detail::main_cache_compressed::get_cache<ieee754_binary64>(k);
+        BOOST_TEST_EQ(floff_expected.high, expected.high);
+        BOOST_TEST_EQ(floff_expected.low, expected.low);
+        BOOST_TEST_EQ(floff_recovered.high, recovered.high);
+        BOOST_TEST_EQ(floff_recovered.low, recovered.low);
+    }
+
+    using cache_holder32 = boost::charconv::detail::cache_holder_ieee754_binary32;
+
+    for (int k = cache_holder32::min_k; k <= cache_holder32::max_k; ++k)
+    {
+        BOOST_TEST_EQ(compact::get_cache<ieee754_binary32>(k), full::get_cache<ieee754_binary32>(k));
+    }
+}
+
+#ifndef BOOST_CHARCONV_NO_CXX14_RETURN_TYPE_DEDUCTION
+
+template <typename T>
+void test_to_decimal()
+{
+    using unsigned_type = typename std::conditional<sizeof(T) == 4, std::uint32_t, std::uint64_t>::type;
+
+    std::mt19937_64 gen(42);
+    std::uniform_int_distribution<unsigned_type> bits;
+
+    for (std::size_t i = 0; i < N * 64; ++i)
+    {
+        const auto b = bits(gen);
+        T v;
+        std::memcpy(&v, &b, sizeof(T));
+        if (!std::isfinite(v) || v == 0)
+        {
+            continue;
+        }
+
+        const auto expected = boost::charconv::detail::to_decimal(v, boost::charconv::detail::policy::cache::full);
+        const auto result = boost::charconv::detail::to_decimal(v, boost::charconv::detail::policy::cache::compact);
+        BOOST_TEST_EQ(result.significand, expected.significand);
+        BOOST_TEST_EQ(result.exponent, expected.exponent);
+        BOOST_TEST_EQ(result.is_negative, expected.is_negative);
+    }
+}
+
+#endif
+
+int main()
+{
+    test_entries();
+
+    #ifndef BOOST_CHARCONV_NO_CXX14_RETURN_TYPE_DEDUCTION
+    test_to_decimal<float>();
+    test_to_decimal<double>();
+    #endif
+
+    return boost::report_errors();
+}
@@ -0,0 +1,286 @@
+// Copyright 2023 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/charconv/format.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <string>
+#include <vector>
+#include <deque>
+#include <cstring>
+#include <iterator>
+#include <limits>
+
+// Minimal stand-ins for std::basic_format_parse_context and std::basic_format_context
+struct parse_context
+{
+    const char* first;
+    const char* last;
+
+    const char* begin() const noexcept { return first; }
+    const char* end() const noexcept { return last; }
+};
+
+template <typename OutputIt>
+struct format_context
+{
+    OutputIt it;
+
+    OutputIt out() const { return it; }
+    void advance_to(OutputIt new_it) { it = new_it; }
+};
+
+template <typename Container, typename T>
+std::string test_format_to(Container& c, const char* spec, T value)
+{
+    boost::charconv::formatter<T> f;
+    parse_context pctx {spec, spec + std::strlen(spec)};
+    const char* end = f.parse(pctx);
+    BOOST_TEST(end == pctx.last || *end == '}');
+
+    format_context<std::back_insert_iterator<Container>> fctx {std::back_inserter(c)};
+    f.format(value, fctx);
+
+    return std::string(c.begin(), c.end());
+}
+
+template <typename T>
+std::string test_format(const char* spec, T value)
+{
+    std::string str;
+    return test_format_to(str, spec, value);
+}
+
+template <typename T>
+void test_integers()
+{
+    BOOST_TEST_EQ(test_format("", T(42)), "42");
+    BOOST_TEST_EQ(test_format("}", T(42)), "42");
+    BOOST_TEST_EQ(test_format("5", T(42)), "   42");
+    BOOST_TEST_EQ(test_format("<5", T(42)), "42   ");
+    BOOST_TEST_EQ(test_format("^6", T(42)), "  42  ");
+    BOOST_TEST_EQ(test_format("*>5", T(42)), "***42");
+    BOOST_TEST_EQ(test_format("+", T(42)), "+42");
+    BOOST_TEST_EQ(test_format(" ", T(42)), " 42");
+    BOOST_TEST_EQ(test_format("05", T(42)), "00042");
+    BOOST_TEST_EQ(test_format("x", T(42)), "2a");
+    BOOST_TEST_EQ(test_format("X", T(42)), "2A");
+    BOOST_TEST_EQ(test_format("#x", T(42)), "0x2a");
+    BOOST_TEST_EQ(test_format("#010b", T(5)), "0b00000101");
+    BOOST_TEST_EQ(test_format("#o", T(8)), "010");
+    BOOST_TEST_EQ(test_format("#o", T(0)), "0");
+    BOOST_TEST_EQ(test_format("d", (std::numeric_limits<T>::max)()), std::to_string((std::numeric_limits<T>::max)()));
+
+    BOOST_IF_CONSTEXPR (std::is_signed<T>::value)
+    {
+        BOOST_TEST_EQ(test_format("", T(-42)), "-42");
+        BOOST_TEST_EQ(test_format("+", T(-42)), "-42");
+        BOOST_TEST_EQ(test_format("06", T(-42)), "-00042");
+        BOOST_TEST_EQ(test_format("#06x", T(-42)), "-0x02a");
+        BOOST_TEST_EQ(test_format("<6", T(-42)), "-42   ");
+        BOOST_TEST_EQ(test_format("d", (std::numeric_limits<T>::min)()), std::to_string((std::numeric_limits<T>::min)()));
+    }
+}
+
+template <typename T>
+void test_floats()
+{
+    BOOST_TEST_EQ(test_format("", T(1.5)), "1.5");
+    BOOST_TEST_EQ(test_format("", T(-1.5)), "-1.5");
+    BOOST_TEST_EQ(test_format("", T(0.1)), "0.1");
+    BOOST_TEST_EQ(test_format("", T(1e-5)), "1e-05");
+    BOOST_TEST_EQ(test_format("", T(0)), "0");
+    BOOST_TEST_EQ(test_format("", T(-0.0)), "-0");
+    BOOST_TEST_EQ(test_format("", T(1048576)), "1048576");
+    BOOST_TEST_EQ(test_format(">8.3f", T(2)), "   2.000");
+    BOOST_TEST_EQ(test_format("f", T(1.5)), "1.500000");
+    BOOST_TEST_EQ(test_format(".0f", T(2.5)), "2");
+    BOOST_TEST_EQ(test_format(".2f", T(0.125)), "0.12");
+    BOOST_TEST_EQ(test_format(".1f", T(0.0625)), "0.1");
+    BOOST_TEST_EQ(test_format(".1f", T(0.03125)), "0.0");
+    BOOST_TEST_EQ(test_format("F", T(1e10)), "10000000000.000000");
+    BOOST_TEST_EQ(test_format("g", T(1.5)), "1.5");
+    BOOST_TEST_EQ(test_format("g", T(1e-5)), "1e-05");
+    BOOST_TEST_EQ(test_format("g", T(0.0001)), "0.0001");
+    BOOST_TEST_EQ(test_format("g", T(100000)), "100000");
+    BOOST_TEST_EQ(test_format("g", T(1e6)), "1e+06");
+    BOOST_TEST_EQ(test_format(".3g", T(1234.5)), "1.23e+03");
+    BOOST_TEST_EQ(test_format(".0g", T(100)), "1e+02");
+    BOOST_TEST_EQ(test_format("G", T(1e-10)), "1E-10");
+    BOOST_TEST_EQ(test_format(".2", T(1234.5)), "1.2e+03");
+    BOOST_TEST_EQ(test_format(".6", T(0.5)), "0.5");
+    BOOST_TEST_EQ(test_format("8", T(1.5)), "     1.5");
+    BOOST_TEST_EQ(test_format("<8", T(1.5)), "1.5     ");
+    BOOST_TEST_EQ(test_format("^7", T(1.5)), "  1.5  ");
+    BOOST_TEST_EQ(test_format("+", T(1.5)), "+1.5");
+    BOOST_TEST_EQ(test_format("08", T(-1.5)), "-00001.5");
+    BOOST_TEST_EQ(test_format("e", T(1.5)), "1.500000e+00");
+    BOOST_TEST_EQ(test_format(".3E", T(1.5)), "1.500E+00");
+    BOOST_TEST_EQ(test_format("a", T(1.5)), "1.8p+0");
+    BOOST_TEST_EQ(test_format("A", T(-1.5)), "-1.8P+0");
+    BOOST_TEST_EQ(test_format(".3a", T(1.5)), "1.800p+0");
+    BOOST_TEST_EQ(test_format(".0a", T(1.5)), "2p+0");
+    BOOST_TEST_EQ(test_format(".0a", T(2.5)), "1p+1");
+    BOOST_TEST_EQ(test_format("a", T(0)), "0p+0");
+    BOOST_TEST_EQ(test_format(".2a", T(0)), "0.00p+0");
+    BOOST_TEST_EQ(test_format("e", T(0)), "0.000000e+00");
+    BOOST_TEST_EQ(test_format(".0e", T(2.5)), "2e+00");
+    BOOST_TEST_EQ(test_format("", std::numeric_limits<T>::infinity()), "inf");
+    BOOST_TEST_EQ(test_format("06", -std::numeric_limits<T>::infinity()), "  -inf");
+    BOOST_TEST_EQ(test_format("F", std::numeric_limits<T>::infinity()), "INF");
+    BOOST_TEST_EQ(test_format("+", std::numeric_limits<T>::quiet_NaN()), "+nan");
+
+    // Large precisions do not fit in the internal stack buffer
+    const std::string big = test_format(".300e", T(1.5));
+    BOOST_TEST_EQ(big.size(), 306U);
+    BOOST_TEST_EQ(big.substr(big.size() - 4), "e+00");
+    BOOST_TEST_EQ(test_format(">400.1e", T(1.5)).size(), 400U);
+    BOOST_TEST_EQ(test_format("^400.300e", T(1.5)).size(), 400U);
+
+    const std::string padded = test_format("*<320.300e", T(-1.5));
+    BOOST_TEST_EQ(padded.size(), 320U);
+    BOOST_TEST_EQ(padded.substr(0, 4), "-1.5");
+    BOOST_TEST_EQ(padded.substr(307), "*************");
+}
+
+// Values and precisions whose text differs between float and double
+void test_double_text()
+{
+    BOOST_TEST_EQ(test_format("", 1e22), "1e+22");
+    BOOST_TEST_EQ(test_format("", 1152921504606846976.0), "1152921504606846976");
+    BOOST_TEST_EQ(test_format("", 123456789012.0), "123456789012");
+    BOOST_TEST_EQ(test_format("", 5e-324), "5e-324");
+    BOOST_TEST_EQ(test_format("a", 0.1), "1.999999999999ap-4");
+    BOOST_TEST_EQ(test_format(".2a", 0.1), "1.9ap-4");
+    BOOST_TEST_EQ(test_format("a", 5e-324), "0.0000000000001p-1022");
+    BOOST_TEST_EQ(test_format(".20e", 0.1), "1.00000000000000005551e-01");
+    BOOST_TEST_EQ(test_format(".25f", 0.1), "0.1000000000000000055511151");
+    BOOST_TEST_EQ(test_format(".17g", 0.1), "0.10000000000000001");
+    BOOST_TEST_EQ(test_format(".3e", 5e-324), "4.941e-324");
+    BOOST_TEST_EQ(test_format("f", 1e300).size(), 308U);
+
+    BOOST_TEST_EQ(test_format("", 0.1f), "0.1");
+    BOOST_TEST_EQ(test_format("a", 0.1f), "1.99999ap-4");
+    BOOST_TEST_EQ(test_format(".0a", 1.1e-38f), "1p-126");
+    BOOST_TEST_EQ(test_format(".30e", 0.1f), "1.000000014901161193847656250000e-01");
+
+    BOOST_TEST_EQ(test_format("", 0.1L), "0.1");
+    BOOST_TEST_EQ(test_format(">8.3f", 2.0L), "   2.000");
+    BOOST_TEST_EQ(test_format(".3e", 1.5L), "1.500e+00");
+    BOOST_TEST_EQ(test_format("g", 1e-5L), "1e-05");
+    BOOST_TEST_EQ(test_format("", -std::numeric_limits<long double>::infinity()), "-inf");
+    #if BOOST_CHARCONV_LDBL_BITS == 80
+    BOOST_TEST_EQ(test_format("a", 1.5L), "cp-3");
+    BOOST_TEST_EQ(test_format(".2a", 0.1L), "c.cdp-7");
+    BOOST_TEST_EQ(test_format(".0a", (std::numeric_limits<long double>::max)()), "1p+16384");
+    #endif
+}
+
+// Back inserters into contiguous containers of char are written in place, the others through a copy
+struct derived_inserter : std::back_insert_iterator<std::string>
+{
+    explicit derived_inserter(std::string& str) : std::back_insert_iterator<std::string>(str) {}
+};
+
+void test_outputs()
+{
+    std::string str = "x=";
+    BOOST_TEST_EQ(test_format_to(str, "*^11.2f", -1.5), "x=***-1.50***");
+    BOOST_TEST_EQ(test_format_to(str, "+", 7), "x=***-1.50***+7");
+    BOOST_TEST_EQ(test_format_to(str, "#06x", 255), "x=***-1.50***+70x00ff");
+    BOOST_TEST_EQ(test_format_to(str, "010", -2.5), "x=***-1.50***+70x00ff-0000002.5");
+
+    std::vector<char> vec;
+    BOOST_TEST_EQ(test_format_to(vec, ">8.3e", 1.5), "1.500e+00");
+    BOOST_TEST_EQ(test_format_to(vec, " 5", 42), "1.500e+00   42");
+
+    std::deque<char> deq;
+    BOOST_TEST_EQ(test_format_to(deq, "^9", 1.5), "   1.5   ");
+    BOOST_TEST_EQ(test_format_to(deq, "#o", 8u), "   1.5   010");
+
+    std::string derived_str;
+    boost::charconv::formatter<double> f;
+    const char* spec = ">6";
+    parse_context pctx {spec, spec + 2};
+    f.parse(pctx);
+    format_context<derived_inserter> fctx {derived_inserter(derived_str)};
+    f.format(0.25, fctx);
+    BOOST_TEST_EQ(derived_str, "  0.25");
+}
+
+void test_errors()
+{
+    #ifndef BOOST_NO_EXCEPTIONS
+    boost::charconv::formatter<int> i;
+    boost::charconv::formatter<double> d;
+
+    const char* bad_int[] = {".2", "z", "L", "{}", "5x5"};
+    for (const char* spec : bad_int)
+    {
+        parse_context ctx {spec, spec + std::strlen(spec)};
+        BOOST_TEST_THROWS(i.parse(ctx), std::runtime_error);
+    }
+
+    const char* bad_float[] = {"#", "x", ".", ".f", "L"};
+    for (const char* spec : bad_float)
+    {
+        parse_context ctx {spec, spec + std::strlen(spec)};
+        BOOST_TEST_THROWS(d.parse(ctx), std::runtime_error);
+    }
+    #endif
+}
+
+#ifdef BOOST_CHARCONV_HAS_STD_FORMAT
+
+struct meters
+{
+    double value;
+};
+
+template <>
+struct std::formatter<meters> : boost::charconv::formatter<double>
+{
+    auto format(meters m, std::format_context& ctx) const
+    {
+        return boost::charconv::formatter<double>::format(m.value, ctx);
+    }
+};
+
+// The text is that of the std::formatter for double
+void test_std_format()
+{
+    BOOST_TEST_EQ(std::format("{}", meters{0.1}), std::format("{}", 0.1));
+    BOOST_TEST_EQ(std::format("{}", meters{2.5}), "2.5");
+    BOOST_TEST_EQ(std::format("[{:>8.3f}]", meters{2.0}), "[   2.000]");
+    BOOST_TEST_EQ(std::format("{:.3g}", meters{1234.5}), std::format("{:.3g}", 1234.5));
+    BOOST_TEST_EQ(std::format("[{:>10.3e}]", meters{1.5}), "[ 1.500e+00]");
+}
+
+#endif
+
+int main()
+{
+    test_integers<signed char>();
+    test_integers<unsigned char>();
+    test_integers<short>();
+    test_integers<unsigned short>();
+    test_integers<int>();
+    test_integers<unsigned>();
+    test_integers<long>();
+    test_integers<unsigned long>();
+    test_integers<long long>();
+    test_integers<unsigned long long>();
+
+    test_floats<float>();
+    test_floats<double>();
+
+    test_double_text();
+    test_outputs();
+    test_errors();
+
+    #ifdef BOOST_CHARCONV_HAS_STD_FORMAT
+    test_std_format();
+    #endif
+
+    return boost::report_errors();
+}
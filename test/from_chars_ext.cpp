@@ -0,0 +1,154 @@
+// Copyright 2023 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/charconv.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <system_error>
+#include <random>
+#include <limits>
+#include <string>
+#include <cstring>
+#include <cstdint>
+#include <cmath>
+#include <iostream>
+
+static constexpr std::size_t N = 1024;
+
+template <typename T>
+void check(const std::string& str, std::size_t digits, std::int64_t exponent, bool exact,
+           boost::charconv::chars_format fmt = boost::charconv::chars_format::general)
+{
+    T expected {};
+    T value {};
+    const auto r1 = boost::charconv::from_chars(str.data(), str.data() + str.size(), expected, fmt);
+    const auto r2 = boost::charconv::from_chars_ext(str.data(), str.data() + str.size(), value, fmt);
+
+    // The value and the plain result are always the same as from_chars
+    BOOST_TEST(r1 == static_cast<boost::charconv::from_chars_result>(r2));
+    BOOST_TEST(std::memcmp(&expected, &value, sizeof(T)) == 0);
+
+    if (!(BOOST_TEST_EQ(r2.digits, digits) && BOOST_TEST_EQ(r2.exponent, exponent) && BOOST_TEST_EQ(r2.exact, exact)))
+    {
+        std::cerr << "Input: " << str << std::endl; // LCOV_EXCL_LINE
+    }
+}
+
+template <typename T>
+void test_spot_values()
+{
+    check<T>("0", 0, 0, true);
+    check<T>("-0.000", 0, 0, true);
+    check<T>("1", 1, 0, true);
+    check<T>("1.500", 2, -1, true);
+    check<T>("-0.125", 3, -3, true);
+    check<T>("0.1", 1, -1, false);
+    check<T>("1200", 2, 2, true);
+    check<T>("12e3", 2, 3, true);
+    check<T>("0.0625e2", 3, -2, true);
+    check<T>("1.3e-1", 2, -2, false);
+    check<T>("00012.3400", 4, -2, false);
+    check<T>("1e25", 1, 25, false);
+    check<T>("1e400", 1, 400, false);
+    check<T>("inf", 0, 0, true);
+    check<T>("nan", 0, 0, true);
+    check<T>("x", 0, 0, false);
+    check<T>("", 0, 0, false);
+    check<T>("1.5abc", 2, -1, true);
+
+    // Integers are exact as long as their odd part fits into the significand
+    check<T>("16777216", 8, 0, true);
+    check<T>("16777217", 8, 0, std::is_same<T, double>::value);
+    check<T>("33554432", 8, 0, true);
+
+    // More than 19 digits
+    check<T>("0.50000000000000000000000000000", 1, -1, true);
+    check<T>("1180591620717411303424", 22, 0, true); // 2^70
+    check<T>("1180591620717411303425", 22, 0, false);
+    check<T>("0.000000000000000000867361737988403547205962240695953369140625", 42, -60, true); // 2^-60
+    check<T>("0.000000000000000000867361737988403547205962240695953369140626", 42, -60, false);
+    check<T>("12345678901234567890123", 23, 0, false);
+    check<T>("123456789012345678901230000e-4", 23, 0, false);
+    check<T>("0.100000001490116119384765625", 27, -27, true); // The float nearest to 0.1
+    check<T>("0.100000001490116119384765624", 27, -27, false);
+}
+
+void test_double_spot_values()
+{
+    check<double>("9007199254740993", 16, 0, false); // 2^53 + 1
+    check<double>("9007199254740992", 16, 0, true);
+    check<double>("0.1000000000000000055511151231257827021181583404541015625", 55, -55, true);
+    check<double>("0.018973670899868011474609375", 26, -27, true);
+    check<double>("0.018973670899868011474609376", 26, -27, false);
+    check<double>("-189736708998680114746093.75e-25", 26, -27, true);
+    check<double>("1e22", 1, 22, true);
+    check<double>("1e23", 1, 23, false);
+
+    // The smallest subnormal has 751 significant digits
+    char buffer[1200];
+    const auto r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), std::numeric_limits<double>::denorm_min(),
+                                             boost::charconv::chars_format::scientific, 750);
+    BOOST_TEST(r.ec == std::errc());
+    check<double>(std::string(buffer, r.ptr), 751, -1074, true);
+}
+
+// Values printed with enough digits to be exact are reported as exact, and shorter ones are not
+template <typename T>
+void test_random()
+{
+    std::mt19937_64 gen(42);
+    std::uniform_int_distribution<std::uint32_t> dist;
+
+    for (std::size_t i = 0; i < N; ++i)
+    {
+        // Dyadic rationals with few bits are exact, and num / 2^shift has exactly the digits of num * 5^shift
+        const std::uint64_t num = dist(gen) & 0xFFFF;
+        const int shift = static_cast<int>(i % 20);
+        const T v = std::ldexp(static_cast<T>(num), -shift);
+
+        std::uint64_t scaled = num;
+        for (int j = 0; j < shift; ++j)
+        {
+            scaled *= 5;
+        }
+        std::string digits = std::to_string(scaled);
+        if (digits.size() <= static_cast<std::size_t>(shift))
+        {
+            digits.insert(0, static_cast<std::size_t>(shift) + 1 - digits.size(), '0');
+        }
+        if (shift != 0)
+        {
+            digits.insert(digits.size() - static_cast<std::size_t>(shift), 1, '.');
+        }
+        T value {};
+        const auto r2 = boost::charconv::from_chars_ext(digits.data(), digits.data() + digits.size(), value);
+        BOOST_TEST(r2.ec == std::errc());
+        BOOST_TEST_EQ(value, v);
+        if (!BOOST_TEST(r2.exact))
+        {
+            std::cerr << "Input: " << digits << std::endl; // LCOV_EXCL_LINE
+        }
+
+        // Perturbing the last digit makes it inexact
+        if (shift != 0)
+        {
+            const std::string str = digits + '1';
+            const auto r3 = boost::charconv::from_chars_ext(str.data(), str.data() + str.size(), value);
+            BOOST_TEST(r3.ec == std::errc());
+            BOOST_TEST(!r3.exact);
+            BOOST_TEST_EQ(r3.exponent, -(shift + 1));
+        }
+    }
+}
+
+int main()
+{
+    test_spot_values<float>();
+    test_spot_values<double>();
+    test_double_spot_values();
+
+    test_random<float>();
+    test_random<double>();
+
+    return boost::report_errors();
+}
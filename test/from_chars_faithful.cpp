@@ -0,0 +1,132 @@
+// Copyright 2023 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/charconv.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <system_error>
+#include <random>
+#include <limits>
+#include <string>
+#include <cstring>
+#include <cstdint>
+#include <cmath>
+#include <iostream>
+
+static constexpr std::size_t N = 1024;
+
+// The faithful result has to be the correctly rounded one or one of its neighbours
+template <typename T>
+void check(const std::string& str, boost::charconv::chars_format fmt = boost::charconv::chars_format::general)
+{
+    T expected {};
+    T value {};
+    const auto r1 = boost::charconv::from_chars(str.data(), str.data() + str.size(), expected, fmt);
+    const auto r2 = boost::charconv::from_chars_faithful(str.data(), str.data() + str.size(), value, fmt);
+
+    BOOST_TEST(r1.ptr == r2.ptr);
+
+    if (r1.ec == std::errc() && r2.ec == std::errc())
+    {
+        const bool close = std::memcmp(&expected, &value, sizeof(T)) == 0 ||
+                           value == std::nextafter(expected, std::numeric_limits<T>::infinity()) ||
+                           value == std::nextafter(expected, -std::numeric_limits<T>::infinity());
+        if (!BOOST_TEST(close))
+        {
+            std::cerr << "Input: " << str << std::endl; // LCOV_EXCL_LINE
+        }
+    }
+    else
+    {
+        // Inputs at the edge of the range may round either way, everything else fails the same way
+        BOOST_TEST(r1.ec == r2.ec || (r1.ec != std::errc::invalid_argument && r2.ec != std::errc::invalid_argument));
+    }
+}
+
+template <typename T>
+void test_spot_values()
+{
+    const char* inputs[] = {"0", "-0", "1", "1.5", "0.1", "-123.456e7", "inf", "nan", "", "x", "1e", "1e400", "1e-400",
+                            "9007199254740993", "9007199254740992.9999999999999999999999999",
+                            "9007199254740993.0000000000000000000000001", "16777217", "16777217.000000000000000000001",
+                            "2.4703282292062327208828439643411068618252990130716238221279284125033775364e-324",
+                            "1.4012984643248170709237295832899161312802619418765157717570682838897910826858e-45",
+                            "179769313486231580793728971405301e276", "3.4028235677973366e38",
+                            "7.0064923216240854e-46", "1.7976931348623158e308",
+                            "0.100000000000000005551115123125782702118158340454101562500000000000000001"};
+
+    for (const char* str : inputs)
+    {
+        check<T>(str);
+        check<T>(str, boost::charconv::chars_format::scientific);
+        check<T>(str, boost::charconv::chars_format::fixed);
+        check<T>(str, boost::charconv::chars_format::hex);
+    }
+}
+
+// Halfway points between adjacent floats, with and without extra digits after them,
+// are exactly the inputs that need the slow path in from_chars
+template <typename T>
+void test_halfway()
+{
+    std::mt19937_64 gen(42);
+    std::uniform_real_distribution<T> dist(0, 1);
+
+    for (std::size_t i = 0; i < N; ++i)
+    {
+        const T v = dist(gen) * static_cast<T>(std::pow(10, static_cast<int>(i % 60) - 30));
+        const T next = std::nextafter(v, std::numeric_limits<T>::infinity());
+
+        // Print the midpoint with plenty of digits
+        const long double mid = (static_cast<long double>(v) + static_cast<long double>(next)) / 2;
+        char buffer[256];
+        const auto r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), mid, boost::charconv::chars_format::scientific, 40);
+        BOOST_TEST(r.ec == std::errc());
+
+        const std::string str(buffer, r.ptr);
+        check<T>(str);
+    }
+}
+
+template <typename T>
+void test_random_digits()
+{
+    std::mt19937_64 gen(42);
+    std::uniform_int_distribution<int> digit(0, 9);
+    std::uniform_int_distribution<int> length(1, 40);
+    std::uniform_int_distribution<int> exponent(-350, 350);
+
+    for (std::size_t i = 0; i < N; ++i)
+    {
+        std::string str;
+        const int n = length(gen);
+        for (int j = 0; j < n; ++j)
+        {
+            str += static_cast<char>('0' + digit(gen));
+            if (j == 0)
+            {
+                str += '.';
+            }
+        }
+        str += 'e';
+        str += std::to_string(exponent(gen));
+
+        check<T>(str);
+    }
+}
+
+int main()
+{
+    test_spot_values<float>();
+    test_spot_values<double>();
+
+    test_halfway<float>();
+    #if BOOST_CHARCONV_LDBL_BITS > 64
+    test_halfway<double>();
+    #endif
+
+    test_random_digits<float>();
+    test_random_digits<double>();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,188 @@
+// Copyright 2023 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/charconv.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <system_error>
+#include <random>
+#include <vector>
+#include <string>
+#include <cstring>
+#include <cstdint>
+#include <cstdio>
+#include <iostream>
+
+static constexpr std::size_t N = 1024;
+
+// Parses the records one at a time with from_chars and compares the bytes of every value
+template <typename T>
+void check(const std::string& buffer, std::size_t width, std::size_t stride, std::size_t count)
+{
+    std::vector<T> values(count);
+    const auto r = boost::charconv::from_chars_fixed_width(buffer.data(), width, stride, values.data(), count);
+    BOOST_TEST(r.ec == std::errc());
+    BOOST_TEST(r.ptr == buffer.data() + (count - 1) * stride + width);
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        const char* first = buffer.data() + i * stride;
+        const char* last = first + width;
+        while (*first == ' ')
+        {
+            ++first;
+        }
+        if (*first == '+')
+        {
+            ++first;
+        }
+
+        T expected {};
+        const auto r2 = boost::charconv::from_chars(first, last, expected);
+        BOOST_TEST(r2.ec == std::errc());
+        BOOST_TEST(r2.ptr == last);
+
+        if (!BOOST_TEST(std::memcmp(&expected, &values[i], sizeof(T)) == 0))
+        {
+            std::cerr << "Input: " << std::string(buffer.data() + i * stride, width) << std::endl; // LCOV_EXCL_LINE
+        }
+    }
+}
+
+// Random records of the given layout, separated by newlines
+template <typename T>
+void test_layout(int integer_digits, int fraction_digits, bool sign_column)
+{
+    std::mt19937_64 gen(42);
+    std::uniform_int_distribution<int> digit(0, 9);
+    std::uniform_int_distribution<int> sign(0, 2);
+
+    const std::size_t width = static_cast<std::size_t>(sign_column + integer_digits + (fraction_digits != 0) + fraction_digits);
+    const std::size_t stride = width + 1;
+
+    std::string buffer;
+    for (std::size_t i = 0; i < N; ++i)
+    {
+        if (sign_column)
+        {
+            buffer += "-+ "[sign(gen)];
+        }
+        for (int j = 0; j < integer_digits; ++j)
+        {
+            buffer += static_cast<char>('0' + digit(gen));
+        }
+        if (fraction_digits != 0)
+        {
+            buffer += '.';
+        }
+        for (int j = 0; j < fraction_digits; ++j)
+        {
+            buffer += static_cast<char>('0' + digit(gen));
+        }
+        buffer += '\n';
+    }
+
+    for (std::size_t count = 1; count <= N; count += 97)
+    {
+        check<T>(buffer, width, stride, count);
+    }
+}
+
+template <typename T>
+void test_layouts()
+{
+    for (int integer_digits = 0; integer_digits <= 12; ++integer_digits)
+    {
+        for (int fraction_digits = 0; fraction_digits <= 12; ++fraction_digits)
+        {
+            if (integer_digits + fraction_digits != 0)
+            {
+                test_layout<T>(integer_digits, fraction_digits, false);
+                test_layout<T>(integer_digits, fraction_digits, true);
+            }
+        }
+    }
+
+    // Too many digits for the fast path
+    test_layout<T>(10, 10, true);
+    test_layout<T>(25, 5, false);
+}
+
+template <typename T>
+void test_mixed_layouts()
+{
+    // Records that do not match the layout of the first one go through from_chars
+    const std::string buffer = "-012.500\n   1.250\n+1.25e+2\n  -0.125\n-000.000\n 000.000\n     inf\n1234.567\n";
+    check<T>(buffer, 8, 9, 8);
+
+    // Layouts that are not fixed notation at all
+    const std::string scientific = "1.5e+10 2.5e-10 3.0e+00 ";
+    check<T>(scientific, 7, 8, 3);
+
+    const std::string spaces = "   12\n    3\n  456\n";
+    check<T>(spaces, 5, 6, 3);
+
+    // Mismatches inside blocks that are decoded in vector lanes
+    std::string block;
+    for (int i = 0; i < 64; ++i)
+    {
+        block += "-012.500\n";
+    }
+    const char* const replacements[] = {"   1.250", "+1.25e+2", "  -0.125", "     inf", "1234.567", "-01.2500", " 099.999", "+000.001"};
+    for (std::size_t i = 0; i < sizeof(replacements) / sizeof(replacements[0]); ++i)
+    {
+        block.replace((3 + 7 * i) * 9, 8, replacements[i]);
+    }
+    check<T>(block, 8, 9, 64);
+}
+
+template <typename T>
+void test_errors()
+{
+    T values[4] {};
+
+    const char* buffer = "1.50|2.50|2x50|3.50|";
+    auto r = boost::charconv::from_chars_fixed_width(buffer, 4, 5, values, 4);
+    BOOST_TEST(r.ec == std::errc::invalid_argument);
+    BOOST_TEST(r.ptr == buffer + 11);
+    BOOST_TEST_EQ(values[0], static_cast<T>(1.5));
+    BOOST_TEST_EQ(values[1], static_cast<T>(2.5));
+
+    // An error in the middle of a longer batch
+    std::string many;
+    for (int i = 0; i < 32; ++i)
+    {
+        many += i == 19 ? "2x50|" : "1.50|";
+    }
+    T more[32] {};
+    r = boost::charconv::from_chars_fixed_width(many.data(), 4, 5, more, 32);
+    BOOST_TEST(r.ec == std::errc::invalid_argument);
+    BOOST_TEST(r.ptr == many.data() + 19 * 5 + 1);
+    BOOST_TEST_EQ(more[18], static_cast<T>(1.5));
+
+    const char* empty = "    |";
+    r = boost::charconv::from_chars_fixed_width(empty, 4, 5, values, 1);
+    BOOST_TEST(r.ec == std::errc::invalid_argument);
+
+    r = boost::charconv::from_chars_fixed_width(buffer, 4, 5, values, 0);
+    BOOST_TEST(r.ec == std::errc());
+    BOOST_TEST(r.ptr == buffer);
+
+    const char* huge = "1e999|";
+    r = boost::charconv::from_chars_fixed_width(huge, 5, 6, values, 1);
+    BOOST_TEST(r.ec == std::errc::result_out_of_range);
+}
+
+int main()
+{
+    test_layouts<float>();
+    test_layouts<double>();
+
+    test_mixed_layouts<float>();
+    test_mixed_layouts<double>();
+
+    test_errors<float>();
+    test_errors<double>();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,224 @@
+// Copyright 2023 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/charconv.hpp>
+#include <boost/charconv/detail/from_chars_integer_impl.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <system_error>
+#include <iostream>
+#include <random>
+#include <string>
+#include <cstring>
+#include <cstdint>
+
+// The chunked base 10 path is compared against the digit at a time loop, which is still used for the other bases
+
+static std::string random_digits(std::mt19937_64& gen, std::size_t n)
+{
+    std::string str;
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        str += static_cast<char>('0' + gen() % 10);
+    }
+    return str;
+}
+
+static std::string random_input(std::mt19937_64& gen)
+{
+    std::string str;
+
+    switch (gen() % 8)
+    {
+        case 0:
+            str += '-';
+            break;
+        case 1:
+            str += '+';
+            break;
+        case 2:
+            str += std::string(gen() % 40, '0');
+            break;
+        default:
+            break;
+    }
+
+    // Lengths around the chunk boundaries and the limits of 128 bits
+    str += random_digits(gen, gen() % 45);
+
+    switch (gen() % 4)
+    {
+        case 0:
+            str += 'x';
+            break;
+        case 1:
+            str += random_digits(gen, 3);
+            break;
+        default:
+            break;
+    }
+
+    return str;
+}
+
+static const char* const edge_cases[] = {
+    "", "-", "+", "-0", "0", "00000000000000000000000000000000000000000000000000000001",
+    "9999999999999999999", "10000000000000000000", "18446744073709551615", "18446744073709551616",
+    "999999999999999999999999999999999999999", "9999999999999999999999999999999999999999",
+    "170141183460469231731687303715884105727", "170141183460469231731687303715884105728",
+    "-170141183460469231731687303715884105728", "-170141183460469231731687303715884105729",
+    "340282366920938463463374607431768211455", "340282366920938463463374607431768211456",
+    "340282366920938463463374607431768211455x", "3402823669209384634633746074317682114550000", "abc"
+};
+
+#ifdef BOOST_CHARCONV_HAS_INT128
+
+template <typename T>
+static boost::charconv::from_chars_result reference(const std::string& str, T& value, int base)
+{
+    return boost::charconv::detail::from_chars_integer_impl<T, boost::uint128_type>(str.data(), str.data() + str.size(), value, base);
+}
+
+// The digit at a time loop doubles its limit for int128 so that INT128_MIN can be parsed in every base,
+// which lets base 10 values up to 2^128 - 1 through, so the signed reference checks the magnitude itself
+static boost::charconv::from_chars_result reference(const std::string& str, boost::int128_type& value, int base)
+{
+    if (base != 10)
+    {
+        return boost::charconv::detail::from_chars_integer_impl<boost::int128_type, boost::uint128_type>(str.data(), str.data() + str.size(), value, base);
+    }
+
+    const bool is_negative = !str.empty() && str[0] == '-';
+    const std::size_t offset = is_negative ? 1 : 0;
+    if (str.size() == offset)
+    {
+        return {str.data(), std::errc::invalid_argument};
+    }
+
+    boost::uint128_type magnitude = 0;
+    auto r = boost::charconv::detail::from_chars_integer_impl<boost::uint128_type, boost::uint128_type>(str.data() + offset, str.data() + str.size(), magnitude, base);
+    if (r.ec == std::errc::invalid_argument)
+    {
+        r.ptr = str.data();
+        return r;
+    }
+    if (r.ec != std::errc())
+    {
+        return r;
+    }
+
+    const auto limit = static_cast<boost::uint128_type>(BOOST_CHARCONV_INT128_MAX) + (is_negative ? 1 : 0);
+    if (magnitude > limit)
+    {
+        return {r.ptr, std::errc::result_out_of_range};
+    }
+
+    value = static_cast<boost::int128_type>(is_negative ? -magnitude : magnitude);
+    return r;
+}
+
+template <typename T>
+static bool same_result(const std::string& str, int base)
+{
+    T v1 = 42;
+    T v2 = 42;
+    const auto r1 = boost::charconv::detail::from_chars_integer128_impl<T, boost::uint128_type>(str.data(), str.data() + str.size(), v1, base);
+    const auto r2 = reference(str, v2, base);
+
+    return r1.ptr == r2.ptr && r1.ec == r2.ec && v1 == v2;
+}
+
+template <typename T>
+void test_against_reference()
+{
+    for (const char* str : edge_cases)
+    {
+        if (!BOOST_TEST(same_result<T>(str, 10)))
+        {
+            std::cerr << "Input: " << str << std::endl; // LCOV_EXCL_LINE
+        }
+    }
+
+    std::mt19937_64 gen(42);
+    for (int i = 0; i < 100000; ++i)
+    {
+        const std::string str = random_input(gen);
+        if (!BOOST_TEST(same_result<T>(str, 10)))
+        {
+            std::cerr << "Input: " << str << std::endl; // LCOV_EXCL_LINE
+        }
+    }
+
+    // Other bases are unchanged
+    BOOST_TEST(same_result<T>("7fffffffffffffffffffffffffffffff", 16));
+    BOOST_TEST(same_result<T>("-1010101010101010101010101010101010101010101010101010101010101010101", 2));
+}
+
+template <typename T>
+void test_public_api()
+{
+    const char* str = "123456789012345678901234567890123456789";
+    T value = 0;
+    const auto r = boost::charconv::from_chars(str, str + std::strlen(str), value);
+    BOOST_TEST(r.ec == std::errc());
+    BOOST_TEST(r.ptr == str + std::strlen(str));
+
+    T expected = 0;
+    for (const char* p = str; *p != '\0'; ++p)
+    {
+        expected = expected * 10 + static_cast<T>(*p - '0');
+    }
+    BOOST_TEST(value == expected);
+}
+
+#endif // BOOST_CHARCONV_HAS_INT128
+
+// The emulated type has no from_chars overload of its own and is only reached through from_chars128
+void test_emulated()
+{
+    using boost::charconv::detail::uint128;
+
+    for (const char* str : edge_cases)
+    {
+        const std::string s = str;
+
+        uint128 v1 = 42;
+        uint128 v2 = 42;
+        const auto r1 = boost::charconv::detail::from_chars128(s.data(), s.data() + s.size(), v1);
+        const auto r2 = boost::charconv::detail::from_chars_integer_impl<uint128, uint128>(s.data(), s.data() + s.size(), v2, 10);
+
+        BOOST_TEST(r1.ptr == r2.ptr);
+        BOOST_TEST(r1.ec == r2.ec);
+        BOOST_TEST(v1.high == v2.high && v1.low == v2.low);
+    }
+
+    std::mt19937_64 gen(7);
+    for (int i = 0; i < 10000; ++i)
+    {
+        const std::string s = random_input(gen);
+
+        uint128 v1 = 42;
+        uint128 v2 = 42;
+        const auto r1 = boost::charconv::detail::from_chars128(s.data(), s.data() + s.size(), v1);
+        const auto r2 = boost::charconv::detail::from_chars_integer_impl<uint128, uint128>(s.data(), s.data() + s.size(), v2, 10);
+
+        if (!BOOST_TEST(r1.ptr == r2.ptr && r1.ec == r2.ec && v1.high == v2.high && v1.low == v2.low))
+        {
+            std::cerr << "Input: " << s << std::endl; // LCOV_EXCL_LINE
+        }
+    }
+}
+
+int main()
+{
+    #ifdef BOOST_CHARCONV_HAS_INT128
+    test_against_reference<boost::int128_type>();
+    test_against_reference<boost::uint128_type>();
+    test_public_api<boost::int128_type>();
+    test_public_api<boost::uint128_type>();
+    #endif
+
+    test_emulated();
+
+    return boost::report_errors();
+}
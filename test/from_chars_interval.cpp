@@ -0,0 +1,259 @@
+// Copyright 2023 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/charconv.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <system_error>
+#include <random>
+#include <limits>
+#include <string>
+#include <cstring>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cmath>
+#include <iostream>
+
+static constexpr std::size_t N = 1024;
+
+template <typename T>
+void check_interval(const std::string& str, T expected_lo, T expected_hi)
+{
+    T lo {};
+    T hi {};
+    const auto r = boost::charconv::from_chars_interval(str.data(), str.data() + str.size(), lo, hi);
+    BOOST_TEST(r.ptr == str.data() + str.size());
+    if (!BOOST_TEST(lo == expected_lo && hi == expected_hi && std::signbit(lo) == std::signbit(expected_lo)))
+    {
+        std::cerr << "Input: " << str << std::endl; // LCOV_EXCL_LINE
+    }
+}
+
+// The bounds have to contain the correctly rounded value, and be equal exactly when it is the number in the text
+template <typename T>
+void check(const std::string& str)
+{
+    T lo {};
+    T hi {};
+    T value {};
+    const auto r1 = boost::charconv::from_chars_interval(str.data(), str.data() + str.size(), lo, hi);
+    const auto r2 = boost::charconv::from_chars_ext(str.data(), str.data() + str.size(), value);
+
+    BOOST_TEST(r1.ptr == r2.ptr);
+    if (r1.ec != std::errc() || r2.ec != std::errc())
+    {
+        // Near the ends of the range the rounded value may still be finite and non-zero
+        BOOST_TEST(value == lo || value == hi);
+        return;
+    }
+
+    const bool valid = (value == lo || value == hi) &&
+                       (hi == lo || hi == std::nextafter(lo, std::numeric_limits<T>::infinity())) &&
+                       ((hi == lo) == r2.exact);
+
+    // Any rounding to a wider type keeps the number between the bounds
+    const long double wide = std::strtold(str.c_str(), nullptr);
+    if (!BOOST_TEST(valid && static_cast<long double>(lo) <= wide && wide <= static_cast<long double>(hi)))
+    {
+        std::cerr << "Input: " << str << std::endl; // LCOV_EXCL_LINE
+    }
+}
+
+// The exact decimal expansion of a float, e.g. "1.25e-01"
+template <typename T>
+std::string exact_digits(T value)
+{
+    char buffer[1024];
+    std::snprintf(buffer, sizeof(buffer), "%.*e", 800, static_cast<double>(value));
+    std::string str(buffer);
+    const auto e = str.find('e');
+    std::string digits = str.substr(0, e);
+    while (digits.back() == '0')
+    {
+        digits.pop_back();
+    }
+    if (digits.back() == '.')
+    {
+        digits.pop_back();
+    }
+    return digits + "|" + str.substr(e);
+}
+
+// A positive float written exactly, and a hair above and below it
+template <typename T>
+void check_neighbours(T value)
+{
+    const std::string exact = exact_digits(value);
+    const auto bar = exact.find('|');
+    std::string digits = exact.substr(0, bar);
+    if (digits.find('.') == std::string::npos)
+    {
+        digits += ".";
+    }
+
+    // Far enough below the last digit to stay inside the gap to the next float
+    digits.append(30, '0');
+    const std::string exponent = exact.substr(bar + 1);
+
+    const T up = std::nextafter(value, std::numeric_limits<T>::infinity());
+    const T down = std::nextafter(value, -std::numeric_limits<T>::infinity());
+
+    check_interval<T>(digits + exponent, value, value);
+    check_interval<T>(digits + "1" + exponent, value, up);
+
+    // Lower the last digit, which borrows through the zeros, and append a nine
+    std::size_t i = digits.size() - 1;
+    while (digits[i] == '0' || digits[i] == '.')
+    {
+        if (digits[i] == '0')
+        {
+            digits[i] = '9';
+        }
+        --i;
+    }
+    --digits[i];
+    check_interval<T>(digits + "9" + exponent, down, value);
+}
+
+void test_spot_values()
+{
+    const double denorm_min = std::numeric_limits<double>::denorm_min();
+    const double max = (std::numeric_limits<double>::max)();
+    const double inf = std::numeric_limits<double>::infinity();
+
+    check_interval<double>("1", 1.0, 1.0);
+    check_interval<double>("12.5", 12.5, 12.5);
+    check_interval<double>("-0.375", -0.375, -0.375);
+    check_interval<double>("0.1", std::nextafter(0.1, 0.0), 0.1);
+    check_interval<double>("-0.1", -0.1, -std::nextafter(0.1, 0.0));
+    check_interval<double>("0.3", 0.3, std::nextafter(0.3, 1.0));
+    check_interval<double>("0", 0.0, 0.0);
+    check_interval<double>("-0", -0.0, -0.0);
+    check_interval<double>("9007199254740993", 9007199254740992.0, 9007199254740994.0);
+    check_interval<double>("0.1000000000000000055511151231257827021181583404541015625", 0.1, 0.1);
+    check_interval<double>("0.10000000000000000555111512312578270211815834045410156250000000000000000001", 0.1, std::nextafter(0.1, 1.0));
+    check_interval<double>("0.10000000000000000555111512312578270211815834045410156249999999999999999999", std::nextafter(0.1, 0.0), 0.1);
+    check_interval<float>("0.1", std::nextafter(0.1F, 0.0F), 0.1F);
+    check_interval<float>("16777217", 16777216.0F, 16777218.0F);
+
+    // Out of range
+    double lo;
+    double hi;
+    const char* str = "1e400";
+    auto r = boost::charconv::from_chars_interval(str, str + std::strlen(str), lo, hi);
+    BOOST_TEST(r.ec == std::errc::result_out_of_range);
+    BOOST_TEST(lo == max && hi == inf);
+
+    str = "-1.8e308";
+    r = boost::charconv::from_chars_interval(str, str + std::strlen(str), lo, hi);
+    BOOST_TEST(r.ec == std::errc::result_out_of_range);
+    BOOST_TEST(lo == -inf && hi == -max);
+
+    str = "1e-400";
+    r = boost::charconv::from_chars_interval(str, str + std::strlen(str), lo, hi);
+    BOOST_TEST(r.ec == std::errc::result_out_of_range);
+    BOOST_TEST(lo == 0 && hi == denorm_min);
+
+    str = "3e-324";
+    r = boost::charconv::from_chars_interval(str, str + std::strlen(str), lo, hi);
+    BOOST_TEST(r.ec == std::errc::result_out_of_range);
+    BOOST_TEST(lo == 0 && hi == denorm_min);
+
+    str = "1.7976931348623157e308";
+    r = boost::charconv::from_chars_interval(str, str + std::strlen(str), lo, hi);
+    BOOST_TEST(r.ec == std::errc());
+    BOOST_TEST(lo == std::nextafter(max, 0.0) && hi == max);
+
+    // Infinities and NaNs
+    str = "-inf";
+    r = boost::charconv::from_chars_interval(str, str + std::strlen(str), lo, hi);
+    BOOST_TEST(r.ec == std::errc());
+    BOOST_TEST(lo == -inf && hi == -inf);
+
+    str = "nan";
+    r = boost::charconv::from_chars_interval(str, str + std::strlen(str), lo, hi);
+    BOOST_TEST(r.ec == std::errc());
+    BOOST_TEST(std::isnan(lo) && std::isnan(hi));
+
+    // Hexadecimal only brackets the rounded value
+    str = "1.8p0";
+    double value;
+    boost::charconv::from_chars(str, str + std::strlen(str), value, boost::charconv::chars_format::hex);
+    r = boost::charconv::from_chars_interval(str, str + std::strlen(str), lo, hi, boost::charconv::chars_format::hex);
+    BOOST_TEST(r.ec == std::errc());
+    BOOST_TEST(lo == std::nextafter(value, -inf) && hi == std::nextafter(value, inf));
+
+    // Not a number, the bounds are left alone
+    lo = 2;
+    hi = 3;
+    str = "x1";
+    r = boost::charconv::from_chars_interval(str, str + std::strlen(str), lo, hi);
+    BOOST_TEST(r.ec == std::errc::invalid_argument);
+    BOOST_TEST(r.ptr == str);
+    BOOST_TEST(lo == 2 && hi == 3);
+
+    // Only the number is matched
+    str = "2.5e-1xyz";
+    r = boost::charconv::from_chars_interval(str, str + std::strlen(str), lo, hi);
+    BOOST_TEST(r.ec == std::errc());
+    BOOST_TEST(r.ptr == str + 6);
+    BOOST_TEST(lo == 0.25 && hi == 0.25);
+}
+
+template <typename T>
+void test_random()
+{
+    using unsigned_type = typename std::conditional<sizeof(T) == 4, std::uint32_t, std::uint64_t>::type;
+
+    std::mt19937_64 gen(42);
+    std::uniform_int_distribution<unsigned_type> bits;
+    constexpr int max_digits = std::numeric_limits<T>::max_digits10;
+
+    for (std::size_t i = 0; i < N * 16; ++i)
+    {
+        const auto b = bits(gen);
+        T v;
+        std::memcpy(&v, &b, sizeof(T));
+        if (!std::isfinite(v))
+        {
+            continue;
+        }
+
+        char buffer[64];
+        std::snprintf(buffer, sizeof(buffer), "%.*g", static_cast<int>(i % (max_digits + 3)) + 1, static_cast<double>(v));
+        check<T>(buffer);
+
+        if (i % 16 == 0 && v != 0)
+        {
+            check_neighbours(std::fabs(v));
+        }
+    }
+
+    // Short decimals like prices, which are often exact
+    for (std::size_t i = 0; i < N * 4; ++i)
+    {
+        char buffer[64];
+        std::snprintf(buffer, sizeof(buffer), "%u.%02u", static_cast<unsigned>(gen() % 100000), static_cast<unsigned>(gen() % 100));
+        check<T>(buffer);
+    }
+
+    // Subnormals
+    for (std::size_t i = 0; i < N; ++i)
+    {
+        const T v = std::numeric_limits<T>::denorm_min() * static_cast<T>(gen() % 100000);
+        if (v != 0)
+        {
+            check_neighbours(v);
+        }
+    }
+}
+
+int main()
+{
+    test_spot_values();
+    test_random<float>();
+    test_random<double>();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,144 @@
+// Copyright 2023 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/charconv.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <system_error>
+#include <random>
+#include <limits>
+#include <string>
+#include <cstring>
+#include <cstdint>
+#include <cmath>
+#include <iostream>
+
+static constexpr std::size_t N = 1024;
+
+// Copies str into a buffer whose padding is full of digits so that reading past last would be noticed
+template <typename T, typename Fmt>
+void check(const std::string& str, Fmt fmt)
+{
+    char buffer[128 + boost::charconv::from_chars_padding];
+    BOOST_TEST(str.size() <= 128);
+    std::memcpy(buffer, str.c_str(), str.size());
+    std::memset(buffer + str.size(), '7', boost::charconv::from_chars_padding);
+
+    const char* first = buffer;
+    const char* last = buffer + str.size();
+
+    T expected {};
+    T value {};
+    const auto r1 = boost::charconv::from_chars(first, last, expected, fmt);
+    const auto r2 = boost::charconv::from_chars_padded(first, last, value, fmt);
+
+    if (!BOOST_TEST(r1 == r2))
+    {
+        std::cerr << "Input: " << str << std::endl; // LCOV_EXCL_LINE
+    }
+
+    if (r1.ec == std::errc())
+    {
+        // Compare the bytes so that NaNs are equal to themselves
+        if (!BOOST_TEST(std::memcmp(&expected, &value, sizeof(T)) == 0))
+        {
+            std::cerr << "Input: " << str << std::endl; // LCOV_EXCL_LINE
+        }
+    }
+}
+
+static const char* integer_inputs[] = {"0", "1", "-1", "12345678", "123456789", "-123456789012345678",
+                                      "9223372036854775807", "-9223372036854775808", "9223372036854775808",
+                                      "18446744073709551615", "18446744073709551616", "99999999999999999999",
+                                      "000000000000000000000000000042", "-", "+1", "", "x", "12x", "-0", "1.5",
+                                      "127", "128", "-128", "-129", "255", "256", "32767", "32768", "-32768", "-32769",
+                                      "65535", "65536", "2147483647", "2147483648", "-2147483648", "-2147483649",
+                                      "4294967295", "4294967296"};
+
+template <typename T>
+void test_small_integer()
+{
+    for (const char* str : integer_inputs)
+    {
+        check<T>(str, 10);
+        check<T>(str, 16);
+    }
+}
+
+template <typename T>
+void test_integer()
+{
+    test_small_integer<T>();
+
+    std::mt19937_64 gen(42);
+    std::uniform_int_distribution<T> dist((std::numeric_limits<T>::min)(), (std::numeric_limits<T>::max)());
+
+    for (std::size_t i = 0; i < N; ++i)
+    {
+        const T v = dist(gen);
+        const std::string str = std::to_string(v);
+        check<T>(str, 10);
+
+        // Every prefix must stop exactly at last
+        for (std::size_t j = 0; j < str.size(); ++j)
+        {
+            check<T>(str.substr(0, j), 10);
+        }
+    }
+}
+
+template <typename T>
+void test_float()
+{
+    const char* inputs[] = {"0", "-0", "1", "1.5", "-1.5", "0.1", "123456789.123456789", "1e10", "1E-10", "1e",
+                            "1e+", ".5", "5.", "-.5", "1234567890123456789012345678901234567890", "1e400", "1e-400",
+                            "0.00000000000000000000000000000000000000001", "3.14159265358979323846264338327950288",
+                            "inf", "-inf", "nan", "infinity", "", "-", "+1", "x", "12x", "1.5e3.5",
+                            "2.2250738585072014e-308", "1.7976931348623157e308", "4.9e-324"};
+
+    for (const char* str : inputs)
+    {
+        check<T>(str, boost::charconv::chars_format::general);
+        check<T>(str, boost::charconv::chars_format::fixed);
+        check<T>(str, boost::charconv::chars_format::scientific);
+        check<T>(str, boost::charconv::chars_format::hex);
+    }
+
+    std::mt19937_64 gen(42);
+    std::uniform_real_distribution<T> dist(0, 1);
+
+    for (std::size_t i = 0; i < N; ++i)
+    {
+        char buffer[64];
+        const T v = dist(gen) * static_cast<T>(std::pow(10, static_cast<int>(i % 40) - 20));
+        const auto r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), v);
+        BOOST_TEST(r.ec == std::errc());
+        const std::string str(buffer, r.ptr);
+
+        for (std::size_t j = 0; j <= str.size(); ++j)
+        {
+            check<T>(str.substr(0, j), boost::charconv::chars_format::general);
+        }
+    }
+}
+
+int main()
+{
+    test_small_integer<char>();
+    test_small_integer<signed char>();
+    test_small_integer<unsigned char>();
+
+    test_integer<short>();
+    test_integer<unsigned short>();
+    test_integer<int>();
+    test_integer<unsigned>();
+    test_integer<long>();
+    test_integer<unsigned long>();
+    test_integer<long long>();
+    test_integer<unsigned long long>();
+
+    test_float<float>();
+    test_float<double>();
+
+    return boost::report_errors();
+}
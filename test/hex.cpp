@@ -0,0 +1,189 @@
+// Copyright 2023 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/charconv/hex.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <system_error>
+#include <algorithm>
+#include <random>
+#include <string>
+#include <vector>
+#include <cstring>
+#include <cstdint>
+
+// One byte at a time
+static std::string reference(const std::vector<unsigned char>& data, bool uppercase)
+{
+    const char* digits = uppercase ? "0123456789ABCDEF" : "0123456789abcdef";
+    std::string str;
+    for (const unsigned char b : data)
+    {
+        str += digits[b >> 4];
+        str += digits[b & 15];
+    }
+    return str;
+}
+
+// Sizes that cover every block size and tail of the encoders
+void test_round_trip()
+{
+    std::mt19937_64 gen(42);
+
+    for (std::size_t size = 0; size <= 160; ++size)
+    {
+        std::vector<unsigned char> data(size);
+        for (auto& b : data)
+        {
+            b = static_cast<unsigned char>(gen());
+        }
+
+        for (const bool uppercase : {false, true})
+        {
+            const std::string expected = reference(data, uppercase);
+
+            std::string buffer(2 * size + 1, '#');
+            const auto r = boost::charconv::to_chars_hex_bytes(&buffer[0], &buffer[0] + buffer.size(), data.data(), size, uppercase);
+            BOOST_TEST(r.ec == std::errc());
+            BOOST_TEST(r.ptr == buffer.data() + 2 * size);
+            BOOST_TEST_EQ(buffer.substr(0, 2 * size), expected);
+            BOOST_TEST_EQ(buffer.back(), '#');
+
+            std::vector<unsigned char> decoded(size + 1, 0xAA);
+            const auto r2 = boost::charconv::from_chars_hex_bytes(expected.data(), expected.data() + expected.size(), decoded.data(), size);
+            BOOST_TEST(r2.ec == std::errc());
+            BOOST_TEST(r2.ptr == expected.data() + expected.size());
+            BOOST_TEST(std::equal(data.begin(), data.end(), decoded.begin()));
+            BOOST_TEST_EQ(decoded.back(), 0xAA);
+        }
+
+        // Mixed case
+        std::string mixed = reference(data, false);
+        for (auto& c : mixed)
+        {
+            if (gen() % 2 == 0 && c >= 'a')
+            {
+                c = static_cast<char>(c - 'a' + 'A');
+            }
+        }
+        std::vector<unsigned char> decoded(size);
+        const auto r = boost::charconv::from_chars_hex_bytes(mixed.data(), mixed.data() + mixed.size(), decoded.data(), size);
+        BOOST_TEST(r.ec == std::errc());
+        BOOST_TEST(decoded == data);
+    }
+}
+
+// A single bad character anywhere in the input is found
+void test_invalid()
+{
+    const char bad[] = {'g', 'G', '/', ':', '@', '`', ' ', '-', 'x', '\0', '\x80', '\xB0', '\xC1', '\xE6', '\xFF'};
+
+    for (const std::size_t size : {1U, 3U, 4U, 7U, 16U, 31U, 32U, 33U, 64U, 100U})
+    {
+        const std::string good(2 * size, 'a');
+        std::vector<unsigned char> data(size);
+
+        for (std::size_t i = 0; i < 2 * size; ++i)
+        {
+            for (const char c : bad)
+            {
+                std::string str = good;
+                str[i] = c;
+                const auto r = boost::charconv::from_chars_hex_bytes(str.data(), str.data() + str.size(), data.data(), size);
+                BOOST_TEST(r.ec == std::errc::invalid_argument);
+                BOOST_TEST(r.ptr == str.data());
+            }
+        }
+
+        // Too few characters
+        const auto r = boost::charconv::from_chars_hex_bytes(good.data(), good.data() + good.size() - 1, data.data(), size);
+        BOOST_TEST(r.ec == std::errc::invalid_argument);
+
+        // Characters after the digits are not examined
+        const std::string longer = good + "zz";
+        const auto r2 = boost::charconv::from_chars_hex_bytes(longer.data(), longer.data() + longer.size(), data.data(), size);
+        BOOST_TEST(r2.ec == std::errc());
+        BOOST_TEST(r2.ptr == longer.data() + good.size());
+    }
+
+    // Every character
+    for (int c = 0; c < 256; ++c)
+    {
+        const bool valid = (c >= '0' && c <= '9') || (c >= 'a' && c <= 'f') || (c >= 'A' && c <= 'F');
+        for (const std::size_t size : {1U, 4U, 16U, 32U})
+        {
+            std::string str(2 * size, '0');
+            str[size] = static_cast<char>(c);
+            std::vector<unsigned char> data(size);
+            const auto r = boost::charconv::from_chars_hex_bytes(str.data(), str.data() + str.size(), data.data(), size);
+            BOOST_TEST_EQ(r.ec == std::errc(), valid);
+        }
+    }
+}
+
+void test_buffer()
+{
+    const unsigned char data[] = {0xDE, 0xAD, 0xBE, 0xEF, 0x01};
+    char buffer[10];
+
+    auto r = boost::charconv::to_chars_hex_bytes(buffer, buffer + 9, data, 5);
+    BOOST_TEST(r.ec == std::errc::result_out_of_range);
+    BOOST_TEST(r.ptr == buffer + 9);
+
+    r = boost::charconv::to_chars_hex_bytes(buffer, buffer + 10, data, 5);
+    BOOST_TEST(r.ec == std::errc());
+    BOOST_TEST_EQ(std::string(buffer, r.ptr), "deadbeef01");
+
+    r = boost::charconv::to_chars_hex_bytes(buffer, buffer + 10, data, 4, true);
+    BOOST_TEST_EQ(std::string(buffer, r.ptr), "DEADBEEF");
+
+    r = boost::charconv::to_chars_hex_bytes(buffer, buffer, data, 0);
+    BOOST_TEST(r.ec == std::errc());
+    BOOST_TEST(r.ptr == buffer);
+}
+
+void test_uuid()
+{
+    const unsigned char uuid[16] = {0x12, 0x3e, 0x45, 0x67, 0xe8, 0x9b, 0x12, 0xd3, 0xa4, 0x56, 0x42, 0x66, 0x14, 0x17, 0x40, 0x00};
+    char buffer[boost::charconv::uuid_chars + 1] = {};
+
+    auto r = boost::charconv::to_chars_uuid(buffer, buffer + boost::charconv::uuid_chars, uuid);
+    BOOST_TEST(r.ec == std::errc());
+    BOOST_TEST_EQ(std::string(buffer, r.ptr), "123e4567-e89b-12d3-a456-426614174000");
+
+    r = boost::charconv::to_chars_uuid(buffer, buffer + boost::charconv::uuid_chars, uuid, true);
+    BOOST_TEST_EQ(std::string(buffer, r.ptr), "123E4567-E89B-12D3-A456-426614174000");
+
+    r = boost::charconv::to_chars_uuid(buffer, buffer + boost::charconv::uuid_chars - 1, uuid);
+    BOOST_TEST(r.ec == std::errc::result_out_of_range);
+
+    unsigned char parsed[16] = {};
+    std::string str = "123E4567-e89b-12d3-A456-426614174000}";
+    auto r2 = boost::charconv::from_chars_uuid(str.data(), str.data() + str.size(), parsed);
+    BOOST_TEST(r2.ec == std::errc());
+    BOOST_TEST(r2.ptr == str.data() + 36);
+    BOOST_TEST(std::memcmp(parsed, uuid, 16) == 0);
+
+    // The layout and the digits are both checked, and the output is left alone on error
+    const char* invalid[] = {"123e4567e89b-12d3-a456-426614174000", "123e4567-e89b-12d3-a456_426614174000",
+                             "123e4567-e89b-12d3-a456-42661417400", "123e4567-e89b-12d3-a456-42661417400g",
+                             "{23e4567-e89b-12d3-a456-426614174000", "123e4567-e89b-12d3-a4-56426614174000"};
+    for (const char* s : invalid)
+    {
+        unsigned char untouched[16] = {};
+        r2 = boost::charconv::from_chars_uuid(s, s + std::strlen(s), untouched);
+        BOOST_TEST(r2.ec == std::errc::invalid_argument);
+        BOOST_TEST(r2.ptr == s);
+        BOOST_TEST(std::all_of(untouched, untouched + 16, [](unsigned char b) { return b == 0; }));
+    }
+}
+
+int main()
+{
+    test_round_trip();
+    test_invalid();
+    test_buffer();
+    test_uuid();
+
+    return boost::report_errors();
+}
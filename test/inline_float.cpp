@@ -0,0 +1,85 @@
+// Copyright 2023 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+// The float and double overloads defined in the headers link next to the ones exported by the library
+
+#define BOOST_CHARCONV_INLINE_FLOAT
+
+#include <boost/charconv.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <system_error>
+#include <iostream>
+#include <random>
+#include <string>
+#include <limits>
+#include <cstring>
+
+template <typename T>
+void test_roundtrip(T value, boost::charconv::chars_format fmt)
+{
+    char buffer[64];
+    const auto r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), value, fmt);
+    BOOST_TEST(r.ec == std::errc());
+
+    T parsed {};
+    const auto p = boost::charconv::from_chars(buffer, r.ptr, parsed, fmt);
+    BOOST_TEST(p.ec == std::errc());
+    BOOST_TEST(p.ptr == r.ptr);
+    if (!BOOST_TEST(parsed == value))
+    {
+        std::cerr << "Value: " << value << " Text: " << std::string(buffer, r.ptr) // LCOV_EXCL_LINE
+                  << " Format: " << static_cast<int>(fmt) << std::endl;           // LCOV_EXCL_LINE
+    }
+}
+
+template <typename T>
+void test_random()
+{
+    std::mt19937_64 gen(42);
+    std::uniform_real_distribution<T> dist(0, std::numeric_limits<T>::max());
+
+    for (int i = 0; i < 10000; ++i)
+    {
+        const T value = dist(gen);
+        test_roundtrip(value, boost::charconv::chars_format::general);
+        test_roundtrip(-value, boost::charconv::chars_format::scientific);
+    }
+}
+
+template <typename T>
+void test_text()
+{
+    char buffer[64];
+    auto r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), T(1.5), boost::charconv::chars_format::scientific, 3);
+    BOOST_TEST(r.ec == std::errc());
+    BOOST_TEST(std::string(buffer, r.ptr) == "1.500e+00");
+
+    r = boost::charconv::to_chars(buffer, buffer + 2, T(123.25));
+    BOOST_TEST(r.ec == std::errc::result_out_of_range);
+    BOOST_TEST(r.ptr == buffer + 2);
+
+    const char padded[] = "2.5e3 and some padding after the number";
+    T value {};
+    const auto p = boost::charconv::from_chars_padded(padded, padded + 5, value);
+    BOOST_TEST(p.ec == std::errc());
+    BOOST_TEST(p.ptr == padded + 5);
+    BOOST_TEST(value == T(2500));
+
+    // Hex text is parsed by the same engine as the library, see from_chars_float.cpp
+    const char* hex = "1.234p-10";
+    const auto h = boost::charconv::from_chars(hex, hex + std::strlen(hex), value, boost::charconv::chars_format::hex);
+    BOOST_TEST(h.ec == std::errc());
+    BOOST_TEST_EQ(value, static_cast<T>(4660e-13L));
+}
+
+int main()
+{
+    test_random<float>();
+    test_random<double>();
+
+    test_text<float>();
+    test_text<double>();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,292 @@
+// Copyright 2023 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/charconv/iso8601.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <system_error>
+#include <random>
+#include <limits>
+#include <string>
+#include <cstring>
+#include <cstdint>
+#include <cstdio>
+#include <iostream>
+
+static constexpr std::size_t N = 1024;
+
+using boost::charconv::time_unit;
+
+static const time_unit units[] = {time_unit::seconds, time_unit::milliseconds, time_unit::microseconds, time_unit::nanoseconds};
+static const std::int64_t scales[] = {1, 1000, 1000000, 1000000000};
+static const int fraction_digits[] = {0, 3, 6, 9};
+
+// Days from 1970-01-01 to January 1st of each year from 0000 to 10000, counted one year at a time
+struct year_table
+{
+    std::int64_t start[10001];
+
+    year_table()
+    {
+        std::int64_t days = 0;
+        for (int y = 0; y < 10000; ++y)
+        {
+            start[y] = days;
+            days += (y % 4 == 0 && (y % 100 != 0 || y % 400 == 0)) ? 366 : 365;
+        }
+        start[10000] = days;
+
+        const std::int64_t epoch = start[1970];
+        for (auto& d : start)
+        {
+            d -= epoch;
+        }
+    }
+};
+
+static const year_table years;
+
+// The expected output, computed without the algorithms of the library
+static std::string reference(std::int64_t value, int unit_index)
+{
+    const std::int64_t scale = scales[unit_index];
+    std::int64_t seconds = value / scale;
+    std::int64_t fraction = value % scale;
+    if (fraction < 0)
+    {
+        fraction += scale;
+        --seconds;
+    }
+
+    std::int64_t days = seconds / 86400;
+    std::int64_t time = seconds % 86400;
+    if (time < 0)
+    {
+        time += 86400;
+        --days;
+    }
+
+    int year = 0;
+    while (year < 10000 && years.start[year + 1] <= days)
+    {
+        ++year;
+    }
+
+    const bool leap = year % 4 == 0 && (year % 100 != 0 || year % 400 == 0);
+    const int month_days[] = {31, leap ? 29 : 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+    int day = static_cast<int>(days - years.start[year]);
+    int month = 0;
+    while (day >= month_days[month])
+    {
+        day -= month_days[month];
+        ++month;
+    }
+
+    char buffer[64];
+    int n = std::snprintf(buffer, sizeof(buffer), "%04d-%02d-%02dT%02d:%02d:%02d", year, month + 1, day + 1,
+                          static_cast<int>(time / 3600), static_cast<int>(time / 60 % 60), static_cast<int>(time % 60));
+    if (fraction_digits[unit_index] != 0)
+    {
+        n += std::snprintf(buffer + n, sizeof(buffer) - static_cast<std::size_t>(n), ".%0*lld", fraction_digits[unit_index], static_cast<long long>(fraction));
+    }
+    return std::string(buffer, static_cast<std::size_t>(n)) + "Z";
+}
+
+static void check(std::int64_t value, int unit_index)
+{
+    char buffer[64];
+    const auto r = boost::charconv::to_chars_iso8601(buffer, buffer + sizeof(buffer), value, units[unit_index]);
+    BOOST_TEST(r.ec == std::errc());
+
+    const std::string expected = reference(value, unit_index);
+    if (!BOOST_TEST_EQ(std::string(buffer, r.ptr), expected))
+    {
+        std::cerr << "Value: " << value << std::endl; // LCOV_EXCL_LINE
+    }
+
+    std::int64_t parsed = 0;
+    const auto r2 = boost::charconv::from_chars_iso8601(buffer, r.ptr, parsed, units[unit_index]);
+    BOOST_TEST(r2.ec == std::errc());
+    BOOST_TEST(r2.ptr == r.ptr);
+    BOOST_TEST_EQ(parsed, value);
+}
+
+static std::string format(std::int64_t value, time_unit unit)
+{
+    char buffer[64];
+    const auto r = boost::charconv::to_chars_iso8601(buffer, buffer + sizeof(buffer), value, unit);
+    BOOST_TEST(r.ec == std::errc());
+    return std::string(buffer, r.ptr);
+}
+
+static std::int64_t parse(const std::string& str, time_unit unit = time_unit::nanoseconds)
+{
+    std::int64_t value = 42;
+    const auto r = boost::charconv::from_chars_iso8601(str.data(), str.data() + str.size(), value, unit);
+    BOOST_TEST(r.ec == std::errc());
+    BOOST_TEST(r.ptr == str.data() + str.size());
+    return value;
+}
+
+static void check_invalid(const std::string& str)
+{
+    std::int64_t value = 42;
+    const auto r = boost::charconv::from_chars_iso8601(str.data(), str.data() + str.size(), value);
+    if (!BOOST_TEST(r.ec == std::errc::invalid_argument))
+    {
+        std::cerr << "Input: " << str << std::endl; // LCOV_EXCL_LINE
+    }
+    BOOST_TEST(r.ptr == str.data());
+    BOOST_TEST_EQ(value, 42);
+}
+
+void test_spot_values()
+{
+    constexpr auto max = (std::numeric_limits<std::int64_t>::max)();
+    constexpr auto min = (std::numeric_limits<std::int64_t>::min)();
+
+    BOOST_TEST_EQ(format(0, time_unit::nanoseconds), "1970-01-01T00:00:00.000000000Z");
+    BOOST_TEST_EQ(format(-1, time_unit::nanoseconds), "1969-12-31T23:59:59.999999999Z");
+    BOOST_TEST_EQ(format(max, time_unit::nanoseconds), "2262-04-11T23:47:16.854775807Z");
+    BOOST_TEST_EQ(format(min, time_unit::nanoseconds), "1677-09-21T00:12:43.145224192Z");
+    BOOST_TEST_EQ(format(1685622896789, time_unit::milliseconds), "2023-06-01T12:34:56.789Z");
+    BOOST_TEST_EQ(format(1685622896789012, time_unit::microseconds), "2023-06-01T12:34:56.789012Z");
+    BOOST_TEST_EQ(format(951782400, time_unit::seconds), "2000-02-29T00:00:00Z");
+    BOOST_TEST_EQ(format(253402300799, time_unit::seconds), "9999-12-31T23:59:59Z");
+    BOOST_TEST_EQ(format(-62167219200, time_unit::seconds), "0000-01-01T00:00:00Z");
+
+    // Years that do not have four digits
+    char buffer[64];
+    auto r = boost::charconv::to_chars_iso8601(buffer, buffer + sizeof(buffer), 253402300800, time_unit::seconds);
+    BOOST_TEST(r.ec == std::errc::value_too_large);
+    r = boost::charconv::to_chars_iso8601(buffer, buffer + sizeof(buffer), -62167219201, time_unit::seconds);
+    BOOST_TEST(r.ec == std::errc::value_too_large);
+    r = boost::charconv::to_chars_iso8601(buffer, buffer + sizeof(buffer), min, time_unit::seconds);
+    BOOST_TEST(r.ec == std::errc::value_too_large);
+
+    // Buffer sizes
+    for (int i = 0; i < 4; ++i)
+    {
+        const std::size_t size = 20 + (fraction_digits[i] == 0 ? 0 : static_cast<std::size_t>(fraction_digits[i]) + 1);
+        std::memset(buffer, '#', sizeof(buffer));
+        r = boost::charconv::to_chars_iso8601(buffer, buffer + size - 1, 0, units[i]);
+        BOOST_TEST(r.ec == std::errc::result_out_of_range);
+        BOOST_TEST(r.ptr == buffer + size - 1);
+        BOOST_TEST_EQ(buffer[0], '#');
+
+        r = boost::charconv::to_chars_iso8601(buffer, buffer + size, 0, units[i]);
+        BOOST_TEST(r.ec == std::errc());
+        BOOST_TEST(r.ptr == buffer + size);
+        BOOST_TEST(size <= boost::charconv::iso8601_max_chars);
+    }
+}
+
+void test_parse()
+{
+    BOOST_TEST_EQ(parse("1970-01-01T00:00:00Z"), 0);
+    BOOST_TEST_EQ(parse("1970-01-01t00:00:00z"), 0);
+    BOOST_TEST_EQ(parse("1970-01-01 00:00:01Z"), 1000000000);
+    BOOST_TEST_EQ(parse("1970-01-01T00:00:00.5Z"), 500000000);
+    BOOST_TEST_EQ(parse("1970-01-01T00:00:00.123456789Z"), 123456789);
+    BOOST_TEST_EQ(parse("1970-01-01T00:00:00.12345678912345Z"), 123456789);
+    BOOST_TEST_EQ(parse("1970-01-01T00:00:00.1234567Z"), 123456700);
+    BOOST_TEST_EQ(parse("1969-12-31T23:59:59.999999999Z"), -1);
+    BOOST_TEST_EQ(parse("2023-06-01T12:34:56.789Z", time_unit::milliseconds), 1685622896789);
+    BOOST_TEST_EQ(parse("2023-06-01T12:34:56.789999Z", time_unit::milliseconds), 1685622896789);
+    BOOST_TEST_EQ(parse("2023-06-01T12:34:56Z", time_unit::microseconds), 1685622896000000);
+    BOOST_TEST_EQ(parse("2023-06-01T12:34:56.9Z", time_unit::seconds), 1685622896);
+    BOOST_TEST_EQ(parse("1969-12-31T23:59:59.9Z", time_unit::seconds), -1);
+
+    // UTC offsets
+    BOOST_TEST_EQ(parse("2023-06-01T14:34:56+02:00", time_unit::seconds), 1685622896);
+    BOOST_TEST_EQ(parse("2023-06-01T07:04:56.000-05:30", time_unit::seconds), 1685622896);
+    BOOST_TEST_EQ(parse("1970-01-01T00:00:00+00:00"), 0);
+    BOOST_TEST_EQ(parse("1970-01-01T00:00:00-00:00"), 0);
+
+    // Dates
+    BOOST_TEST_EQ(parse("2000-02-29T00:00:00Z", time_unit::seconds), 951782400);
+    BOOST_TEST_EQ(parse("0000-01-01T00:00:00Z", time_unit::seconds), -62167219200);
+    BOOST_TEST_EQ(parse("9999-12-31T23:59:59Z", time_unit::seconds), 253402300799);
+
+    check_invalid("");
+    check_invalid("1970-01-01T00:00:00");
+    check_invalid("1970-01-01T00:00:00.Z");
+    check_invalid("1970-01-01T00:00:00+0100");
+    check_invalid("1970-01-01T00:00:00+24:00");
+    check_invalid("1970-01-01T00:00:00 Z");
+    check_invalid("1970-01-01X00:00:00Z");
+    check_invalid("1970/01/01T00:00:00Z");
+    check_invalid("1970-1-01T00:00:00Z");
+    check_invalid("197a-01-01T00:00:00Z");
+    check_invalid("1970-01-01T00:00:0aZ");
+    check_invalid("1970-01-01T00-00:00Z");
+    check_invalid("1970-00-01T00:00:00Z");
+    check_invalid("1970-13-01T00:00:00Z");
+    check_invalid("1970-01-00T00:00:00Z");
+    check_invalid("1970-01-32T00:00:00Z");
+    check_invalid("1970-04-31T00:00:00Z");
+    check_invalid("2023-02-29T00:00:00Z");
+    check_invalid("1900-02-29T00:00:00Z");
+    check_invalid("1970-01-01T24:00:00Z");
+    check_invalid("1970-01-01T00:60:00Z");
+    check_invalid("1970-01-01T00:00:60Z");
+    check_invalid("+1970-01-01T00:00:00Z");
+
+    // Only the timestamp is matched
+    const std::string str = "2023-06-01T12:34:56Z,next";
+    std::int64_t value = 0;
+    auto r = boost::charconv::from_chars_iso8601(str.data(), str.data() + str.size(), value, time_unit::seconds);
+    BOOST_TEST(r.ec == std::errc());
+    BOOST_TEST(r.ptr == str.data() + 20);
+    BOOST_TEST_EQ(value, 1685622896);
+
+    // Instants that do not fit into nanoseconds
+    const std::string late = "2262-04-11T23:47:16.854775808Z";
+    value = 42;
+    r = boost::charconv::from_chars_iso8601(late.data(), late.data() + late.size(), value);
+    BOOST_TEST(r.ec == std::errc::result_out_of_range);
+    BOOST_TEST(r.ptr == late.data() + late.size());
+    BOOST_TEST_EQ(value, 42);
+
+    const std::string early = "1677-09-21T00:12:43.145224191Z";
+    r = boost::charconv::from_chars_iso8601(early.data(), early.data() + early.size(), value);
+    BOOST_TEST(r.ec == std::errc::result_out_of_range);
+    BOOST_TEST_EQ(value, 42);
+
+    BOOST_TEST_EQ(parse("2262-04-11T23:47:16.854775807Z"), (std::numeric_limits<std::int64_t>::max)());
+    BOOST_TEST_EQ(parse("1677-09-21T00:12:43.145224192Z"), (std::numeric_limits<std::int64_t>::min)());
+}
+
+void test_random()
+{
+    std::mt19937_64 gen(42);
+
+    for (int u = 0; u < 4; ++u)
+    {
+        // Every year that can be written, or the whole range of nanoseconds
+        const std::int64_t lo = u == 3 ? (std::numeric_limits<std::int64_t>::min)() : -62167219200 * scales[u];
+        const std::int64_t hi = u == 3 ? (std::numeric_limits<std::int64_t>::max)() : 253402300800 * scales[u] - 1;
+        std::uniform_int_distribution<std::int64_t> dist(lo, hi);
+
+        for (std::size_t i = 0; i < N * 4; ++i)
+        {
+            check(dist(gen), u);
+        }
+
+        // Around the epoch and the ends of months
+        for (std::int64_t d = -800; d <= 800; ++d)
+        {
+            check(d * 86400 * scales[u] - 1, u);
+            check(d * 86400 * scales[u], u);
+        }
+    }
+}
+
+int main()
+{
+    test_spot_values();
+    test_parse();
+    test_random();
+
+    return boost::report_errors();
+}
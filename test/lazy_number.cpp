@@ -0,0 +1,223 @@
+// Copyright 2023 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/charconv/lazy_number.hpp>
+#include <boost/charconv.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <system_error>
+#include <iostream>
+#include <random>
+#include <string>
+#include <cstring>
+#include <cstdint>
+#include <cmath>
+
+static std::string random_input(std::mt19937_64& gen)
+{
+    static const char alphabet[] = "0123456789012345678901234567890123456789-+.eEinfatyINFATY()_x ";
+
+    std::string str;
+    const std::size_t n = gen() % 30;
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        str += alphabet[gen() % (sizeof(alphabet) - 1)];
+    }
+    return str;
+}
+
+static const char* const edge_cases[] = {
+    "", "-", "+1", ".", "-.", ".5", "5.", "-5.e", "1e", "1e+", "1e-5", "1E+05x", "123456789012345678901234567890",
+    "0.000000000000000000000000000001", "1e400", "-1e-400", "inf", "-Infinity", "infinit", "nan", "nan(snan)",
+    "nan(x", "-nan()", "in", "abc", "12345678.12345678e12345678", "007", "-0"
+};
+
+// The scanned text ends where from_chars for a double stops
+void test_scan(const std::string& str)
+{
+    const char* first = str.data();
+    const char* last = str.data() + str.size();
+
+    boost::charconv::lazy_number n;
+    const auto r1 = boost::charconv::from_chars(first, last, n);
+
+    double v = 0;
+    const auto r2 = boost::charconv::from_chars(first, last, v);
+    const bool matched = r2.ec == std::errc() || r2.ec == std::errc::result_out_of_range;
+
+    if (!BOOST_TEST(r1.ptr == (matched ? r2.ptr : first)) || !BOOST_TEST((r1.ec == std::errc()) == matched))
+    {
+        std::cerr << "Input: " << str << std::endl; // LCOV_EXCL_LINE
+        return;                                     // LCOV_EXCL_LINE
+    }
+
+    if (!matched)
+    {
+        return;
+    }
+
+    BOOST_TEST(n.data() == first);
+    BOOST_TEST(n.size() == static_cast<std::size_t>(r1.ptr - first));
+
+    double d = 42;
+    BOOST_TEST(n.get(d) == r2.ec);
+    if (r2.ec == std::errc())
+    {
+        BOOST_TEST(std::memcmp(&d, &v, sizeof(d)) == 0);
+    }
+
+    std::int64_t i = 42;
+    std::int64_t expected = 42;
+    const auto ri = boost::charconv::from_chars(first, r1.ptr, expected);
+    const auto ec = n.get(i);
+    if (n.is_integer())
+    {
+        BOOST_TEST(ri.ptr == r1.ptr);
+        BOOST_TEST(ec == ri.ec);
+        BOOST_TEST(i == expected);
+    }
+    else
+    {
+        BOOST_TEST(ec == std::errc::invalid_argument);
+        BOOST_TEST(i == 42);
+    }
+
+    char buffer[64];
+    const auto w = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), n);
+    BOOST_TEST(w.ec == std::errc());
+    BOOST_TEST(std::string(buffer, w.ptr) == std::string(first, r1.ptr));
+}
+
+void test_get()
+{
+    const char* str = "-1234567890123,";
+
+    boost::charconv::lazy_number n;
+    const auto r = boost::charconv::from_chars(str, str + std::strlen(str), n);
+    BOOST_TEST(r.ec == std::errc());
+    BOOST_TEST(r.ptr == str + 14);
+    BOOST_TEST(n.is_integer());
+    BOOST_TEST(!n.modified());
+
+    std::int64_t i = 0;
+    BOOST_TEST(n.get(i) == std::errc());
+    BOOST_TEST_EQ(i, INT64_C(-1234567890123));
+    i = 0;
+    BOOST_TEST(n.get(i) == std::errc());
+    BOOST_TEST_EQ(i, INT64_C(-1234567890123));
+
+    std::uint64_t u = 0;
+    BOOST_TEST(n.get(u) == std::errc::invalid_argument);
+
+    double d = 0;
+    BOOST_TEST(n.get(d) == std::errc());
+    BOOST_TEST_EQ(d, -1234567890123.0);
+
+    long double ld = 0;
+    BOOST_TEST(n.get(ld) == std::errc());
+    BOOST_TEST_EQ(ld, -1234567890123.0L);
+
+    str = "18446744073709551615";
+    BOOST_TEST(boost::charconv::from_chars(str, str + std::strlen(str), n).ec == std::errc());
+    BOOST_TEST(n.get(u) == std::errc());
+    BOOST_TEST_EQ(u, UINT64_MAX);
+    BOOST_TEST(n.get(i) == std::errc::result_out_of_range);
+
+    str = "0.1e1";
+    BOOST_TEST(boost::charconv::from_chars(str, str + std::strlen(str), n).ec == std::errc());
+    BOOST_TEST(!n.is_integer());
+    BOOST_TEST(n.get(i) == std::errc::invalid_argument);
+    BOOST_TEST(n.get(ld) == std::errc());
+    BOOST_TEST_EQ(ld, 1.0L);
+
+    // A failed read leaves the number alone
+    str = "x";
+    BOOST_TEST(boost::charconv::from_chars(str, str + 1, n).ec == std::errc::invalid_argument);
+    BOOST_TEST(n.size() == 5);
+
+    boost::charconv::lazy_number empty;
+    BOOST_TEST(empty.get(d) == std::errc::invalid_argument);
+    BOOST_TEST(empty.get(i) == std::errc::invalid_argument);
+    char buffer[8];
+    const auto w = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), empty);
+    BOOST_TEST(w.ec == std::errc());
+    BOOST_TEST(w.ptr == buffer);
+}
+
+void test_set()
+{
+    const char* str = "1.50";
+
+    boost::charconv::lazy_number n;
+    BOOST_TEST(boost::charconv::from_chars(str, str + std::strlen(str), n).ec == std::errc());
+
+    char buffer[64];
+    auto w = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), n);
+    BOOST_TEST(std::string(buffer, w.ptr) == "1.50");
+
+    // The original text is written even if it is not the shortest representation, and only if it fits
+    w = boost::charconv::to_chars(buffer, buffer + 3, n);
+    BOOST_TEST(w.ec == std::errc::result_out_of_range);
+    BOOST_TEST(w.ptr == buffer + 3);
+
+    n.set(2.25);
+    BOOST_TEST(n.modified());
+    BOOST_TEST(!n.is_integer());
+    BOOST_TEST(n.size() == 0);
+    w = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), n);
+    BOOST_TEST(std::string(buffer, w.ptr) == "2.25");
+
+    double d = 0;
+    BOOST_TEST(n.get(d) == std::errc());
+    BOOST_TEST_EQ(d, 2.25);
+    std::int64_t i = 0;
+    BOOST_TEST(n.get(i) == std::errc::invalid_argument);
+
+    n.set(3.0);
+    BOOST_TEST(n.get(i) == std::errc());
+    BOOST_TEST_EQ(i, 3);
+
+    n.set(INT64_C(-42));
+    BOOST_TEST(n.is_integer());
+    w = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), n);
+    BOOST_TEST(std::string(buffer, w.ptr) == "-42");
+    BOOST_TEST(n.get(d) == std::errc());
+    BOOST_TEST_EQ(d, -42.0);
+    std::uint64_t u = 0;
+    BOOST_TEST(n.get(u) == std::errc::invalid_argument);
+
+    n.set(UINT64_C(18446744073709551615));
+    w = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), n);
+    BOOST_TEST(std::string(buffer, w.ptr) == "18446744073709551615");
+    BOOST_TEST(n.get(u) == std::errc());
+    BOOST_TEST_EQ(u, UINT64_MAX);
+    BOOST_TEST(n.get(i) == std::errc::result_out_of_range);
+    long double ld = 0;
+    BOOST_TEST(n.get(ld) == std::errc());
+    BOOST_TEST_EQ(ld, 18446744073709551615.0L);
+
+    // Reading again discards the value that was set
+    BOOST_TEST(boost::charconv::from_chars(str, str + std::strlen(str), n).ec == std::errc());
+    BOOST_TEST(!n.modified());
+    BOOST_TEST(n.get(d) == std::errc());
+    BOOST_TEST_EQ(d, 1.5);
+}
+
+int main()
+{
+    for (const char* str : edge_cases)
+    {
+        test_scan(str);
+    }
+
+    std::mt19937_64 gen(42);
+    for (int i = 0; i < 100000; ++i)
+    {
+        test_scan(random_input(gen));
+    }
+
+    test_get();
+    test_set();
+
+    return boost::report_errors();
+}
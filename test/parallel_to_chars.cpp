@@ -0,0 +1,147 @@
+// Copyright 2023 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/charconv/parallel_to_chars.hpp>
+#include <boost/charconv.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <system_error>
+#include <random>
+#include <limits>
+#include <string>
+#include <vector>
+#include <cstring>
+#include <cstdint>
+#include <cmath>
+
+static constexpr std::size_t N = 1024;
+
+static const boost::charconv::chars_format formats[] = {boost::charconv::chars_format::general, boost::charconv::chars_format::fixed,
+                                                        boost::charconv::chars_format::scientific, boost::charconv::chars_format::hex};
+
+// The values formatted one after the other
+template <typename T>
+std::string serial_to_chars(const std::vector<T>& values, char separator, boost::charconv::chars_format fmt)
+{
+    std::string str;
+    for (const T v : values)
+    {
+        char buffer[64];
+        const auto r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), v, fmt);
+        BOOST_TEST(r.ec == std::errc());
+        str.append(buffer, r.ptr);
+        str += separator;
+    }
+    return str;
+}
+
+template <typename T>
+void check(const std::vector<T>& values, unsigned threads)
+{
+    for (const auto fmt : formats)
+    {
+        const std::string expected = serial_to_chars(values, ',', fmt);
+        BOOST_TEST_EQ(boost::charconv::parallel_to_chars_size(values.data(), values.size(), fmt), expected.size());
+
+        std::vector<char> buffer(values.size() * (boost::charconv::limits<T>::max_chars10 + 1) + 1, '#');
+        const auto r = boost::charconv::parallel_to_chars(buffer.data(), buffer.data() + buffer.size() - 1, values.data(), values.size(), ',', fmt, threads);
+        BOOST_TEST(r.ec == std::errc());
+        BOOST_TEST(std::string(buffer.data(), r.ptr) == expected);
+        BOOST_TEST_EQ(buffer.back(), '#');
+    }
+}
+
+// Values around the boundaries between the layouts of to_chars
+template <typename T>
+std::vector<T> edge_values()
+{
+    std::vector<T> values = {T(0), -T(0), T(1), T(-1), T(0.5), T(1.5), T(10), T(100), T(123.456), T(1e7), T(1e15), T(1e16), T(1e17),
+                             T(1e19), T(1.8e19), T(4294967296.0), T(1e20), T(1e-5), T(1e-100), T(1e100), T(1e300), T(-1e-300),
+                             std::numeric_limits<T>::min(), std::numeric_limits<T>::denorm_min(), (std::numeric_limits<T>::max)(),
+                             std::numeric_limits<T>::lowest(), std::numeric_limits<T>::epsilon(),
+                             std::numeric_limits<T>::infinity(), -std::numeric_limits<T>::infinity(), std::numeric_limits<T>::quiet_NaN()};
+
+    for (int i = -30; i <= 30; ++i)
+    {
+        const T p = static_cast<T>(std::pow(10.0, i));
+        values.push_back(p);
+        values.push_back(std::nextafter(p, T(0)));
+        values.push_back(std::nextafter(p, std::numeric_limits<T>::infinity()));
+        values.push_back(-p * 3);
+    }
+
+    return values;
+}
+
+template <typename T>
+std::vector<T> random_values(std::size_t count)
+{
+    using unsigned_type = typename std::conditional<sizeof(T) == 4, std::uint32_t, std::uint64_t>::type;
+
+    std::mt19937_64 gen(42);
+    std::uniform_int_distribution<unsigned_type> bits;
+    std::uniform_real_distribution<double> prices(0, 1e6);
+
+    std::vector<T> values;
+    values.reserve(count);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        if (i % 2 == 0)
+        {
+            const auto b = bits(gen);
+            T v;
+            std::memcpy(&v, &b, sizeof(T));
+            values.push_back(v);
+        }
+        else
+        {
+            values.push_back(static_cast<T>(std::round(prices(gen)) / 100));
+        }
+    }
+
+    return values;
+}
+
+template <typename T>
+void test()
+{
+    check(edge_values<T>(), 1);
+    check(random_values<T>(N * 16), 1);
+
+    // Enough values for several threads
+    const auto values = random_values<T>(N * 64);
+    check(values, 2);
+    check(values, 3);
+    check(values, 8);
+    check(values, 0);
+
+    // Empty input
+    char buffer[4];
+    auto r = boost::charconv::parallel_to_chars(buffer, buffer, values.data(), 0, ',');
+    BOOST_TEST(r.ec == std::errc());
+    BOOST_TEST(r.ptr == buffer);
+
+    // Too small a buffer leaves it untouched
+    const std::string expected = serial_to_chars(values, '\n', boost::charconv::chars_format::general);
+    std::vector<char> small(expected.size() - 1, '#');
+    r = boost::charconv::parallel_to_chars(small.data(), small.data() + small.size(), values.data(), values.size(), '\n',
+                                           boost::charconv::chars_format::general, 4);
+    BOOST_TEST(r.ec == std::errc::result_out_of_range);
+    BOOST_TEST(r.ptr == small.data() + small.size());
+    BOOST_TEST(std::string(small.begin(), small.end()) == std::string(small.size(), '#'));
+
+    // And just large enough
+    small.push_back('#');
+    r = boost::charconv::parallel_to_chars(small.data(), small.data() + small.size(), values.data(), values.size(), '\n',
+                                           boost::charconv::chars_format::general, 4);
+    BOOST_TEST(r.ec == std::errc());
+    BOOST_TEST(std::string(small.data(), r.ptr) == expected);
+}
+
+int main()
+{
+    test<float>();
+    test<double>();
+
+    return boost::report_errors();
+}
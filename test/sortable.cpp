@@ -0,0 +1,255 @@
+// Copyright 2023 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/charconv/sortable.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <system_error>
+#include <algorithm>
+#include <random>
+#include <limits>
+#include <string>
+#include <vector>
+#include <cstring>
+#include <cstdint>
+#include <cmath>
+#include <iostream>
+
+static constexpr std::size_t N = 1024;
+
+template <typename T>
+std::string encode(T value)
+{
+    char buffer[boost::charconv::sortable_max_chars];
+    const auto r = boost::charconv::to_chars_sortable(buffer, buffer + sizeof(buffer), value);
+    BOOST_TEST(r.ec == std::errc());
+    return std::string(buffer, r.ptr);
+}
+
+template <typename T>
+void check_roundtrip(T value)
+{
+    const std::string key = encode(value);
+
+    T parsed {};
+    const auto r = boost::charconv::from_chars_sortable(key.data(), key.data() + key.size(), parsed);
+    BOOST_TEST(r.ec == std::errc());
+    BOOST_TEST(r.ptr == key.data() + key.size());
+
+    // Both zeros have the same key
+    if (!BOOST_TEST(parsed == value || (std::isnan(static_cast<double>(parsed)) && std::isnan(static_cast<double>(value)))))
+    {
+        std::cerr << "Key: " << key << std::endl; // LCOV_EXCL_LINE
+    }
+}
+
+// Sorting the keys with memcmp must give the same order as sorting the values
+template <typename T>
+void check_order(std::vector<T> values)
+{
+    std::sort(values.begin(), values.end());
+
+    std::vector<std::string> keys;
+    for (const T v : values)
+    {
+        keys.push_back(encode(v));
+    }
+
+    for (std::size_t i = 1; i < keys.size(); ++i)
+    {
+        const int cmp = std::memcmp(keys[i - 1].data(), keys[i].data(), (std::min)(keys[i - 1].size(), keys[i].size()));
+        if (values[i - 1] == values[i])
+        {
+            BOOST_TEST(keys[i - 1] == keys[i]);
+        }
+        else if (!BOOST_TEST(cmp < 0 || (cmp == 0 && keys[i - 1].size() < keys[i].size())))
+        {
+            std::cerr << "Keys: " << keys[i - 1] << " " << keys[i] << std::endl; // LCOV_EXCL_LINE
+        }
+    }
+
+    // Keys are self delimiting, so the order holds also when other data follows them
+    for (std::size_t i = 1; i < keys.size(); ++i)
+    {
+        if (values[i - 1] != values[i])
+        {
+            BOOST_TEST(keys[i - 1] + "~" < keys[i] + "!");
+        }
+    }
+}
+
+void test_spot_values()
+{
+    BOOST_TEST_EQ(encode(0), "C");
+    BOOST_TEST_EQ(encode(1), "D5011.");
+    BOOST_TEST_EQ(encode(10), "D5021.");
+    BOOST_TEST_EQ(encode(9), "D5019.");
+    BOOST_TEST_EQ(encode(-1), "B4988:");
+    BOOST_TEST_EQ(encode(1200U), "D50412.");
+    BOOST_TEST_EQ(encode(0.5), "D5005.");
+    BOOST_TEST_EQ(encode(-0.0), "C");
+    BOOST_TEST_EQ(encode(-1.25), "B498874:");
+    BOOST_TEST_EQ(encode(std::numeric_limits<double>::infinity()), "E");
+    BOOST_TEST_EQ(encode(-std::numeric_limits<double>::infinity()), "A");
+    BOOST_TEST_EQ(encode(std::numeric_limits<double>::quiet_NaN()), "F");
+
+    // Integers and floating point values share the key space
+    BOOST_TEST_EQ(encode(123456), encode(123456.0));
+    BOOST_TEST_EQ(encode(-42), encode(-42.0f));
+
+    BOOST_TEST_EQ(encode(std::numeric_limits<std::int64_t>::min()).size(), 24U);
+    BOOST_TEST_EQ(encode(std::numeric_limits<std::uint64_t>::max()).size(), boost::charconv::sortable_max_chars);
+
+    // Too small buffers
+    char buffer[8];
+    auto r = boost::charconv::to_chars_sortable(buffer, buffer + 6, 12.5);
+    BOOST_TEST(r.ec == std::errc::result_out_of_range);
+    r = boost::charconv::to_chars_sortable(buffer, buffer + 7, 12.5);
+    BOOST_TEST(r.ec == std::errc::result_out_of_range);
+    r = boost::charconv::to_chars_sortable(buffer, buffer + 8, 12.5);
+    BOOST_TEST(r.ec == std::errc());
+    BOOST_TEST_EQ(std::string(buffer, r.ptr), "D502125.");
+    r = boost::charconv::to_chars_sortable(buffer, buffer, 0);
+    BOOST_TEST(r.ec == std::errc::result_out_of_range);
+}
+
+void test_parse_errors()
+{
+    const char* invalid[] = {"", "G", "D", "D50", "D501", "D501.", "D5010.", "D50110.", "D5011", "D5x11.", "D50115", "B4988."};
+    for (const char* str : invalid)
+    {
+        double v = 42;
+        const auto r = boost::charconv::from_chars_sortable(str, str + std::strlen(str), v);
+        BOOST_TEST(r.ec == std::errc::invalid_argument);
+        BOOST_TEST(r.ptr == str);
+        BOOST_TEST_EQ(v, 42.0);
+
+        int i = 42;
+        const auto r2 = boost::charconv::from_chars_sortable(str, str + std::strlen(str), i);
+        BOOST_TEST(r2.ec == std::errc::invalid_argument);
+        BOOST_TEST_EQ(i, 42);
+    }
+
+    // Only the key itself is consumed
+    const std::string key = encode(2.5) + "rest";
+    double v {};
+    auto r = boost::charconv::from_chars_sortable(key.data(), key.data() + key.size(), v);
+    BOOST_TEST(r.ec == std::errc());
+    BOOST_TEST(r.ptr == key.data() + key.size() - 4);
+    BOOST_TEST_EQ(v, 2.5);
+
+    // Fractions do not decode as integers, and out of range values are reported
+    int i = 42;
+    r = boost::charconv::from_chars_sortable(key.data(), key.data() + key.size(), i);
+    BOOST_TEST(r.ec == std::errc::invalid_argument);
+
+    const std::string big = encode(300);
+    std::int8_t small = 0;
+    r = boost::charconv::from_chars_sortable(big.data(), big.data() + big.size(), small);
+    BOOST_TEST(r.ec == std::errc::result_out_of_range);
+
+    const std::string negative = encode(-5);
+    unsigned u = 0;
+    r = boost::charconv::from_chars_sortable(negative.data(), negative.data() + negative.size(), u);
+    BOOST_TEST(r.ec == std::errc::result_out_of_range);
+
+    const std::string huge = encode(1e30);
+    std::uint64_t u64 = 0;
+    r = boost::charconv::from_chars_sortable(huge.data(), huge.data() + huge.size(), u64);
+    BOOST_TEST(r.ec == std::errc::result_out_of_range);
+
+    // Keys with more digits than a double are rounded correctly
+    const char* long_key = "D5011000000000000000000000001.";
+    r = boost::charconv::from_chars_sortable(long_key, long_key + std::strlen(long_key), v);
+    BOOST_TEST(r.ec == std::errc());
+    BOOST_TEST_EQ(v, 1.0);
+
+    // Just below and just above the midpoint of 1 and the next double, 1 + 2^-53
+    const char* below = "D5011000000000000000111022302462515654042363.";
+    r = boost::charconv::from_chars_sortable(below, below + std::strlen(below), v);
+    BOOST_TEST(r.ec == std::errc());
+    BOOST_TEST_EQ(v, 1.0);
+    const char* above = "D5011000000000000000111022302462515654042364.";
+    r = boost::charconv::from_chars_sortable(above, above + std::strlen(above), v);
+    BOOST_TEST(r.ec == std::errc());
+    BOOST_TEST_EQ(v, std::nextafter(1.0, 2.0));
+
+    std::uint64_t exact = 0;
+    r = boost::charconv::from_chars_sortable(long_key, long_key + std::strlen(long_key), exact);
+    BOOST_TEST(r.ec == std::errc::invalid_argument);
+    const char* long_integer = "D5169007199254740993.";
+    r = boost::charconv::from_chars_sortable(long_integer, long_integer + std::strlen(long_integer), exact);
+    BOOST_TEST(r.ec == std::errc());
+    BOOST_TEST_EQ(exact, UINT64_C(9007199254740993));
+}
+
+template <typename T>
+void test_integers()
+{
+    std::mt19937_64 gen(42);
+    std::uniform_int_distribution<T> dist((std::numeric_limits<T>::min)(), (std::numeric_limits<T>::max)());
+
+    std::vector<T> values {(std::numeric_limits<T>::min)(), (std::numeric_limits<T>::max)(), T(0), T(1), T(9), T(10), T(11), T(100)};
+    for (std::size_t i = 0; i < N; ++i)
+    {
+        // Mix full range values with small ones that share many digits
+        const T v = dist(gen);
+        values.push_back(i % 2 == 0 ? v : static_cast<T>(v % 1000));
+    }
+
+    for (const T v : values)
+    {
+        check_roundtrip(v);
+    }
+    check_order(values);
+}
+
+template <typename T>
+void test_floats()
+{
+    std::mt19937_64 gen(42);
+    std::uniform_int_distribution<std::uint64_t> bits;
+
+    std::vector<T> values {T(0), -T(0), T(1), T(10), T(0.1), T(-0.1), T(0.12), T(0.125), T(-0.12), T(-0.125),
+                           std::numeric_limits<T>::infinity(), -std::numeric_limits<T>::infinity(),
+                           (std::numeric_limits<T>::max)(), std::numeric_limits<T>::lowest(),
+                           (std::numeric_limits<T>::min)(), std::numeric_limits<T>::denorm_min(),
+                           -std::numeric_limits<T>::denorm_min()};
+
+    while (values.size() < N)
+    {
+        // Random bit patterns cover every exponent, and integers check the shared key space
+        T v;
+        const auto b = bits(gen);
+        std::memcpy(&v, &b, sizeof(T));
+        if (std::isfinite(v))
+        {
+            values.push_back(v);
+            values.push_back(static_cast<T>(static_cast<std::int32_t>(b >> 40)));
+        }
+    }
+
+    for (const T v : values)
+    {
+        check_roundtrip(v);
+    }
+    check_roundtrip(std::numeric_limits<T>::quiet_NaN());
+    check_order(values);
+}
+
+int main()
+{
+    test_spot_values();
+    test_parse_errors();
+
+    test_integers<std::int16_t>();
+    test_integers<std::int32_t>();
+    test_integers<std::uint32_t>();
+    test_integers<std::int64_t>();
+    test_integers<std::uint64_t>();
+
+    test_floats<float>();
+    test_floats<double>();
+
+    return boost::report_errors();
+}
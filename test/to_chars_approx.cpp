@@ -0,0 +1,214 @@
+// Copyright 2023 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/charconv.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <system_error>
+#include <random>
+#include <limits>
+#include <string>
+#include <cstring>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cmath>
+#include <iostream>
+
+static constexpr std::size_t N = 1024;
+
+// Splits "-1.25e+03" or "0.00125" into the first digits significant digits (padded with zeros) and the decimal exponent of the first one
+static void split(const std::string& str, int digits, std::uint64_t& q, int& k)
+{
+    q = 0;
+    k = 0;
+    int count = 0;
+    int point = -1;
+    int position = 0;
+    int first_digit = -1;
+    std::size_t i = 0;
+
+    for (; i < str.size() && str[i] != 'e'; ++i)
+    {
+        if (str[i] == '-')
+        {
+            continue;
+        }
+        if (str[i] == '.')
+        {
+            point = position;
+            continue;
+        }
+        if (first_digit < 0 && str[i] != '0')
+        {
+            first_digit = position;
+        }
+        if (first_digit >= 0 && count < digits)
+        {
+            q = q * 10 + static_cast<std::uint64_t>(str[i] - '0');
+            ++count;
+        }
+        ++position;
+    }
+
+    for (; count < digits; ++count)
+    {
+        q *= 10;
+    }
+
+    if (point < 0)
+    {
+        point = position;
+    }
+    k = point - first_digit - 1;
+    if (i < str.size())
+    {
+        k += std::atoi(str.c_str() + i + 1);
+    }
+}
+
+template <typename T>
+void check(T value, int digits)
+{
+    char buffer[64];
+    const auto r = boost::charconv::to_chars_approx(buffer, buffer + sizeof(buffer), value, digits);
+    BOOST_TEST(r.ec == std::errc());
+    const std::string approx(buffer, r.ptr);
+
+    // printf rounds correctly
+    char expected[64];
+    std::snprintf(expected, sizeof(expected), "%.*g", digits, static_cast<double>(value));
+
+    if (approx == expected)
+    {
+        return;
+    }
+
+    std::uint64_t q1;
+    std::uint64_t q2;
+    int k1;
+    int k2;
+    split(approx, digits, q1, k1);
+    split(expected, digits, q2, k2);
+
+    // The last digit may be one off, which can also carry into the exponent
+    const std::uint64_t ten = static_cast<std::uint64_t>(std::pow(10.0, digits - 1));
+    const bool close = (k1 == k2 && (q1 + 1 == q2 || q1 == q2 + 1)) ||
+                       (k1 == k2 + 1 && q1 == ten && q2 == 10 * ten - 1) ||
+                       (k1 + 1 == k2 && q1 == 10 * ten - 1 && q2 == ten);
+
+    if (!BOOST_TEST(close))
+    {
+        std::cerr << "Approx: " << approx << " Expected: " << expected << std::endl; // LCOV_EXCL_LINE
+    }
+
+    // Whatever the digits are, the layout is the one of %g
+    const std::string::size_type e1 = approx.find('e');
+    const std::string::size_type e2 = std::string(expected).find('e');
+    BOOST_TEST((e1 == std::string::npos) == (e2 == std::string::npos) || k1 != k2);
+}
+
+void test_spot_values()
+{
+    const double values[] = {0.0, -0.0, 1.0, -1.0, 0.1, 123.456, -123.456, 9.9996, 99999.5, 0.0001234, 0.00001234,
+                             1e15, 1e16, 1e-300, 1e300, 5e-324, 2.2250738585072014e-308, 1.7976931348623157e308};
+
+    for (const double v : values)
+    {
+        for (int digits = 1; digits <= 17; ++digits)
+        {
+            check(v, digits);
+            check(static_cast<float>(v), digits < 9 ? digits : 9);
+        }
+    }
+
+    char buffer[64];
+    auto r = boost::charconv::to_chars_approx(buffer, buffer + sizeof(buffer), 1234.5678, 6);
+    BOOST_TEST_EQ(std::string(buffer, r.ptr), "1234.57");
+    r = boost::charconv::to_chars_approx(buffer, buffer + sizeof(buffer), -0.000123, 4);
+    BOOST_TEST_EQ(std::string(buffer, r.ptr), "-0.000123");
+    r = boost::charconv::to_chars_approx(buffer, buffer + sizeof(buffer), 1.5e20, 4);
+    BOOST_TEST_EQ(std::string(buffer, r.ptr), "1.5e+20");
+    r = boost::charconv::to_chars_approx(buffer, buffer + sizeof(buffer), 1200.0, 3);
+    BOOST_TEST_EQ(std::string(buffer, r.ptr), "1.2e+03");
+    r = boost::charconv::to_chars_approx(buffer, buffer + sizeof(buffer), 1200.0, 4);
+    BOOST_TEST_EQ(std::string(buffer, r.ptr), "1200");
+
+    // Out of range precisions are clamped
+    r = boost::charconv::to_chars_approx(buffer, buffer + sizeof(buffer), 2.25, 0);
+    BOOST_TEST_EQ(std::string(buffer, r.ptr), "2");
+    r = boost::charconv::to_chars_approx(buffer, buffer + sizeof(buffer), 0.1, 40);
+    BOOST_TEST_EQ(std::string(buffer, r.ptr), "0.10000000000000001");
+
+    // Non-finite values are spelled like to_chars
+    r = boost::charconv::to_chars_approx(buffer, buffer + sizeof(buffer), std::numeric_limits<double>::infinity(), 4);
+    BOOST_TEST_EQ(std::string(buffer, r.ptr), "inf");
+    r = boost::charconv::to_chars_approx(buffer, buffer + sizeof(buffer), -std::numeric_limits<float>::infinity(), 4);
+    BOOST_TEST_EQ(std::string(buffer, r.ptr), "-inf");
+
+    // Too small buffers
+    r = boost::charconv::to_chars_approx(buffer, buffer + 6, 1234.5678, 6);
+    BOOST_TEST(r.ec == std::errc::result_out_of_range);
+    r = boost::charconv::to_chars_approx(buffer, buffer + 7, 1234.5678, 6);
+    BOOST_TEST(r.ec == std::errc());
+    r = boost::charconv::to_chars_approx(buffer, buffer + 6, 1.5e20, 4);
+    BOOST_TEST(r.ec == std::errc::result_out_of_range);
+    r = boost::charconv::to_chars_approx(buffer, buffer, 0.0, 4);
+    BOOST_TEST(r.ec == std::errc::result_out_of_range);
+
+    // Every buffer size up to the length of the longest text
+    r = boost::charconv::to_chars_approx(buffer, buffer + sizeof(buffer), -1.2345678901234567e-300, 17);
+    const auto length = r.ptr - buffer;
+    BOOST_TEST_EQ(length, 24);
+    for (std::ptrdiff_t size = 0; size <= length; ++size)
+    {
+        char small[32];
+        r = boost::charconv::to_chars_approx(small, small + size, -1.2345678901234567e-300, 17);
+        BOOST_TEST(size < length ? r.ec == std::errc::result_out_of_range : r.ec == std::errc());
+    }
+}
+
+template <typename T>
+void test_random()
+{
+    std::mt19937_64 gen(42);
+    std::uniform_int_distribution<std::uint64_t> bits;
+    constexpr int max_digits = std::numeric_limits<T>::max_digits10;
+
+    for (std::size_t i = 0; i < N * 16; ++i)
+    {
+        const auto b = bits(gen);
+        T v;
+        std::memcpy(&v, &b, sizeof(T));
+        if (!std::isfinite(v))
+        {
+            continue;
+        }
+
+        check(v, static_cast<int>(i % max_digits) + 1);
+    }
+}
+
+// Logging usually prints values of moderate size with few digits
+void test_telemetry()
+{
+    std::mt19937_64 gen(42);
+    std::uniform_real_distribution<double> dist(-1e6, 1e6);
+
+    for (std::size_t i = 0; i < N * 16; ++i)
+    {
+        const double v = dist(gen) * std::pow(10.0, static_cast<int>(i % 12) - 8);
+        check(v, 4 + static_cast<int>(i % 4));
+        check(static_cast<float>(v), 4 + static_cast<int>(i % 4));
+    }
+}
+
+int main()
+{
+    test_spot_values();
+    test_random<float>();
+    test_random<double>();
+    test_telemetry();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,261 @@
+// Copyright 2023 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/charconv/grouping.hpp>
+#include <boost/charconv.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <system_error>
+#include <random>
+#include <limits>
+#include <string>
+#include <cstring>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cmath>
+#include <iostream>
+
+static constexpr std::size_t N = 1024;
+
+// Groups the integer digits of a plain number like "-1234567.89"
+std::string group(const std::string& plain, char separator, int group_size, char decimal_point)
+{
+    const std::size_t begin = plain[0] == '-' ? 1 : 0;
+    std::size_t end = plain.find('.');
+    if (end == std::string::npos)
+    {
+        end = plain.size();
+    }
+
+    std::string str = plain.substr(0, begin);
+    for (std::size_t i = begin; i < end; ++i)
+    {
+        if (i != begin && group_size > 0 && (end - i) % static_cast<std::size_t>(group_size) == 0)
+        {
+            str += separator;
+        }
+        str += plain[i];
+    }
+    if (end != plain.size())
+    {
+        str += decimal_point;
+        str += plain.substr(end + 1);
+    }
+    return str;
+}
+
+template <typename T>
+void check(T value, const std::string& expected, char separator = ',', int group_size = 3)
+{
+    char buffer[64];
+    auto r = boost::charconv::to_chars_grouped(buffer, buffer + sizeof(buffer), value, separator, group_size);
+    BOOST_TEST(r.ec == std::errc());
+    if (!BOOST_TEST_EQ(std::string(buffer, r.ptr), expected))
+    {
+        std::cerr << "Value: " << +value << std::endl; // LCOV_EXCL_LINE
+    }
+
+    // Exactly enough room, and one less
+    const auto size = static_cast<std::size_t>(r.ptr - buffer);
+    r = boost::charconv::to_chars_grouped(buffer, buffer + size, value, separator, group_size);
+    BOOST_TEST(r.ec == std::errc() && r.ptr == buffer + size);
+    r = boost::charconv::to_chars_grouped(buffer, buffer + size - 1, value, separator, group_size);
+    BOOST_TEST(r.ec == std::errc::result_out_of_range && r.ptr == buffer + size - 1);
+}
+
+template <typename T>
+void check(T value, int precision, const std::string& expected, char separator = ',', int group_size = 3, char decimal_point = '.')
+{
+    char buffer[1024];
+    auto r = boost::charconv::to_chars_grouped(buffer, buffer + sizeof(buffer), value, precision, separator, group_size, decimal_point);
+    BOOST_TEST(r.ec == std::errc());
+    if (!BOOST_TEST_EQ(std::string(buffer, r.ptr), expected))
+    {
+        std::cerr << "Value: " << value << ", precision: " << precision << std::endl; // LCOV_EXCL_LINE
+    }
+
+    const auto size = static_cast<std::size_t>(r.ptr - buffer);
+    r = boost::charconv::to_chars_grouped(buffer, buffer + size - 1, value, precision, separator, group_size, decimal_point);
+    BOOST_TEST(r.ec == std::errc::result_out_of_range && r.ptr == buffer + size - 1);
+}
+
+void test_integer_spot_values()
+{
+    check(0, "0");
+    check(7, "7");
+    check(999, "999");
+    check(1000, "1,000");
+    check(-1000, "-1,000");
+    check(123456, "123,456");
+    check(1234567, "1,234,567");
+    check(-12345678, "-12,345,678");
+    check((std::numeric_limits<std::int64_t>::min)(), "-9,223,372,036,854,775,808");
+    check((std::numeric_limits<std::uint64_t>::max)(), "18,446,744,073,709,551,615");
+    check((std::numeric_limits<signed char>::min)(), "-128");
+    check(static_cast<unsigned short>(65535), "65,535");
+
+    check(1234567, "1.234.567", '.');
+    check(1234567, "1 234 567", ' ');
+    check(1234567, "1'234'567", '\'');
+    check(123456789, "1,23,45,67,89", ',', 2);
+    check(123456789, "1,2345,6789", ',', 4);
+    check(123456789, "1,2,3,4,5,6,7,8,9", ',', 1);
+    check(123456789, "123456789", ',', 0);
+    check(-123456789, "-123456789", ',', -1);
+}
+
+template <typename T>
+void test_integer_random()
+{
+    std::mt19937_64 gen(42);
+    std::uniform_int_distribution<T> dist((std::numeric_limits<T>::min)(), (std::numeric_limits<T>::max)());
+
+    for (std::size_t i = 0; i < N * 4; ++i)
+    {
+        // Values of every length
+        T value = dist(gen);
+        if (i % 2 == 0)
+        {
+            value = static_cast<T>(value >> (i % (sizeof(T) * 8)));
+        }
+
+        const std::string plain = std::to_string(value);
+        for (int group_size = 0; group_size <= 5; ++group_size)
+        {
+            check(value, group(plain, ',', group_size, '.'), ',', group_size);
+        }
+    }
+}
+
+void test_float_spot_values()
+{
+    check(1234567.89, 2, "1,234,567.89");
+    check(1234567.89, 2, "1.234.567,89", '.', 3, ',');
+    check(1234567.89, 0, "1,234,568");
+    check(1234567.89, -1, "1,234,567.89");
+    check(-1234.5, 3, "-1,234.500");
+    check(999.999, 2, "1,000.00");
+    check(0.001, -1, "0.001");
+    check(0.001, 5, "0.00100");
+    check(1e-7, -1, "0.0000001");
+    check(1e21, -1, "1,000,000,000,000,000,000,000");
+    check(1e23, 0, "99,999,999,999,999,991,611,392");
+    check(1e23, -1, "100,000,000,000,000,000,000,000");
+    check(0.0, -1, "0");
+    check(-0.0, -1, "-0");
+    check(0.0, 2, "0.00");
+    check(-0.0, 2, "-0.00");
+    check(0.5, 0, "0");
+    check(1.5, 0, "2");
+    check(2.5, 0, "2");
+    check(0.004, 2, "0.00");
+    check(0.006, 2, "0.01");
+    check(-0.006, 2, "-0.01");
+    check(0.0005, 2, "0.00");
+    check(12345.678F, 1, "12,345.7");
+    check(12345.678F, -1, "12,345.678");
+    check(16777216.0F, -1, "16,777,216");
+    check(1e10F, -1, "10,000,000,000");
+    check(std::numeric_limits<double>::denorm_min(), 330, "0." + std::string(323, '0') + "4940656");
+    check(std::numeric_limits<double>::infinity(), 2, "inf");
+    check(-std::numeric_limits<double>::infinity(), -1, "-inf");
+    check(std::numeric_limits<double>::quiet_NaN(), 2, "nan");
+}
+
+// The digits and exponent of the shortest representation, laid out in fixed notation
+template <typename T>
+std::string shortest_fixed(T value)
+{
+    char buffer[64];
+    const auto r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), value, boost::charconv::chars_format::scientific);
+    const std::string sci(buffer, r.ptr);
+
+    const std::size_t begin = sci[0] == '-' ? 1 : 0;
+    const auto e = sci.find('e');
+    std::string digits;
+    for (std::size_t i = begin; i < e; ++i)
+    {
+        if (sci[i] != '.')
+        {
+            digits += sci[i];
+        }
+    }
+    const int exponent = std::atoi(sci.c_str() + e + 1);
+    const int count = static_cast<int>(digits.size());
+
+    std::string str = sci.substr(0, begin);
+    if (exponent < 0)
+    {
+        str += "0." + std::string(static_cast<std::size_t>(-exponent - 1), '0') + digits;
+    }
+    else if (exponent + 1 >= count)
+    {
+        str += digits + std::string(static_cast<std::size_t>(exponent + 1 - count), '0');
+    }
+    else
+    {
+        str += digits.substr(0, static_cast<std::size_t>(exponent + 1)) + "." + digits.substr(static_cast<std::size_t>(exponent + 1));
+    }
+    return str;
+}
+
+template <typename T>
+void test_float_random()
+{
+    using unsigned_type = typename std::conditional<sizeof(T) == 4, std::uint32_t, std::uint64_t>::type;
+
+    std::mt19937_64 gen(42);
+    std::uniform_int_distribution<unsigned_type> bits;
+    std::uniform_real_distribution<double> prices(0, 1e9);
+
+    for (std::size_t i = 0; i < N * 8; ++i)
+    {
+        T value;
+        if (i % 2 == 0)
+        {
+            const auto b = bits(gen);
+            std::memcpy(&value, &b, sizeof(T));
+            if (!std::isfinite(value))
+            {
+                continue;
+            }
+        }
+        else
+        {
+            value = static_cast<T>(std::round(prices(gen)) / 100);
+        }
+
+        check(value, -1, group(shortest_fixed(value), ',', 3, '.'));
+
+        const int precision = static_cast<int>(i % 24);
+        char buffer[1024];
+        std::snprintf(buffer, sizeof(buffer), "%.*f", precision, static_cast<double>(value));
+        check(value, precision, group(buffer, ' ', 3, ','), ' ', 3, ',');
+    }
+
+    // Values near the rounding boundaries of small precisions
+    for (std::size_t i = 0; i < N; ++i)
+    {
+        const int precision = static_cast<int>(i % 6);
+        const T value = static_cast<T>((static_cast<double>(gen() % 2000) + 0.5) * std::pow(10.0, -precision - static_cast<int>(i % 3)));
+        char buffer[128];
+        std::snprintf(buffer, sizeof(buffer), "%.*f", precision, static_cast<double>(value));
+        check(value, precision, group(buffer, ',', 3, '.'));
+    }
+}
+
+int main()
+{
+    test_integer_spot_values();
+    test_integer_random<int>();
+    test_integer_random<unsigned>();
+    test_integer_random<long long>();
+    test_integer_random<unsigned long long>();
+
+    test_float_spot_values();
+    test_float_random<float>();
+    test_float_random<double>();
+
+    return boost::report_errors();
+}
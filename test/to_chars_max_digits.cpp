@@ -0,0 +1,183 @@
+// Copyright 2023 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/charconv.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <system_error>
+#include <random>
+#include <limits>
+#include <string>
+#include <cstring>
+#include <cstdint>
+#include <cstdio>
+#include <cmath>
+#include <iostream>
+
+static constexpr std::size_t N = 1024;
+
+template <typename T>
+void check(T value, int max_digits, const std::string& expected, boost::charconv::chars_format fmt = boost::charconv::chars_format::general)
+{
+    char buffer[64];
+    auto r = boost::charconv::to_chars_max_digits(buffer, buffer + sizeof(buffer), value, max_digits, fmt);
+    BOOST_TEST(r.ec == std::errc());
+    if (!BOOST_TEST_EQ(std::string(buffer, r.ptr), expected))
+    {
+        std::cerr << "Value: " << value << ", max digits: " << max_digits << std::endl; // LCOV_EXCL_LINE
+    }
+}
+
+template <typename T>
+void check_styled(T value, int max_digits, const std::string& expected)
+{
+    char buffer[64];
+    auto r = boost::charconv::to_chars_max_digits(buffer, buffer + sizeof(buffer), value, max_digits, boost::charconv::shortest_style::javascript());
+    BOOST_TEST(r.ec == std::errc());
+    if (!BOOST_TEST_EQ(std::string(buffer, r.ptr), expected))
+    {
+        std::cerr << "Value: " << value << ", max digits: " << max_digits << std::endl; // LCOV_EXCL_LINE
+    }
+
+    // One character short
+    const auto size = static_cast<std::size_t>(r.ptr - buffer);
+    r = boost::charconv::to_chars_max_digits(buffer, buffer + size - 1, value, max_digits, boost::charconv::shortest_style::javascript());
+    BOOST_TEST(r.ec == std::errc::result_out_of_range);
+}
+
+void test_spot_values()
+{
+    check_styled(0.30000000000000004, 6, "0.3");
+    check_styled(0.30000000000000004, 17, "0.30000000000000004");
+    check_styled(0.1, 6, "0.1");
+    check_styled(-2.0 / 3, 6, "-0.666667");
+    check_styled(123456.789, 4, "123500");
+    check_styled(9.9996, 4, "10");
+    check_styled(-9.9996, 4, "-10");
+    check_styled(999999.5, 6, "1000000");
+    check_styled(1e300 / 3, 3, "3.33e+299");
+    check_styled(1.5, 0, "2");
+
+    // Shortest digits that end exactly halfway are rounded by the value they stand for
+    check_styled(0.15, 1, "0.1"); // 0.1499999999999999944...
+    check_styled(0.25, 1, "0.2"); // Exactly halfway, to even
+    check_styled(0.35, 1, "0.3"); // 0.3499999999999999777...
+    check_styled(0.45, 1, "0.5"); // 0.4500000000000000111...
+    check_styled(2.675, 3, "2.67"); // 2.6749999999999998223...
+    check_styled(1.0000000000000002, 16, "1");
+    check_styled(4.9406564584124654e-324, 1, "5e-324");
+    check_styled(1.2345e-320, 4, "1.235e-320"); // Subnormal 1.23467...e-320
+    check_styled(0.15F, 1, "0.2"); // 0.1500000059604644775...
+
+    check_styled(0.0, 3, "0");
+    check_styled(std::numeric_limits<double>::infinity(), 3, "Infinity");
+
+    // The layouts of to_chars
+    check(0.30000000000000004, 6, "3e-01");
+    check(123456.789, 4, "123500");
+    check(123456.789, 4, "1.235e+05", boost::charconv::chars_format::scientific);
+    check(1.25, 2, "1.2");
+    check(1.35, 2, "1.4", boost::charconv::chars_format::fixed);
+    check(123456789012345678.0, 3, "123000000000000000");
+    check(1.2345678e25, 3, "1.23e+25");
+    check(1.2345678e25F, 3, "1.23e+25");
+    check(5000000000.0F, 3, "5e+09");
+
+    // Integers written by to_chars in full only when all of their digits fit
+    check(1152921504606846976.0, 15, "1152921504606850000");
+    check(1152921504606846976.0, 16, "1152921504606847000");
+    check(1152921504606846976.0, 19, "1152921504606846976");
+    check(2020269952.0F, 7, "2020270000");
+    check(2020269952.0F, 10, "2020269952");
+    check(1.5, 1, "1.8p+0", boost::charconv::chars_format::hex);
+    check(-0.0, 1, "-0");
+    check(-std::numeric_limits<double>::infinity(), 1, "-inf");
+}
+
+// printf rounds the exact value, so its digits are the correctly rounded ones
+template <typename T>
+void check_random(T value, int max_digits)
+{
+    char buffer[64];
+    auto r = boost::charconv::to_chars_max_digits(buffer, buffer + sizeof(buffer), value, max_digits, boost::charconv::chars_format::scientific);
+    BOOST_TEST(r.ec == std::errc());
+    const std::string str(buffer, r.ptr);
+
+    std::string expected;
+    char shortest[64];
+    const auto r2 = boost::charconv::to_chars(shortest, shortest + sizeof(shortest), value, boost::charconv::chars_format::scientific);
+    const auto e = std::string(shortest, r2.ptr).find('e');
+    const auto digits = e - (std::signbit(value) ? 1 : 0) - (e > 2 ? 1 : 0);
+
+    if (static_cast<int>(digits) <= max_digits)
+    {
+        expected.assign(shortest, r2.ptr);
+    }
+    else
+    {
+        std::snprintf(buffer, sizeof(buffer), "%.*e", max_digits - 1, static_cast<double>(value));
+        expected = buffer;
+
+        // Remove the trailing zeros of the digits, and the decimal point if none are left
+        const auto exp = expected.find('e');
+        auto end = exp;
+        while (expected[end - 1] == '0')
+        {
+            --end;
+        }
+        if (expected[end - 1] == '.')
+        {
+            --end;
+        }
+        expected.erase(end, exp - end);
+    }
+
+    if (!BOOST_TEST_EQ(str, expected))
+    {
+        std::cerr << "Shortest: " << std::string(shortest, r2.ptr) << ", max digits: " << max_digits << std::endl; // LCOV_EXCL_LINE
+    }
+}
+
+template <typename T>
+void test_random()
+{
+    using unsigned_type = typename std::conditional<sizeof(T) == 4, std::uint32_t, std::uint64_t>::type;
+
+    std::mt19937_64 gen(42);
+    std::uniform_int_distribution<unsigned_type> bits;
+
+    for (std::size_t i = 0; i < N * 16; ++i)
+    {
+        auto b = bits(gen);
+        if (i % 4 == 0)
+        {
+            b >>= i % (sizeof(T) * 8);
+        }
+
+        T value;
+        std::memcpy(&value, &b, sizeof(T));
+        if (!std::isfinite(value) || value == 0)
+        {
+            continue;
+        }
+
+        check_random(value, static_cast<int>(i % std::numeric_limits<T>::max_digits10) + 1);
+    }
+
+    // Short decimals with a trailing 5, where the shortest digits are often exactly halfway
+    for (std::size_t i = 0; i < N * 4; ++i)
+    {
+        const int digits = static_cast<int>(i % 6) + 2;
+        const T value = static_cast<T>(static_cast<double>(gen() % 100000000 * 10 + 5) * std::pow(10.0, -static_cast<int>(i % 12)));
+        check_random(value, digits);
+    }
+}
+
+int main()
+{
+    test_spot_values();
+    test_random<float>();
+    test_random<double>();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,112 @@
+// Copyright 2023 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/charconv.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <system_error>
+#include <limits>
+#include <string>
+#include <cstring>
+
+template <typename T>
+std::string styled(T value, const boost::charconv::shortest_style& style)
+{
+    char buffer[64];
+    auto r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), value, style);
+    BOOST_TEST(r.ec == std::errc());
+    return std::string(buffer, r.ptr);
+}
+
+void test_javascript()
+{
+    const auto js = boost::charconv::shortest_style::javascript();
+
+    BOOST_TEST_EQ(styled(1e21, js), "1e+21");
+    BOOST_TEST_EQ(styled(1e20, js), "100000000000000000000");
+    BOOST_TEST_EQ(styled(1.5e21, js), "1.5e+21");
+    BOOST_TEST_EQ(styled(1e-7, js), "1e-7");
+    BOOST_TEST_EQ(styled(1.5e-7, js), "1.5e-7");
+    BOOST_TEST_EQ(styled(0.000001, js), "0.000001");
+    BOOST_TEST_EQ(styled(123.456, js), "123.456");
+    BOOST_TEST_EQ(styled(-123.456, js), "-123.456");
+    BOOST_TEST_EQ(styled(0.1, js), "0.1");
+    BOOST_TEST_EQ(styled(42.0, js), "42");
+    BOOST_TEST_EQ(styled(5e-324, js), "5e-324");
+    BOOST_TEST_EQ(styled(1.7976931348623157e308, js), "1.7976931348623157e+308");
+    BOOST_TEST_EQ(styled(0.0, js), "0");
+    BOOST_TEST_EQ(styled(-0.0, js), "0");
+    BOOST_TEST_EQ(styled(0.1F, js), "0.1");
+    BOOST_TEST_EQ(styled(std::numeric_limits<double>::infinity(), js), "Infinity");
+    BOOST_TEST_EQ(styled(-std::numeric_limits<double>::infinity(), js), "-Infinity");
+    BOOST_TEST_EQ(styled(std::numeric_limits<double>::quiet_NaN(), js), "NaN");
+}
+
+void test_python()
+{
+    const auto py = boost::charconv::shortest_style::python();
+
+    BOOST_TEST_EQ(styled(1e16, py), "1e+16");
+    BOOST_TEST_EQ(styled(1e15, py), "1000000000000000.0");
+    BOOST_TEST_EQ(styled(0.0001, py), "0.0001");
+    BOOST_TEST_EQ(styled(1e-05, py), "1e-05");
+    BOOST_TEST_EQ(styled(1.5e-5, py), "1.5e-05");
+    BOOST_TEST_EQ(styled(1e300, py), "1e+300");
+    BOOST_TEST_EQ(styled(2.5, py), "2.5");
+    BOOST_TEST_EQ(styled(3.0, py), "3.0");
+    BOOST_TEST_EQ(styled(0.0, py), "0.0");
+    BOOST_TEST_EQ(styled(-0.0, py), "-0.0");
+    BOOST_TEST_EQ(styled(std::numeric_limits<float>::infinity(), py), "inf");
+    BOOST_TEST_EQ(styled(-std::numeric_limits<float>::infinity(), py), "-inf");
+    BOOST_TEST_EQ(styled(std::numeric_limits<float>::quiet_NaN(), py), "nan");
+}
+
+void test_custom()
+{
+    const boost::charconv::shortest_style style {0, 3, 3, false, false, true, boost::charconv::nonfinite_style::null};
+
+    BOOST_TEST_EQ(styled(12.5, style), "12.5");
+    BOOST_TEST_EQ(styled(1250.0, style), "1.25e003");
+    BOOST_TEST_EQ(styled(0.125, style), "1.25e-001");
+    BOOST_TEST_EQ(styled(-0.0, style), "-0");
+    BOOST_TEST_EQ(styled(std::numeric_limits<double>::infinity(), style), "null");
+}
+
+void test_errors()
+{
+    char buffer[64];
+
+    const auto json = boost::charconv::shortest_style::json();
+    auto r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), std::numeric_limits<double>::infinity(), json);
+    BOOST_TEST(r.ec == std::errc::invalid_argument);
+    r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), std::numeric_limits<double>::quiet_NaN(), json);
+    BOOST_TEST(r.ec == std::errc::invalid_argument);
+
+    // Every prefix of the buffer that is too short must be rejected
+    const auto py = boost::charconv::shortest_style::python();
+    const double values[] = {1e15, 1.5e-5, -0.0, 123.456, 0.0001};
+    for (const double value : values)
+    {
+        const auto expected = styled(value, py);
+        for (std::size_t i = 0; i < expected.size(); ++i)
+        {
+            r = boost::charconv::to_chars(buffer, buffer + i, value, py);
+            BOOST_TEST(r.ec == std::errc::result_out_of_range);
+        }
+    }
+
+    r = boost::charconv::to_chars(buffer, buffer + 3, std::numeric_limits<double>::infinity(), py);
+    BOOST_TEST_CSTR_EQ(std::string(buffer, r.ptr).c_str(), "inf");
+    r = boost::charconv::to_chars(buffer, buffer + 2, std::numeric_limits<double>::infinity(), py);
+    BOOST_TEST(r.ec == std::errc::result_out_of_range);
+}
+
+int main()
+{
+    test_javascript();
+    test_python();
+    test_custom();
+    test_errors();
+
+    return boost::report_errors();
+}
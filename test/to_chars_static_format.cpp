@@ -0,0 +1,102 @@
+// Copyright 2023 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/charconv.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <system_error>
+#include <random>
+#include <limits>
+#include <string>
+#include <iostream>
+#include <cstring>
+
+using boost::charconv::chars_format;
+
+template <chars_format Fmt, int Precision, typename T>
+void check(T value)
+{
+    char buffer1[1024];
+    char buffer2[1024];
+
+    const auto r1 = boost::charconv::to_chars(buffer1, buffer1 + sizeof(buffer1), value, Fmt, Precision);
+    const auto r2 = boost::charconv::to_chars<Fmt, Precision>(buffer2, buffer2 + sizeof(buffer2), value);
+
+    BOOST_TEST(r1.ec == r2.ec);
+    if (!BOOST_TEST_EQ(std::string(buffer1, r1.ptr), std::string(buffer2, r2.ptr)))
+    {
+        std::cerr << "Format: " << static_cast<unsigned>(Fmt) << " Precision: " << Precision << std::endl; // LCOV_EXCL_LINE
+    }
+
+    // Buffers smaller than the worst case give the same result as the runtime overload
+    const auto length = r1.ptr - buffer1;
+    const auto r3 = boost::charconv::to_chars(buffer1, buffer1 + length, value, Fmt, Precision);
+    const auto r4 = boost::charconv::to_chars<Fmt, Precision>(buffer2, buffer2 + length, value);
+    BOOST_TEST(r3.ec == r4.ec);
+    if (r3.ec == std::errc())
+    {
+        BOOST_TEST_EQ(std::string(buffer1, r3.ptr), std::string(buffer2, r4.ptr));
+    }
+}
+
+template <typename T>
+void check_all(T value)
+{
+    check<chars_format::general, -1>(value);
+    check<chars_format::fixed, -1>(value);
+    check<chars_format::scientific, -1>(value);
+    check<chars_format::hex, -1>(value);
+
+    check<chars_format::general, 0>(value);
+    check<chars_format::general, 6>(value);
+    check<chars_format::fixed, 3>(value);
+    check<chars_format::scientific, 0>(value);
+    check<chars_format::scientific, 3>(value);
+    check<chars_format::scientific, 17>(value);
+    check<chars_format::scientific, 50>(value);
+    check<chars_format::hex, 4>(value);
+}
+
+template <typename T>
+void test()
+{
+    const T specials[] = {T(0), -T(0), T(1), T(-1.5), T(0.1), T(123456789), std::numeric_limits<T>::infinity(),
+                          -std::numeric_limits<T>::infinity(), (std::numeric_limits<T>::max)(),
+                          (std::numeric_limits<T>::min)(), std::numeric_limits<T>::denorm_min()};
+
+    for (const T value : specials)
+    {
+        check_all(value);
+    }
+
+    std::mt19937_64 gen(42);
+    std::uniform_real_distribution<T> dist(0, 1);
+
+    for (int i = 0; i < 1024; ++i)
+    {
+        const T exp = static_cast<T>(i % 60 - 30);
+        check_all(dist(gen) * std::pow(T(10), exp));
+    }
+}
+
+int main()
+{
+    test<float>();
+    test<double>();
+
+    // Types without a dedicated engine forward to the runtime overload
+    for (const long double value : {1.5L, -123.456L, 1e300L})
+    {
+        check<chars_format::general, -1>(value);
+        check<chars_format::scientific, -1>(value);
+        check<chars_format::scientific, 3>(value);
+        check<chars_format::fixed, 2>(value);
+    }
+
+    // Integral overloads are unaffected
+    char buffer[64];
+    const auto r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), 42);
+    BOOST_TEST_EQ(std::string(buffer, r.ptr), "42");
+
+    return boost::report_errors();
+}
@@ -0,0 +1,140 @@
+// Copyright 2023 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/charconv/to_string.hpp>
+#include <boost/charconv/from_chars.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <system_error>
+#include <type_traits>
+#include <random>
+#include <limits>
+#include <string>
+#include <sstream>
+#include <cstring>
+
+template <typename T>
+void test_integer()
+{
+    using string_type = decltype(boost::charconv::to_string(T()));
+    static_assert(string_type::static_capacity == static_cast<std::size_t>(boost::charconv::limits<T>::max_chars10), "Wrong capacity");
+
+    BOOST_TEST_EQ(boost::charconv::to_string(T(0)), "0");
+    BOOST_TEST_EQ(boost::charconv::to_string(T(42)), "42");
+    BOOST_TEST_EQ(boost::charconv::to_string((std::numeric_limits<T>::max)()), std::to_string((std::numeric_limits<T>::max)()));
+    BOOST_TEST_EQ(boost::charconv::to_string((std::numeric_limits<T>::min)()), std::to_string((std::numeric_limits<T>::min)()));
+
+    std::mt19937_64 gen(42);
+    std::uniform_int_distribution<T> dist((std::numeric_limits<T>::min)(), (std::numeric_limits<T>::max)());
+
+    std::string appended = "x";
+    std::string expected = "x";
+    for (int i = 0; i < 1024; ++i)
+    {
+        const T v = dist(gen);
+        const auto str = boost::charconv::to_string(v);
+        BOOST_TEST_EQ(str, std::to_string(v));
+        BOOST_TEST_EQ(std::strlen(str.c_str()), str.size());
+
+        boost::charconv::append_to(appended, v);
+        expected += std::to_string(v);
+    }
+    BOOST_TEST_EQ(appended, expected);
+
+    std::string hex;
+    BOOST_TEST_EQ(boost::charconv::append_to(hex, T(127), 16), "7f");
+    BOOST_TEST_EQ(boost::charconv::append_to(hex, T(5), 2), "7f101");
+}
+
+template <typename T>
+void test_float()
+{
+    BOOST_TEST_EQ(boost::charconv::to_string(T(0)), "0");
+    BOOST_TEST_EQ(boost::charconv::to_string(T(-1.5)), "-1.5");
+    BOOST_TEST_EQ(boost::charconv::to_string(std::numeric_limits<T>::infinity()), "inf");
+    BOOST_TEST_EQ(boost::charconv::to_string(-std::numeric_limits<T>::infinity()), "-inf");
+
+    const T extremes[] = {(std::numeric_limits<T>::max)(), (std::numeric_limits<T>::min)(), std::numeric_limits<T>::lowest(),
+                          std::numeric_limits<T>::denorm_min(), -std::numeric_limits<T>::denorm_min()};
+    for (const T v : extremes)
+    {
+        const auto str = boost::charconv::to_string(v);
+        T round_trip {};
+        const auto r = boost::charconv::from_chars(str.data(), str.data() + str.size(), round_trip);
+        BOOST_TEST(r.ec == std::errc());
+        BOOST_TEST_EQ(v, round_trip);
+    }
+
+    std::mt19937_64 gen(42);
+    std::uniform_real_distribution<T> dist(-1e10, 1e10);
+
+    std::string appended;
+    for (int i = 0; i < 1024; ++i)
+    {
+        const T v = dist(gen);
+        const auto str = boost::charconv::to_string(v);
+
+        char buffer[64];
+        const auto r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), v);
+        BOOST_TEST_EQ(str, std::string(buffer, r.ptr));
+
+        appended.clear();
+        boost::charconv::append_to(appended, v);
+        BOOST_TEST_EQ(appended, str.str());
+
+        appended.clear();
+        boost::charconv::append_to(appended, v, boost::charconv::chars_format::scientific, 3);
+        const auto r2 = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), v, boost::charconv::chars_format::scientific, 3);
+        BOOST_TEST_EQ(appended, std::string(buffer, r2.ptr));
+    }
+
+    // Precisions far beyond the default bound
+    appended = "[";
+    boost::charconv::append_to(appended, T(1), boost::charconv::chars_format::scientific, 500);
+    BOOST_TEST_EQ(appended.size(), 1U + 506U);
+    BOOST_TEST_EQ(appended.substr(appended.size() - 4), "e+00");
+}
+
+void test_inline_string()
+{
+    const auto str = boost::charconv::to_string(12345);
+    BOOST_TEST(!str.empty());
+    BOOST_TEST_EQ(str.length(), 5U);
+    BOOST_TEST_EQ(str[0], '1');
+    BOOST_TEST_EQ(std::string(str.begin(), str.end()), "12345");
+    BOOST_TEST(str == boost::charconv::to_string(12345LL));
+    BOOST_TEST(str != boost::charconv::to_string(1234));
+    BOOST_TEST(str != "1234");
+
+    const std::string converted = str;
+    BOOST_TEST_EQ(converted, "12345");
+
+    std::ostringstream os;
+    os << str;
+    BOOST_TEST_EQ(os.str(), "12345");
+
+    boost::charconv::inline_string<4> empty;
+    BOOST_TEST(empty.empty());
+    BOOST_TEST_EQ(empty.c_str()[0], '\0');
+}
+
+int main()
+{
+    test_integer<signed char>();
+    test_integer<unsigned char>();
+    test_integer<short>();
+    test_integer<unsigned short>();
+    test_integer<int>();
+    test_integer<unsigned>();
+    test_integer<long>();
+    test_integer<unsigned long>();
+    test_integer<long long>();
+    test_integer<unsigned long long>();
+
+    test_float<float>();
+    test_float<double>();
+
+    test_inline_string();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,193 @@
+// Copyright 2023 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/charconv/writer.hpp>
+#include <boost/charconv/to_chars.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <system_error>
+#include <random>
+#include <limits>
+#include <string>
+#include <vector>
+#include <cstdio>
+#include <cstring>
+
+#ifndef _WIN32
+#  include <unistd.h>
+#endif
+
+struct collector
+{
+    std::string out;
+    std::size_t calls = 0;
+    bool fail = false;
+};
+
+static bool collect(void* context, const char* data, std::size_t size)
+{
+    auto* c = static_cast<collector*>(context);
+    ++c->calls;
+    c->out.append(data, size);
+    return !c->fail;
+}
+
+template <typename T>
+std::string expected_chars(T value)
+{
+    char buffer[64];
+    const auto r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), value);
+    return std::string(buffer, r.ptr);
+}
+
+void test_callback(std::size_t buffer_size)
+{
+    collector c;
+    std::string expected;
+
+    {
+        std::vector<char> buffer(buffer_size);
+        boost::charconv::writer w(collect, &c, buffer.data(), buffer.size());
+
+        std::mt19937_64 gen(42);
+        for (int i = 0; i < 1000; ++i)
+        {
+            const auto u = gen();
+            const auto d = static_cast<double>(u) / 3.0;
+            const auto f = static_cast<float>(u % 10000) / 7.0F;
+            const auto s = static_cast<int>(u);
+
+            w.write(u).put(' ').write(d).put(' ').write(f).put(' ').write(s).write("\n");
+            expected += expected_chars(u) + ' ' + expected_chars(d) + ' ' + expected_chars(f) + ' ' + expected_chars(s) + '\n';
+        }
+
+        w.write(255, 16).put(',').write(1.5, boost::charconv::chars_format::scientific, 3);
+        expected += "ff,1.500e+00";
+
+        BOOST_TEST(w.error() == std::errc());
+    }
+
+    BOOST_TEST_EQ(c.out, expected);
+}
+
+void test_range()
+{
+    collector c;
+    std::vector<double> values;
+    std::string expected;
+
+    std::mt19937_64 gen(42);
+    std::uniform_real_distribution<double> dist(-1e300, 1e300);
+    for (int i = 0; i < 5000; ++i)
+    {
+        values.push_back(dist(gen));
+        expected += expected_chars(values.back()) + ',';
+    }
+
+    boost::charconv::writer w(collect, &c, 1024);
+    w.write_range(values.begin(), values.end(), ',');
+    BOOST_TEST(w.flush() == std::errc());
+    BOOST_TEST_EQ(c.out, expected);
+    BOOST_TEST(c.calls > 100);
+
+    // Checking the space once per block must never overrun
+    const std::vector<int> ints {1, -2, 300, (std::numeric_limits<int>::min)()};
+    c.out.clear();
+    w.write_range(ints.begin(), ints.end(), ' ');
+    w.flush();
+    BOOST_TEST_EQ(c.out, "1 -2 300 " + std::to_string((std::numeric_limits<int>::min)()) + ' ');
+}
+
+void test_large_pieces()
+{
+    collector c;
+    boost::charconv::writer w(collect, &c, 64);
+
+    const std::string big(1000, 'x');
+    w.write(42).write(big.c_str(), big.size()).write(7);
+    w.flush();
+
+    BOOST_TEST_EQ(c.out, "42" + big + "7");
+    BOOST_TEST_EQ(c.calls, 3U);
+}
+
+void test_errors()
+{
+    collector c;
+    c.fail = true;
+
+    {
+        boost::charconv::writer w(collect, &c, 32);
+        for (int i = 0; i < 100; ++i)
+        {
+            w.write(i);
+        }
+        BOOST_TEST(w.error() == std::errc::io_error);
+        BOOST_TEST_EQ(c.calls, 1U);
+    }
+    BOOST_TEST_EQ(c.calls, 1U);
+
+    collector tiny;
+    boost::charconv::writer w(collect, &tiny, 4);
+    w.write(123456789);
+    BOOST_TEST(w.error() == std::errc::value_too_large);
+
+    collector base;
+    boost::charconv::writer w2(collect, &base, 64);
+    w2.write(42, 99);
+    BOOST_TEST(w2.error() == std::errc::invalid_argument);
+}
+
+#ifndef _WIN32
+void test_file_descriptor()
+{
+    std::FILE* file = std::tmpfile();
+    BOOST_TEST(file != nullptr);
+    if (file == nullptr)
+    {
+        return; // LCOV_EXCL_LINE
+    }
+
+    std::string expected;
+    {
+        boost::charconv::writer w(::fileno(file), 100);
+        for (int i = 0; i < 1000; ++i)
+        {
+            w.write(i * 1.25).put('\n');
+            expected += expected_chars(i * 1.25) + '\n';
+        }
+
+        const std::string big(500, 'y');
+        w.write(big.c_str(), big.size());
+        expected += big;
+    }
+
+    std::rewind(file);
+    std::string contents;
+    char buffer[256];
+    std::size_t n;
+    while ((n = std::fread(buffer, 1, sizeof(buffer), file)) != 0)
+    {
+        contents.append(buffer, n);
+    }
+    std::fclose(file);
+
+    BOOST_TEST_EQ(contents, expected);
+}
+#endif
+
+int main()
+{
+    test_callback(64);
+    test_callback(1000);
+    test_callback(boost::charconv::writer::default_buffer_size);
+    test_range();
+    test_large_pieces();
+    test_errors();
+
+    #ifndef _WIN32
+    test_file_descriptor();
+    #endif
+
+    return boost::report_errors();
+}
@@ -0,0 +1,820 @@
+// Copyright 2023 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// Replays a file of real inputs through the conversions, reports their throughput, and breaks the
+// floating point inputs down by the internal path each value took. Built with BOOST_CHARCONV_PROFILE
+// together with its own copy of the library sources, see tools/CMakeLists.txt and tools/Jamfile.
+//
+// Usage: charconv_profile [options] file
+//
+//   --parse          the file holds text with one value per line (default)
+//   --format         the file holds binary values in native byte order
+//   --type T         double (default), float, int32, int64 or uint64
+//   --fmt F          general (default), scientific, fixed or hex
+//   --precision N    the precision used with --format, the shortest representation by default
+//   --repeat K       timing runs of each variant, of which the fastest is reported (default 5)
+//   --examples N     inputs shown for each path (default 3)
+
+#include <boost/charconv.hpp>
+#include <boost/charconv/detail/profile.hpp>
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <iterator>
+#include <limits>
+#include <map>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <vector>
+
+#ifndef BOOST_CHARCONV_PROFILE
+#  error "charconv_profile must be built with BOOST_CHARCONV_PROFILE, and so must the library sources it links"
+#endif
+
+namespace {
+
+using boost::charconv::chars_format;
+using boost::charconv::detail::profile_path;
+
+struct options
+{
+    bool parse = true;
+    std::string type = "double";
+    chars_format fmt = chars_format::general;
+    int precision = -1;
+    int repeat = 5;
+    std::size_t examples = 3;
+    std::string file;
+};
+
+// A span of the input text
+struct field
+{
+    const char* first;
+    const char* last;
+};
+
+//----------------------------------------------------------------------------------------------------------------------
+// Paths
+//----------------------------------------------------------------------------------------------------------------------
+
+constexpr std::size_t path_count = static_cast<std::size_t>(profile_path::count);
+
+using counter_snapshot = std::array<std::uint64_t, path_count>;
+
+counter_snapshot snapshot()
+{
+    counter_snapshot s;
+    std::copy(boost::charconv::detail::profile_counters(), boost::charconv::detail::profile_counters() + path_count, s.begin());
+    return s;
+}
+
+std::uint64_t delta(const counter_snapshot& before, const counter_snapshot& after, profile_path path)
+{
+    const auto i = static_cast<std::size_t>(path);
+    return after[i] - before[i];
+}
+
+const char* path_name(profile_path path)
+{
+    switch (path)
+    {
+        case profile_path::from_chars_clinger:
+            return "Clinger fast path";
+        case profile_path::from_chars_eisel_lemire:
+            return "Eisel-Lemire";
+        case profile_path::from_chars_digit_comparison:
+            return "digit_comparison fallback";
+        case profile_path::from_chars_compute_float:
+            return "compute_float";
+        case profile_path::from_chars_strtod:
+            return "strtod fallback";
+        case profile_path::to_chars_integer:
+            return "integer";
+        case profile_path::to_chars_dragonbox_fixed:
+            return "Dragonbox, fixed digits";
+        case profile_path::to_chars_dragonbox:
+            return "Dragonbox";
+        case profile_path::to_chars_floff:
+            return "floff";
+        case profile_path::to_chars_hex:
+            return "hex";
+        default:
+            return "";
+    }
+}
+
+// Describes the paths one conversion took, e.g. "floff, 2 segments, 6 cache blocks"
+std::string describe_paths(const counter_snapshot& before, const counter_snapshot& after)
+{
+    std::string str;
+
+    for (std::size_t i = 0; i < path_count; ++i)
+    {
+        const auto path = static_cast<profile_path>(i);
+        if (path == profile_path::to_chars_floff_segment || path == profile_path::to_chars_floff_cache_block)
+        {
+            continue;
+        }
+
+        if (delta(before, after, path) != 0)
+        {
+            if (!str.empty())
+            {
+                str += " + ";
+            }
+            str += path_name(path);
+        }
+    }
+
+    if (delta(before, after, profile_path::to_chars_floff) != 0)
+    {
+        const auto segments = delta(before, after, profile_path::to_chars_floff_segment);
+        const auto blocks = delta(before, after, profile_path::to_chars_floff_cache_block);
+        if (segments == 0)
+        {
+            str += ", first segment only";
+        }
+        else
+        {
+            str += ", " + std::to_string(segments) + (segments == 1 ? " segment, " : " segments, ") +
+                   std::to_string(blocks) + (blocks == 1 ? " cache block" : " cache blocks");
+        }
+    }
+
+    return str;
+}
+
+struct path_entry
+{
+    std::size_t count = 0;
+    std::vector<std::string> examples;
+};
+
+using path_table = std::map<std::string, path_entry>;
+
+void add_path(path_table& table, const std::string& key, const std::string& example, std::size_t max_examples)
+{
+    auto& entry = table[key];
+    ++entry.count;
+    if (entry.examples.size() < max_examples)
+    {
+        // Long inputs, which are often the interesting ones, are shortened to their start and end
+        entry.examples.push_back(example.size() <= 40 ? example : example.substr(0, 24) + "..." + example.substr(example.size() - 13));
+    }
+}
+
+void print_paths(const path_table& table, std::size_t total)
+{
+    std::vector<std::pair<std::string, path_entry>> rows(table.begin(), table.end());
+    std::stable_sort(rows.begin(), rows.end(), [](const std::pair<std::string, path_entry>& a, const std::pair<std::string, path_entry>& b) {
+        return a.second.count > b.second.count;
+    });
+
+    std::cout << '\n' << std::left << std::setw(52) << "path" << std::right << std::setw(12) << "values" << std::setw(10) << "share" << "  examples\n";
+
+    for (const auto& row : rows)
+    {
+        std::cout << std::left << std::setw(52) << row.first << std::right << std::setw(12) << row.second.count
+                  << std::setw(9) << std::fixed << std::setprecision(2) << 100.0 * static_cast<double>(row.second.count) / static_cast<double>(total) << "%  ";
+
+        for (std::size_t i = 0; i < row.second.examples.size(); ++i)
+        {
+            std::cout << (i == 0 ? "" : ", ") << row.second.examples[i];
+        }
+        std::cout << '\n';
+    }
+}
+
+std::string error_name(std::errc ec)
+{
+    switch (ec)
+    {
+        case std::errc::invalid_argument:
+            return "error: invalid_argument";
+        case std::errc::result_out_of_range:
+            return "error: result_out_of_range";
+        case std::errc::value_too_large:
+            return "error: value_too_large";
+        default:
+            return "error: " + std::make_error_code(ec).message();
+    }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// Timing
+//----------------------------------------------------------------------------------------------------------------------
+
+struct variant
+{
+    std::string name;
+    std::function<std::uint64_t()> run; // Converts every value once and returns a checksum
+};
+
+void print_timings(const std::vector<variant>& variants, std::size_t values, std::size_t text_bytes, int repeat)
+{
+    std::cout << '\n' << std::left << std::setw(36) << "variant" << std::right << std::setw(12) << "ns/value"
+              << std::setw(14) << "Mvalues/s" << std::setw(10) << "MB/s" << '\n';
+
+    for (const auto& v : variants)
+    {
+        double best = std::numeric_limits<double>::max();
+        std::uint64_t checksum = 0;
+
+        for (int i = 0; i < repeat; ++i)
+        {
+            const auto t1 = std::chrono::steady_clock::now();
+            checksum += v.run();
+            const auto t2 = std::chrono::steady_clock::now();
+            best = (std::min)(best, std::chrono::duration<double>(t2 - t1).count());
+        }
+
+        const auto n = static_cast<double>(values);
+        std::cout << std::left << std::setw(36) << v.name << std::right << std::fixed << std::setprecision(1)
+                  << std::setw(12) << best * 1e9 / n << std::setw(14) << n / best / 1e6
+                  << std::setw(10) << static_cast<double>(text_bytes) / best / 1e6
+                  << "  (checksum " << (checksum % 1000) << ")\n";
+    }
+}
+
+template <typename T>
+std::uint64_t checksum_of(T value)
+{
+    std::uint64_t bits = 0;
+    std::memcpy(&bits, &value, sizeof(T) < sizeof(bits) ? sizeof(T) : sizeof(bits));
+    return bits;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// Parsing
+//----------------------------------------------------------------------------------------------------------------------
+
+std::vector<field> split_lines(const char* p, const char* end)
+{
+    std::vector<field> fields;
+
+    while (p < end)
+    {
+        const char* line_end = static_cast<const char*>(std::memchr(p, '\n', static_cast<std::size_t>(end - p)));
+        if (line_end == nullptr)
+        {
+            line_end = end;
+        }
+
+        const char* last = line_end;
+        if (last != p && *(last - 1) == '\r')
+        {
+            --last;
+        }
+        if (last != p)
+        {
+            fields.push_back({p, last});
+        }
+
+        p = line_end + 1;
+    }
+
+    return fields;
+}
+
+template <typename T>
+T strto(const char* str, char** end);
+
+template <>
+double strto<double>(const char* str, char** end)
+{
+    return std::strtod(str, end);
+}
+
+template <>
+float strto<float>(const char* str, char** end)
+{
+    return std::strtof(str, end);
+}
+
+template <typename T>
+void profile_parse_float(const std::vector<field>& fields, std::size_t text_bytes, const options& opt)
+{
+    const chars_format fmt = opt.fmt;
+
+    std::vector<variant> variants;
+
+    variants.push_back({"from_chars", [&]() {
+        std::uint64_t s = 0;
+        for (const auto& f : fields)
+        {
+            T v {};
+            boost::charconv::from_chars(f.first, f.last, v, fmt);
+            s += checksum_of(v);
+        }
+        return s;
+    }});
+
+    // The lines are parts of one buffer with from_chars_padding bytes after the last
+    variants.push_back({"from_chars_padded", [&]() {
+        std::uint64_t s = 0;
+        for (const auto& f : fields)
+        {
+            T v {};
+            boost::charconv::from_chars_padded(f.first, f.last, v, fmt);
+            s += checksum_of(v);
+        }
+        return s;
+    }});
+
+    variants.push_back({"from_chars_faithful", [&]() {
+        std::uint64_t s = 0;
+        for (const auto& f : fields)
+        {
+            T v {};
+            boost::charconv::from_chars_faithful(f.first, f.last, v, fmt);
+            s += checksum_of(v);
+        }
+        return s;
+    }});
+
+    variants.push_back({"from_chars_ext", [&]() {
+        std::uint64_t s = 0;
+        for (const auto& f : fields)
+        {
+            T v {};
+            boost::charconv::from_chars_ext(f.first, f.last, v, fmt);
+            s += checksum_of(v);
+        }
+        return s;
+    }});
+
+    // strtod needs a terminated string
+    std::vector<std::string> strings;
+    strings.reserve(fields.size());
+    for (const auto& f : fields)
+    {
+        strings.emplace_back(f.first, f.last);
+    }
+
+    variants.push_back({"strtod (reference)", [&]() {
+        std::uint64_t s = 0;
+        for (const auto& str : strings)
+        {
+            s += checksum_of(strto<T>(str.c_str(), nullptr));
+        }
+        return s;
+    }});
+
+    print_timings(variants, fields.size(), text_bytes, opt.repeat);
+
+    path_table table;
+    for (const auto& f : fields)
+    {
+        const auto before = snapshot();
+        T v {};
+        const auto r = boost::charconv::from_chars(f.first, f.last, v, fmt);
+        const auto after = snapshot();
+
+        std::string key = describe_paths(before, after);
+        if (r.ec != std::errc())
+        {
+            key = error_name(r.ec) + (key.empty() ? "" : " (" + key + ")");
+        }
+        else if (key.empty())
+        {
+            key = "inf or nan";
+        }
+
+        add_path(table, key, std::string(f.first, f.last), opt.examples);
+    }
+
+    print_paths(table, fields.size());
+}
+
+template <typename T>
+void profile_parse_integer(const std::vector<field>& fields, std::size_t text_bytes, const options& opt)
+{
+    std::vector<variant> variants;
+
+    variants.push_back({"from_chars", [&]() {
+        std::uint64_t s = 0;
+        for (const auto& f : fields)
+        {
+            T v {};
+            boost::charconv::from_chars(f.first, f.last, v);
+            s += static_cast<std::uint64_t>(v);
+        }
+        return s;
+    }});
+
+    variants.push_back({"from_chars_padded", [&]() {
+        std::uint64_t s = 0;
+        for (const auto& f : fields)
+        {
+            T v {};
+            boost::charconv::from_chars_padded(f.first, f.last, v);
+            s += static_cast<std::uint64_t>(v);
+        }
+        return s;
+    }});
+
+    std::vector<std::string> strings;
+    strings.reserve(fields.size());
+    for (const auto& f : fields)
+    {
+        strings.emplace_back(f.first, f.last);
+    }
+
+    variants.push_back({"strtoll (reference)", [&]() {
+        std::uint64_t s = 0;
+        for (const auto& str : strings)
+        {
+            s += std::is_signed<T>::value ? static_cast<std::uint64_t>(std::strtoll(str.c_str(), nullptr, 10))
+                                          : static_cast<std::uint64_t>(std::strtoull(str.c_str(), nullptr, 10));
+        }
+        return s;
+    }});
+
+    print_timings(variants, fields.size(), text_bytes, opt.repeat);
+
+    // The integer parsers have a single path, whose cost grows with the number of characters
+    path_table table;
+    for (const auto& f : fields)
+    {
+        T v {};
+        const auto r = boost::charconv::from_chars(f.first, f.last, v);
+        const std::string key = r.ec != std::errc() ? error_name(r.ec) : std::to_string(r.ptr - f.first) + " characters";
+        add_path(table, key, std::string(f.first, f.last), opt.examples);
+    }
+
+    print_paths(table, fields.size());
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// Formatting
+//----------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+std::vector<T> read_values(const std::string& data)
+{
+    std::vector<T> values(data.size() / sizeof(T));
+    if (!values.empty())
+    {
+        std::memcpy(values.data(), data.data(), values.size() * sizeof(T));
+    }
+    return values;
+}
+
+// The printf conversion equivalent to fmt and precision
+std::string printf_format(chars_format fmt, int precision, bool is_float)
+{
+    const char* conversion = fmt == chars_format::scientific ? "e" : fmt == chars_format::fixed ? "f" : fmt == chars_format::hex ? "a" : "g";
+    const int digits = precision >= 0 ? precision : (fmt == chars_format::general ? (is_float ? 9 : 17) : (is_float ? 8 : 16));
+    return "%." + std::to_string(digits) + conversion;
+}
+
+template <typename T>
+void profile_format_float(const std::vector<T>& values, const options& opt)
+{
+    const chars_format fmt = opt.fmt;
+    const int precision = opt.precision;
+
+    // Large enough for fixed output of any value at a precision up to a few hundred
+    constexpr std::size_t buffer_size = 1024;
+    if (precision > 600)
+    {
+        std::cerr << "The precision is limited to 600\n";
+        std::exit(2);
+    }
+
+    std::size_t text_bytes = 0;
+    for (const auto v : values)
+    {
+        char buffer[buffer_size];
+        text_bytes += static_cast<std::size_t>(boost::charconv::to_chars(buffer, buffer + sizeof(buffer), v, fmt, precision).ptr - buffer);
+    }
+
+    std::vector<variant> variants;
+
+    variants.push_back({"to_chars", [&]() {
+        std::uint64_t s = 0;
+        for (const auto v : values)
+        {
+            char buffer[buffer_size];
+            const auto r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), v, fmt, precision);
+            s += static_cast<std::uint64_t>(r.ptr - buffer) + static_cast<unsigned char>(buffer[0]);
+        }
+        return s;
+    }});
+
+    const std::string format = printf_format(fmt, precision, std::is_same<T, float>::value);
+    variants.push_back({"snprintf " + format + " (reference)", [&]() {
+        std::uint64_t s = 0;
+        for (const auto v : values)
+        {
+            char buffer[buffer_size];
+            const int n = std::snprintf(buffer, sizeof(buffer), format.c_str(), static_cast<double>(v));
+            s += static_cast<std::uint64_t>(n) + static_cast<unsigned char>(buffer[0]);
+        }
+        return s;
+    }});
+
+    print_timings(variants, values.size(), text_bytes, opt.repeat);
+
+    path_table table;
+    for (const auto v : values)
+    {
+        char buffer[buffer_size];
+
+        const auto before = snapshot();
+        const auto r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), v, fmt, precision);
+        const auto after = snapshot();
+
+        std::string key = describe_paths(before, after);
+        if (r.ec != std::errc())
+        {
+            key = error_name(r.ec);
+        }
+        else if (key.empty())
+        {
+            key = "other";
+        }
+
+        char example[64];
+        std::snprintf(example, sizeof(example), "%.17g", static_cast<double>(v));
+        add_path(table, key, example, opt.examples);
+    }
+
+    print_paths(table, values.size());
+}
+
+template <typename T>
+void profile_format_integer(const std::vector<T>& values, const options& opt)
+{
+    std::size_t text_bytes = 0;
+    for (const auto v : values)
+    {
+        char buffer[32];
+        text_bytes += static_cast<std::size_t>(boost::charconv::to_chars(buffer, buffer + sizeof(buffer), v).ptr - buffer);
+    }
+
+    std::vector<variant> variants;
+
+    variants.push_back({"to_chars", [&]() {
+        std::uint64_t s = 0;
+        for (const auto v : values)
+        {
+            char buffer[32];
+            const auto r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), v);
+            s += static_cast<std::uint64_t>(r.ptr - buffer) + static_cast<unsigned char>(buffer[0]);
+        }
+        return s;
+    }});
+
+    variants.push_back({"snprintf (reference)", [&]() {
+        std::uint64_t s = 0;
+        for (const auto v : values)
+        {
+            char buffer[32];
+            const int n = std::is_signed<T>::value ? std::snprintf(buffer, sizeof(buffer), "%lld", static_cast<long long>(v))
+                                                   : std::snprintf(buffer, sizeof(buffer), "%llu", static_cast<unsigned long long>(v));
+            s += static_cast<std::uint64_t>(n) + static_cast<unsigned char>(buffer[0]);
+        }
+        return s;
+    }});
+
+    print_timings(variants, values.size(), text_bytes, opt.repeat);
+
+    path_table table;
+    for (const auto v : values)
+    {
+        char buffer[32];
+        const auto r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), v);
+        add_path(table, std::to_string(r.ptr - buffer) + " characters", std::string(buffer, r.ptr), opt.examples);
+    }
+
+    print_paths(table, values.size());
+}
+
+template <typename T>
+void profile_format_values(const std::vector<T>& values, const options& opt, std::true_type)
+{
+    profile_format_float(values, opt);
+}
+
+template <typename T>
+void profile_format_values(const std::vector<T>& values, const options& opt, std::false_type)
+{
+    profile_format_integer(values, opt);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// Command line
+//----------------------------------------------------------------------------------------------------------------------
+
+[[noreturn]] void usage()
+{
+    std::cerr << "Usage: charconv_profile [--parse | --format] [--type double|float|int32|int64|uint64]\n"
+                 "                        [--fmt general|scientific|fixed|hex] [--precision N] [--repeat K]\n"
+                 "                        [--examples N] file\n";
+    std::exit(2);
+}
+
+int parse_int_argument(const char* str)
+{
+    int value = 0;
+    const auto r = boost::charconv::from_chars(str, str + std::strlen(str), value);
+    if (r.ec != std::errc() || *r.ptr != '\0' || value < 0)
+    {
+        usage();
+    }
+    return value;
+}
+
+options parse_options(int argc, char** argv)
+{
+    options opt;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        const std::string arg = argv[i];
+        const bool has_value = i + 1 < argc;
+
+        if (arg == "--parse")
+        {
+            opt.parse = true;
+        }
+        else if (arg == "--format")
+        {
+            opt.parse = false;
+        }
+        else if (arg == "--type" && has_value)
+        {
+            opt.type = argv[++i];
+        }
+        else if (arg == "--fmt" && has_value)
+        {
+            const std::string fmt = argv[++i];
+            if (fmt == "general")
+            {
+                opt.fmt = chars_format::general;
+            }
+            else if (fmt == "scientific")
+            {
+                opt.fmt = chars_format::scientific;
+            }
+            else if (fmt == "fixed")
+            {
+                opt.fmt = chars_format::fixed;
+            }
+            else if (fmt == "hex")
+            {
+                opt.fmt = chars_format::hex;
+            }
+            else
+            {
+                usage();
+            }
+        }
+        else if (arg == "--precision" && has_value)
+        {
+            opt.precision = parse_int_argument(argv[++i]);
+        }
+        else if (arg == "--repeat" && has_value)
+        {
+            opt.repeat = (std::max)(1, parse_int_argument(argv[++i]));
+        }
+        else if (arg == "--examples" && has_value)
+        {
+            opt.examples = static_cast<std::size_t>(parse_int_argument(argv[++i]));
+        }
+        else if (opt.file.empty() && !arg.empty() && arg[0] != '-')
+        {
+            opt.file = arg;
+        }
+        else
+        {
+            usage();
+        }
+    }
+
+    if (opt.file.empty())
+    {
+        usage();
+    }
+
+    return opt;
+}
+
+std::string read_file(const std::string& name)
+{
+    std::ifstream in(name, std::ios::binary);
+    if (!in)
+    {
+        std::cerr << "Can not open " << name << '\n';
+        std::exit(1);
+    }
+
+    return std::string(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+}
+
+template <typename T>
+void profile_format(const std::string& data, const options& opt)
+{
+    const auto values = read_values<T>(data);
+    std::cout << opt.file << ": " << values.size() << " values of " << opt.type << '\n';
+
+    if (data.size() % sizeof(T) != 0)
+    {
+        std::cout << "The last " << data.size() % sizeof(T) << " bytes are ignored\n";
+    }
+
+    if (values.empty())
+    {
+        return;
+    }
+
+    profile_format_values(values, opt, std::is_floating_point<T>());
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    const options opt = parse_options(argc, argv);
+    std::string data = read_file(opt.file);
+
+    if (opt.parse)
+    {
+        // Padding for from_chars_padded, which is never part of a line
+        const auto text_bytes = data.size();
+        data.append(boost::charconv::from_chars_padding, '\0');
+        const auto fields = split_lines(data.data(), data.data() + text_bytes);
+
+        std::cout << opt.file << ": " << fields.size() << " lines, " << text_bytes << " bytes, parsed as " << opt.type << '\n';
+        if (fields.empty())
+        {
+            return 0;
+        }
+
+        if (opt.type == "double")
+        {
+            profile_parse_float<double>(fields, text_bytes, opt);
+        }
+        else if (opt.type == "float")
+        {
+            profile_parse_float<float>(fields, text_bytes, opt);
+        }
+        else if (opt.type == "int32")
+        {
+            profile_parse_integer<std::int32_t>(fields, text_bytes, opt);
+        }
+        else if (opt.type == "int64")
+        {
+            profile_parse_integer<std::int64_t>(fields, text_bytes, opt);
+        }
+        else if (opt.type == "uint64")
+        {
+            profile_parse_integer<std::uint64_t>(fields, text_bytes, opt);
+        }
+        else
+        {
+            usage();
+        }
+    }
+    else
+    {
+        if (opt.type == "double")
+        {
+            profile_format<double>(data, opt);
+        }
+        else if (opt.type == "float")
+        {
+            profile_format<float>(data, opt);
+        }
+        else if (opt.type == "int32")
+        {
+            profile_format<std::int32_t>(data, opt);
+        }
+        else if (opt.type == "int64")
+        {
+            profile_format<std::int64_t>(data, opt);
+        }
+        else if (opt.type == "uint64")
+        {
+            profile_format<std::uint64_t>(data, opt);
+        }
+        else
+        {
+            usage();
+        }
+    }
+
+    return 0;
+}